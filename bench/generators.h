@@ -0,0 +1,167 @@
+#pragma once
+
+/**
+ * @file generators.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "geometry/point_2d.h"
+
+namespace euclid::bench {
+
+/**
+ * @brief A seeded synthetic workload: the same name, size and seed always give the same points.
+ */
+struct Generator {
+    std::string name;
+    std::vector<geometry::Point2D> (*generate)(size_t size, uint64_t seed);
+};
+
+/**
+ * @brief Uniformly distributed in the square [-1, 1]^2, the hull has O(log n) vertices.
+ */
+inline std::vector<geometry::Point2D> GenerateUniformSquare(size_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<geometry::Point2D> points(size);
+    for (auto& point : points) {
+        point = {distribution(generator), distribution(generator)};
+    }
+    return points;
+}
+
+/**
+ * @brief Uniformly distributed in the unit disk, the hull has O(n^(1/3)) vertices.
+ */
+inline std::vector<geometry::Point2D> GenerateUniformDisk(size_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<geometry::Point2D> points(size);
+    for (auto& point : points) {
+        double radius = std::sqrt(distribution(generator));
+        double angle = 2.0 * std::numbers::pi * distribution(generator);
+        point = {radius * std::cos(angle), radius * std::sin(angle)};
+    }
+    return points;
+}
+
+/**
+ * @brief On the unit circle in random order, the worst case h = n for output-sensitive algorithms.
+ */
+inline std::vector<geometry::Point2D> GenerateCircle(size_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 2.0 * std::numbers::pi);
+    std::vector<geometry::Point2D> points(size);
+    for (auto& point : points) {
+        double angle = distribution(generator);
+        point = {std::cos(angle), std::sin(angle)};
+    }
+    return points;
+}
+
+/**
+ * @brief Uniform in the square but drawn from only about n / 100 distinct locations.
+ */
+inline std::vector<geometry::Point2D> GenerateHeavyDuplicates(size_t size, uint64_t seed) {
+    auto locations = GenerateUniformSquare(std::max<size_t>(1, size / 100), seed);
+    std::mt19937_64 generator(seed + 1);
+    std::uniform_int_distribution<size_t> distribution(0, locations.size() - 1);
+    std::vector<geometry::Point2D> points(size);
+    for (auto& point : points) {
+        point = locations[distribution(generator)];
+    }
+    return points;
+}
+
+/**
+ * @brief Clusters along 8 random lines with a perpendicular spread of 1e-12, so that most orientations are decided
+ * close to zero.
+ */
+inline std::vector<geometry::Point2D> GenerateNearCollinearClusters(size_t size, uint64_t seed) {
+    constexpr size_t kNumLines = 8;
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::uniform_real_distribution<double> noise(-1e-12, 1e-12);
+    geometry::Point2D origins[kNumLines];
+    geometry::Point2D directions[kNumLines];
+    for (size_t i = 0; i < kNumLines; ++i) {
+        origins[i] = {distribution(generator), distribution(generator)};
+        double angle = std::numbers::pi * distribution(generator);
+        directions[i] = {std::cos(angle), std::sin(angle)};
+    }
+    std::vector<geometry::Point2D> points(size);
+    for (size_t i = 0; i < size; ++i) {
+        const auto& origin = origins[i % kNumLines];
+        const auto& direction = directions[i % kNumLines];
+        double t = distribution(generator);
+        double offset = noise(generator);
+        points[i] = {origin.coords[0] + t * direction.coords[0] - offset * direction.coords[1],
+                     origin.coords[1] + t * direction.coords[1] + offset * direction.coords[0]};
+    }
+    return points;
+}
+
+/**
+ * @brief 8 Gaussian blobs with random centres and spreads.
+ */
+inline std::vector<geometry::Point2D> GenerateGaussianBlobs(size_t size, uint64_t seed) {
+    constexpr size_t kNumBlobs = 8;
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+    std::uniform_real_distribution<double> spread(0.1, 2.0);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    geometry::Point2D centres[kNumBlobs];
+    double spreads[kNumBlobs];
+    for (size_t i = 0; i < kNumBlobs; ++i) {
+        centres[i] = {distribution(generator), distribution(generator)};
+        spreads[i] = spread(generator);
+    }
+    std::vector<geometry::Point2D> points(size);
+    for (size_t i = 0; i < size; ++i) {
+        const size_t blob = i % kNumBlobs;
+        points[i] = {centres[blob].coords[0] + spreads[blob] * normal(generator),
+                     centres[blob].coords[1] + spreads[blob] * normal(generator)};
+    }
+    return points;
+}
+
+/**
+ * @brief The vertices of a simple polygon in boundary order, like the outline of a large footprint: star-shaped, with
+ * the radius varying randomly between 0.5 and 1, so that only a few vertices lie on the hull.
+ */
+inline std::vector<geometry::Point2D> GenerateSimplePolygon(size_t size, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<geometry::Point2D> points(size);
+    for (size_t i = 0; i < size; ++i) {
+        double angle = 2.0 * std::numbers::pi * (static_cast<double>(i) + distribution(generator)) /
+                       static_cast<double>(size);
+        double radius = 0.5 + 0.5 * distribution(generator);
+        points[i] = {radius * std::cos(angle), radius * std::sin(angle)};
+    }
+    return points;
+}
+
+inline std::vector<Generator> GetGenerators() {
+    return {
+        {"uniform_square", GenerateUniformSquare},
+        {"uniform_disk", GenerateUniformDisk},
+        {"circle", GenerateCircle},
+        {"heavy_duplicates", GenerateHeavyDuplicates},
+        {"near_collinear_clusters", GenerateNearCollinearClusters},
+        {"gaussian_blobs", GenerateGaussianBlobs},
+        {"simple_polygon", GenerateSimplePolygon},
+    };
+}
+
+}  // namespace euclid::bench
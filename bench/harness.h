@@ -0,0 +1,165 @@
+#pragma once
+
+/**
+ * @file harness.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "geometry/point_2d.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace euclid::bench {
+
+/**
+ * @brief Heap allocations and allocated bytes, counted by the replaced global operator new of the benchmark binary.
+ */
+inline std::atomic<size_t> num_allocations{0};
+inline std::atomic<size_t> num_allocated_bytes{0};
+
+/**
+ * @brief The peak resident set size of the process in bytes, 0 where it cannot be queried.
+ */
+inline size_t GetPeakRss() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#elif defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // kilobytes on Linux and the BSDs
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief A benchmark runs on a point set and returns a value depending on the result, e.g. the hull size, so that the
+ * work cannot be optimized away.
+ */
+struct Benchmark {
+    std::string name;
+    // Larger inputs are skipped, e.g. for the O(n^4) extreme point hull.
+    size_t max_size;
+    std::function<size_t(const std::vector<geometry::Point2D>&)> run;
+    // Only runs on the generator of this name if not empty, e.g. for algorithms that need a simple polygon.
+    std::string generator = {};
+};
+
+struct Result {
+    std::string benchmark;
+    std::string generator;
+    size_t size = 0;
+    size_t iterations = 0;
+    double ns_per_point = 0.0;
+    double allocations_per_iteration = 0.0;
+    double allocated_bytes_per_iteration = 0.0;
+    size_t output = 0;
+    size_t peak_rss_bytes = 0;
+};
+
+/**
+ * @brief Runs a benchmark repeatedly until min_seconds have passed. The first run only warms up, unless it alone takes
+ * min_seconds, which is the case for the slow algorithms on large inputs.
+ */
+inline Result Measure(const Benchmark& benchmark, const std::string& generator,
+                      const std::vector<geometry::Point2D>& points, double min_seconds) {
+    using Clock = std::chrono::steady_clock;
+    Result result;
+    result.benchmark = benchmark.name;
+    result.generator = generator;
+    result.size = points.size();
+
+    size_t allocations_before = num_allocations.load();
+    size_t bytes_before = num_allocated_bytes.load();
+    auto start = Clock::now();
+    result.output = benchmark.run(points);
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (seconds < min_seconds) {
+        allocations_before = num_allocations.load();
+        bytes_before = num_allocated_bytes.load();
+        start = Clock::now();
+        do {
+            result.output = benchmark.run(points);
+            result.iterations++;
+            seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (seconds < min_seconds);
+    } else {
+        result.iterations = 1;
+    }
+    const double iterations = static_cast<double>(result.iterations);
+    result.ns_per_point = seconds * 1e9 / (iterations * static_cast<double>(std::max<size_t>(1, points.size())));
+    result.allocations_per_iteration = static_cast<double>(num_allocations.load() - allocations_before) / iterations;
+    result.allocated_bytes_per_iteration =
+        static_cast<double>(num_allocated_bytes.load() - bytes_before) / iterations;
+    result.peak_rss_bytes = GetPeakRss();
+    return result;
+}
+
+inline std::string EscapeJson(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+            escaped += buffer;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+inline void WriteJson(std::FILE* file, const std::vector<std::pair<std::string, std::string>>& context,
+                      const std::vector<Result>& results) {
+    std::fprintf(file, "{\n  \"context\": {");
+    for (size_t i = 0; i < context.size(); ++i) {
+        std::fprintf(file, "%s\n    \"%s\": \"%s\"", i == 0 ? "" : ",", EscapeJson(context[i].first).c_str(),
+                     EscapeJson(context[i].second).c_str());
+    }
+    std::fprintf(file, "\n  },\n  \"results\": [");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        std::fprintf(file,
+                     "%s\n    {\"benchmark\": \"%s\", \"generator\": \"%s\", \"size\": %zu, \"iterations\": %zu, "
+                     "\"ns_per_point\": %.4f, \"allocations_per_iteration\": %.2f, "
+                     "\"allocated_bytes_per_iteration\": %.0f, \"output\": %zu, \"peak_rss_bytes\": %zu}",
+                     i == 0 ? "" : ",", EscapeJson(result.benchmark).c_str(), EscapeJson(result.generator).c_str(),
+                     result.size, result.iterations, result.ns_per_point, result.allocations_per_iteration,
+                     result.allocated_bytes_per_iteration, result.output, result.peak_rss_bytes);
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+}
+
+}  // namespace euclid::bench
@@ -0,0 +1,573 @@
+/**
+ * @file main.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <numbers>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "algorithm/convex_hull/approximate.h"
+#include "algorithm/convex_hull/chan.h"
+#include "algorithm/convex_hull/dynamic.h"
+#include "algorithm/convex_hull/extreme_edge.h"
+#include "algorithm/convex_hull/extreme_point.h"
+#include "algorithm/convex_hull/graham_scan.h"
+#include "algorithm/convex_hull/melkman.h"
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_hull/parallel.h"
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/convex_hull/sliding_window.h"
+#include "algorithm/convex_hull/streaming.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/convex_polygon/intersection.h"
+#include "algorithm/convex_polygon/minkowski_sum.h"
+#include "algorithm/rotating_calipers/rotating_calipers.h"
+#include "algorithm/segment_intersection/grid.h"
+#include "algorithm/segment_intersection/sweep.h"
+#include "algorithm/spatial_index/batch.h"
+#include "algorithm/spatial_index/kd_tree.h"
+#include "algorithm/spatial_index/r_tree.h"
+#include "algorithm/spatial_index/triangle_grid.h"
+#include "algorithm/triangulation/delaunay.h"
+#include "algorithm/util/batch_location.h"
+#include "algorithm/util/edge_equations.h"
+#include "algorithm/util/location.h"
+#include "algorithm/util/orient_2d.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "bench/generators.h"
+#include "bench/harness.h"
+#include "geometry/convex_polygon_2d.h"
+#include "geometry/point_2d.h"
+#include "geometry/point_set_2d.h"
+#include "geometry/segment_2d.h"
+#include "geometry/triangle_2d.h"
+#include "util/thread_pool.h"
+
+void* operator new(size_t size) {
+    euclid::bench::num_allocations.fetch_add(1, std::memory_order_relaxed);
+    euclid::bench::num_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    euclid::bench::num_allocations.fetch_add(1, std::memory_order_relaxed);
+    euclid::bench::num_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+// GCC pairs the free below with the inlined operator new instead of the replacement above.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+using euclid::bench::Benchmark;
+using euclid::geometry::Point2D;
+namespace convex_hull = euclid::algorithm::convex_hull;
+namespace convex_polygon = euclid::algorithm::convex_polygon;
+namespace util = euclid::algorithm::util;
+namespace rotating_calipers = euclid::algorithm::rotating_calipers;
+namespace segment_intersection = euclid::algorithm::segment_intersection;
+namespace spatial_index = euclid::algorithm::spatial_index;
+
+using Points = std::vector<Point2D>;
+
+constexpr size_t kUnlimited = static_cast<size_t>(-1);
+
+/**
+ * @brief Evaluates a predicate on every point and its two successors, counting the true results.
+ */
+template <typename Predicate>
+size_t CountTriples(const std::vector<Point2D>& points, Predicate predicate) {
+    const size_t size = points.size();
+    size_t count = 0;
+    for (size_t i = 0; i < size; ++i) {
+        count += predicate(points[i], points[(i + 1) % size], points[(i + 2) % size]) ? 1 : 0;
+    }
+    return count;
+}
+
+/**
+ * @brief The vertices of a regular polygon inscribed in the unit circle, counter-clockwise, for the containment
+ * benchmarks.
+ */
+std::vector<Point2D> GetRegularPolygon(size_t num_vertices) {
+    std::vector<Point2D> vertices;
+    for (size_t i = 0; i < num_vertices; ++i) {
+        double angle = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(num_vertices);
+        vertices.push_back({std::cos(angle), std::sin(angle)});
+    }
+    return vertices;
+}
+
+/**
+ * @brief A mesh of the square [-1, 1]^2, every cell of a regular grid split in two triangles, for the point location
+ * benchmarks.
+ */
+std::vector<euclid::geometry::Triangle2D> GetSquareMesh(size_t num_cells_per_side) {
+    std::vector<euclid::geometry::Triangle2D> triangles;
+    const double cell_size = 2.0 / static_cast<double>(num_cells_per_side);
+    for (size_t row = 0; row < num_cells_per_side; ++row) {
+        for (size_t column = 0; column < num_cells_per_side; ++column) {
+            const double x = -1.0 + cell_size * static_cast<double>(column);
+            const double y = -1.0 + cell_size * static_cast<double>(row);
+            triangles.push_back({{{x, y}, {x + cell_size, y}, {x + cell_size, y + cell_size}}});
+            triangles.push_back({{{x, y}, {x + cell_size, y + cell_size}, {x, y + cell_size}}});
+        }
+    }
+    return triangles;
+}
+
+/**
+ * @brief Counts the points in a convex polygon by the fan test, checking the triangles of the diagonals from the
+ * first vertex one by one.
+ */
+size_t CountInFan(const std::vector<Point2D>& vertices, const Points& points) {
+    size_t count = 0;
+    for (const auto& point : points) {
+        for (size_t i = 1; i + 1 < vertices.size(); ++i) {
+            if (util::IsPointInTriangle(point, vertices[0], vertices[i], vertices[i + 1])) {
+                count++;
+                break;
+            }
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Every point moved 1/64 of the way to its successor, the queries of the spatial index benchmarks.
+ */
+Points GetQueries(const Points& points) {
+    Points queries(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& p = points[i];
+        const auto& q = points[(i + 1) % points.size()];
+        queries[i] = {p.coords[0] + (q.coords[0] - p.coords[0]) / 64, p.coords[1] + (q.coords[1] - p.coords[1]) / 64};
+    }
+    return queries;
+}
+
+/**
+ * @brief Finds the nearest point of a query near every point, counting those nearest to the point itself.
+ */
+template <typename SpatialIndex>
+size_t CountNearest(const SpatialIndex& spatial_index, const Points& points) {
+    auto queries = GetQueries(points);
+    spatial_index::QueryWorkspace workspace;
+    size_t count = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        count += spatial_index.Nearest(queries[i], workspace) == i ? 1 : 0;
+    }
+    return count;
+}
+
+/**
+ * @brief CountNearest with the batched queries.
+ */
+template <typename SpatialIndex>
+size_t CountNearest(const SpatialIndex& spatial_index, const Points& points, euclid::util::ThreadPool& thread_pool) {
+    auto queries = GetQueries(points);
+    std::vector<size_t> nearest;
+    spatial_index::GetNearest(spatial_index, queries, nearest, thread_pool);
+    size_t count = 0;
+    for (size_t i = 0; i < nearest.size(); ++i) {
+        count += nearest[i] == i ? 1 : 0;
+    }
+    return count;
+}
+
+/**
+ * @brief Every point joined to a point 4 / sqrt(n) of the way to its successor, short segments with a few crossings
+ * each like a road network.
+ */
+std::vector<euclid::geometry::Segment2D> GetSegments(const Points& points) {
+    const double ratio = 4.0 / std::sqrt(static_cast<double>(std::max<size_t>(1, points.size())));
+    std::vector<euclid::geometry::Segment2D> segments(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& p = points[i];
+        const auto& q = points[(i + 1) % points.size()];
+        segments[i] = {{p, {p.coords[0] + (q.coords[0] - p.coords[0]) * ratio,
+                            p.coords[1] + (q.coords[1] - p.coords[1]) * ratio}}};
+    }
+    return segments;
+}
+
+std::vector<Benchmark> GetBenchmarks(euclid::util::ThreadPool& thread_pool) {
+    auto workspace = std::make_shared<convex_hull::HullWorkspace>();
+    auto output_points = std::make_shared<std::vector<Point2D>>();
+    // The hulls the containment benchmarks query have hundreds of vertices.
+    auto polygon = std::make_shared<euclid::geometry::ConvexPolygon2D>(GetRegularPolygon(256));
+    // The mesh the point location benchmarks query has 2 * 256^2 triangles, too many for the caches.
+    auto triangle_grid = std::make_shared<spatial_index::TriangleGrid2D>(GetSquareMesh(256));
+    return {
+        {"extreme_point", 100,
+         [](const Points& points) { return convex_hull::GetConvexHullByExtremePoint(points).size(); }},
+        {"extreme_edge", 100,
+         [](const Points& points) { return convex_hull::GetConvexHullByExtremeEdge(points).size(); }},
+        {"graham_scan", kUnlimited,
+         [](const Points& points) { return convex_hull::GetConvexHullByGrahamScan(points).size(); }},
+        {"monotone_chain", kUnlimited,
+         [](const Points& points) { return convex_hull::GetConvexHullByMonotoneChain(points).size(); }},
+        {"monotone_chain_adaptive", kUnlimited,
+         [](const Points& points) {
+             return convex_hull::GetConvexHullByMonotoneChain<util::AdaptivePredicates>(points).size();
+         }},
+        {"quick_hull", kUnlimited,
+         [](const Points& points) { return convex_hull::GetConvexHullByQuickHull(points).size(); }},
+        {"quick_hull_adaptive", kUnlimited,
+         [](const Points& points) {
+             return convex_hull::GetConvexHullByQuickHull<util::AdaptivePredicates>(points).size();
+         }},
+        {"quick_hull_workspace", kUnlimited,
+         [workspace, output_points](const Points& points) {
+             // Allocates only while the buffers grow, i.e. not after the warm-up run.
+             convex_hull::GetConvexHullByQuickHull(points, *output_points, *workspace);
+             return output_points->size();
+         }},
+        {"chan", kUnlimited, [](const Points& points) { return convex_hull::GetConvexHullByChan(points).size(); }},
+        {"melkman", kUnlimited,
+         [](const Points& points) { return convex_hull::GetConvexHullByMelkman(points).size(); }, "simple_polygon"},
+        {"dynamic", kUnlimited,
+         [](const Points& points) {
+             convex_hull::DynamicConvexHull2D dynamic_convex_hull;
+             for (const auto& point : points) {
+                 dynamic_convex_hull.Insert(point);
+             }
+             return dynamic_convex_hull.GetConvexHull().size();
+         }},
+        {"parallel", kUnlimited,
+         [&thread_pool](const Points& points) {
+             return convex_hull::GetConvexHullInParallel(points, thread_pool).size();
+         }},
+        {"approximate_directions", kUnlimited,
+         [&thread_pool](const Points& points) {
+             return convex_hull::GetApproximateConvexHullByDirections(points, 64, thread_pool).points.size();
+         }},
+        {"approximate_grid", kUnlimited,
+         [&thread_pool](const Points& points) {
+             return convex_hull::GetApproximateConvexHullByGrid(points, 1e-3, thread_pool).points.size();
+         }},
+        {"streaming", kUnlimited,
+         [](const Points& points) {
+             convex_hull::StreamingConvexHull streaming_convex_hull;
+             streaming_convex_hull.Add(points);
+             return streaming_convex_hull.GetConvexHull().size();
+         }},
+        {"sliding_window", kUnlimited,
+         [](const Points& points) {
+             // A window of the last 1024 points, its extreme point queried every 16 points.
+             convex_hull::SlidingWindowHull2D sliding_window_hull;
+             size_t count = 0;
+             for (size_t i = 0; i < points.size(); ++i) {
+                 sliding_window_hull.PushBack(points[i]);
+                 if (sliding_window_hull.Size() > 1024) {
+                     sliding_window_hull.PopFront();
+                 }
+                 if (i % 16 == 0) {
+                     count += sliding_window_hull.GetExtremePoint({1, 1})->coords[0] > 0 ? 1 : 0;
+                 }
+             }
+             return count + sliding_window_hull.GetConvexHull().size();
+         }},
+        {"rotating_calipers", kUnlimited,
+         [](const Points& points) {
+             // The points to oriented bounding box pipeline, dominated by the hull.
+             auto convex_hull_points = convex_hull::GetConvexHullByMonotoneChain(points);
+             auto measures = rotating_calipers::GetCaliperMeasures(convex_hull_points);
+             return measures ? convex_hull_points.size() : 0;
+         }},
+        {"convex_polygon_intersection", kUnlimited,
+         [polygon](const Points& points) {
+             // The hull of the points clipped by a hull of hundreds of vertices, dominated by the hull.
+             auto convex_hull_points = convex_hull::GetConvexHullByMonotoneChain(points);
+             return convex_polygon::GetIntersection(convex_hull_points, polygon->Vertices()).size();
+         }},
+        {"minkowski_sum", kUnlimited,
+         [polygon](const Points& points) {
+             auto convex_hull_points = convex_hull::GetConvexHullByMonotoneChain(points);
+             return convex_polygon::GetMinkowskiSum(convex_hull_points, polygon->Vertices()).size();
+         }},
+        {"delaunay", kUnlimited,
+         [](const Points& points) {
+             return euclid::algorithm::triangulation::DelaunayTriangulation2D(points).NumTriangles();
+         }},
+        {"segment_intersection", kUnlimited,
+         [](const Points& points) {
+             size_t count = 0;
+             segment_intersection::ForEachSegmentIntersection(GetSegments(points), [&count](size_t, size_t) {
+                 count++;
+             });
+             return count;
+         }},
+        {"segment_intersection_grid", kUnlimited,
+         [&thread_pool](const Points& points) {
+             std::vector<size_t> counts(thread_pool.NumThreads());
+             segment_intersection::ForEachSegmentIntersectionByGrid(
+                 GetSegments(points), thread_pool, [&counts](size_t, size_t, size_t thread) { counts[thread]++; });
+             return std::accumulate(counts.begin(), counts.end(), size_t{0});
+         }},
+        {"std_sort", kUnlimited,
+         [](const Points& points) {
+             // the baseline of the spatial sorts
+             auto sorted_points = points;
+             std::sort(sorted_points.begin(), sorted_points.end());
+             return sorted_points.size();
+         }},
+        {"morton_sort", kUnlimited,
+         [](const Points& points) {
+             auto sorted_points = points;
+             util::SortBySpatialOrder(sorted_points, util::SpaceFillingCurve::kMorton);
+             return sorted_points.size();
+         }},
+        {"hilbert_sort", kUnlimited,
+         [](const Points& points) {
+             auto sorted_points = points;
+             util::SortBySpatialOrder(sorted_points);
+             return sorted_points.size();
+         }},
+        {"hilbert_sort_parallel", kUnlimited,
+         [&thread_pool](const Points& points) {
+             auto sorted_points = points;
+             util::SortBySpatialOrder(sorted_points, util::SpaceFillingCurve::kHilbert, thread_pool);
+             return sorted_points.size();
+         }},
+        {"kd_tree", kUnlimited,
+         [](const Points& points) { return spatial_index::KdTree2D(points).Size(); }},
+        {"kd_tree_parallel", kUnlimited,
+         [&thread_pool](const Points& points) { return spatial_index::KdTree2D(points, thread_pool).Size(); }},
+        {"kd_tree_nearest", kUnlimited,
+         [](const Points& points) {
+             // The build and one query per point, dominated by the queries.
+             return CountNearest(spatial_index::KdTree2D(points), points);
+         }},
+        {"kd_tree_nearest_batch", kUnlimited,
+         [&thread_pool](const Points& points) {
+             return CountNearest(spatial_index::KdTree2D(points, thread_pool), points, thread_pool);
+         }},
+        {"r_tree", kUnlimited,
+         [](const Points& points) { return spatial_index::PackedRTree2D(points).Size(); }},
+        {"r_tree_parallel", kUnlimited,
+         [&thread_pool](const Points& points) {
+             return spatial_index::PackedRTree2D(points, thread_pool).Size();
+         }},
+        {"r_tree_nearest", kUnlimited,
+         [](const Points& points) { return CountNearest(spatial_index::PackedRTree2D(points), points); }},
+        {"r_tree_nearest_batch", kUnlimited,
+         [&thread_pool](const Points& points) {
+             return CountNearest(spatial_index::PackedRTree2D(points, thread_pool), points, thread_pool);
+         }},
+        {"is_turn_left", kUnlimited,
+         [](const Points& points) {
+             return CountTriples(points, [](const Point2D& p, const Point2D& q, const Point2D& r) {
+                 return util::IsTurnLeft(p, q, r);
+             });
+         }},
+        {"are_points_collinear", kUnlimited,
+         [](const Points& points) {
+             return CountTriples(points, [](const Point2D& p, const Point2D& q, const Point2D& r) {
+                 return util::ArePointsCollinear(p, q, r);
+             });
+         }},
+        {"is_point_on_segment", kUnlimited,
+         [](const Points& points) {
+             return CountTriples(points, [](const Point2D& p, const Point2D& q, const Point2D& r) {
+                 return util::IsPointOnSegment(p, q, r);
+             });
+         }},
+        {"is_point_in_triangle", kUnlimited,
+         [](const Points& points) {
+             return CountTriples(points, [&points](const Point2D& p, const Point2D& q, const Point2D& r) {
+                 return util::IsPointInTriangle(points[0], p, q, r);
+             });
+         }},
+        {"orient_2d", kUnlimited,
+         [](const Points& points) {
+             return CountTriples(points, [](const Point2D& p, const Point2D& q, const Point2D& r) {
+                 return util::Orient2D(p, q, r) > 0.0;
+             });
+         }},
+        {"is_turn_left_batch", kUnlimited,
+         [](const Points& points) {
+             // Includes the conversion to the structure-of-arrays layout.
+             euclid::geometry::PointSet2D point_set(points);
+             std::vector<uint64_t> mask(util::GetNumMaskWords(points.size()));
+             util::IsTurnLeft(points[0], points[points.size() / 2], point_set, mask.data());
+             size_t count = 0;
+             for (auto word : mask) {
+                 count += static_cast<size_t>(std::popcount(word));
+             }
+             return count;
+         }},
+        {"is_point_in_closed_triangle_batch", kUnlimited,
+         [](const Points& points) {
+             euclid::geometry::PointSet2D point_set(points);
+             std::vector<uint64_t> mask(util::GetNumMaskWords(points.size()));
+             const euclid::geometry::Triangle2D triangle{{points[0], points[points.size() / 3], points.back()}};
+             util::IsPointInClosedTriangle(point_set, triangle, mask.data());
+             size_t count = 0;
+             for (auto word : mask) {
+                 count += static_cast<size_t>(std::popcount(word));
+             }
+             return count;
+         }},
+        {"triangle_grid_locate", kUnlimited,
+         [triangle_grid](const Points& points) {
+             size_t count = 0;
+             for (const auto& point : points) {
+                 count += triangle_grid->Locate(point) != spatial_index::kNoTriangle ? 1 : 0;
+             }
+             return count;
+         }},
+        {"triangle_grid_locate_batch", kUnlimited,
+         [triangle_grid, &thread_pool](const Points& points) {
+             std::vector<size_t> triangles;
+             triangle_grid->Locate(points, triangles, thread_pool);
+             return static_cast<size_t>(std::count_if(triangles.begin(), triangles.end(), [](size_t triangle) {
+                 return triangle != spatial_index::kNoTriangle;
+             }));
+         }},
+        {"contains_fan", 100000,
+         [polygon](const Points& points) { return CountInFan(polygon->Vertices(), points); }},
+        {"contains", kUnlimited,
+         [polygon](const Points& points) {
+             size_t count = 0;
+             for (const auto& point : points) {
+                 count += polygon->Contains(point) ? 1 : 0;
+             }
+             return count;
+         }},
+        {"contains_batch", kUnlimited,
+         [polygon](const Points& points) {
+             std::vector<uint64_t> mask(util::GetNumMaskWords(points.size()));
+             polygon->Contains(points, mask.data());
+             size_t count = 0;
+             for (auto word : mask) {
+                 count += static_cast<size_t>(std::popcount(word));
+             }
+             return count;
+         }},
+    };
+}
+
+void PrintUsage(const char* program) {
+    std::fprintf(stderr,
+                 "usage: %s [--min-size N] [--max-size N] [--filter TEXT] [--min-time SECONDS] [--seed N] "
+                 "[--threads N] [--output FILE]\n"
+                 "  Runs every benchmark on every generator for the sizes 10, 100, ... up to --max-size (default "
+                 "1000000, at most 100000000)\n"
+                 "  and writes JSON results. --filter keeps the runs whose \"benchmark/generator\" contains TEXT.\n",
+                 program);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t min_size = 10;
+    size_t max_size = 1000000;
+    std::string filter;
+    double min_seconds = 0.1;
+    uint64_t seed = 1;
+    size_t num_threads = 0;
+    const char* output_path = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        auto HasValue = [&]() { return i + 1 < argc; };
+        if (std::strcmp(argv[i], "--min-size") == 0 && HasValue()) {
+            min_size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--max-size") == 0 && HasValue()) {
+            max_size = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--filter") == 0 && HasValue()) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && HasValue()) {
+            min_seconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && HasValue()) {
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && HasValue()) {
+            num_threads = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--output") == 0 && HasValue()) {
+            output_path = argv[++i];
+        } else {
+            PrintUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : 1;
+        }
+    }
+
+    euclid::util::ThreadPool thread_pool(num_threads);
+    const auto benchmarks = GetBenchmarks(thread_pool);
+    const auto generators = euclid::bench::GetGenerators();
+    std::vector<euclid::bench::Result> results;
+    for (size_t size = 10; size <= max_size && size <= 100000000; size *= 10) {
+        if (size < min_size) {
+            continue;
+        }
+        for (const auto& generator : generators) {
+            const auto points = generator.generate(size, seed);
+            for (const auto& benchmark : benchmarks) {
+                if (size > benchmark.max_size) {
+                    continue;
+                }
+                if (!benchmark.generator.empty() && benchmark.generator != generator.name) {
+                    continue;
+                }
+                if (!filter.empty() && (benchmark.name + "/" + generator.name).find(filter) == std::string::npos) {
+                    continue;
+                }
+                std::fprintf(stderr, "%s/%s/%zu\n", benchmark.name.c_str(), generator.name.c_str(), size);
+                results.push_back(euclid::bench::Measure(benchmark, generator.name, points, min_seconds));
+            }
+        }
+    }
+
+    std::FILE* output = output_path == nullptr ? stdout : std::fopen(output_path, "w");
+    if (output == nullptr) {
+        std::fprintf(stderr, "cannot open %s\n", output_path);
+        return 1;
+    }
+    euclid::bench::WriteJson(output,
+                             {
+                                 {"seed", std::to_string(seed)},
+                                 {"min_time_seconds", std::to_string(min_seconds)},
+                                 {"threads", std::to_string(thread_pool.NumThreads())},
+                                 {"hardware_threads", std::to_string(std::thread::hardware_concurrency())},
+#if defined(__VERSION__)
+                                 {"compiler", __VERSION__},
+#endif
+                             },
+                             results);
+    if (output != stdout) {
+        std::fclose(output);
+    }
+    return 0;
+}
@@ -0,0 +1,474 @@
+#pragma once
+
+/**
+ * @file approximate.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_hull/parallel.h"
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+#include "util/simd.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief The number of points per block of the approximate hulls, 256 KiB of double points, so that the passes over a
+ * block after the first one read it from the cache.
+ */
+inline constexpr size_t kApproximateHullBlockPoints = 1 << 14;
+
+/**
+ * @brief A convex hull of a subset of the points, within a known distance of the exact hull.
+ */
+template <typename T>
+struct BasicApproximateConvexHull2D {
+    // The hull vertices in counter-clockwise order, starting from the lowest then leftest point, empty when the hull
+    // has fewer than 3 vertices.
+    std::vector<geometry::BasicPoint2D<T>> points;
+    // An upper bound of the Hausdorff distance between this hull and the exact one, which contains it. Every point lies
+    // within this distance of the approximate hull, up to the rounding of its evaluation.
+    double error_bound = 0.0;
+};
+
+using ApproximateConvexHull2D = BasicApproximateConvexHull2D<double>;
+
+/**
+ * @brief Finds the first point maximizing the dot product with a direction, vectorized for double coordinates.
+ *
+ * The point farthest to the right of the directed line from the origin to (-dy, dx) is the point farthest along
+ * (dx, dy), so FindFarthestRightIndex serves as the kernel.
+ */
+template <typename T>
+inline size_t FindFarthestIndexAlong(const geometry::BasicPoint2D<T>* points, size_t size, double dx, double dy) {
+    if constexpr (std::is_same_v<T, double>) {
+        return FindFarthestRightIndex(points, size, geometry::Point2D{0.0, 0.0}, geometry::Point2D{-dy, dx});
+    } else {
+        size_t best_index = 0;
+        double best_value = -std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < size; ++i) {
+            const double value = dx * static_cast<double>(points[i].coords[0]) +
+                                 dy * static_cast<double>(points[i].coords[1]);
+            if (value > best_value) {
+                best_value = value;
+                best_index = i;
+            }
+        }
+        return best_index;
+    }
+}
+
+/**
+ * @brief Collects the points not strictly left of all edges a * x + b * y > c, without vectorization.
+ *
+ * @param points The points.
+ * @param first The first point to test.
+ * @param size The number of points.
+ * @param a, b, c The kNumOctagonDirections edges.
+ * @param indices Receives the indices of the points collected, has room for size - first.
+ * @return The number of points collected.
+ */
+template <typename T>
+EUCLID_NO_FP_CONTRACT inline size_t FindIndicesOutsideOctagonScalar(const geometry::BasicPoint2D<T>* points,
+                                                                    size_t first, size_t size, const double* a,
+                                                                    const double* b, const double* c,
+                                                                    size_t* indices) {
+    size_t num_indices = 0;
+    for (size_t i = first; i < size; ++i) {
+        const double x = static_cast<double>(points[i].coords[0]);
+        const double y = static_cast<double>(points[i].coords[1]);
+        bool is_inside = true;
+        for (size_t k = 0; k < kNumOctagonDirections; ++k) {
+            is_inside &= a[k] * x + b[k] * y > c[k];
+        }
+        if (!is_inside) {
+            indices[num_indices++] = i;
+        }
+    }
+    return num_indices;
+}
+
+#if defined(EUCLID_X86_64)
+
+/**
+ * @brief AVX2 version of FindIndicesOutsideOctagonScalar, four points per iteration.
+ */
+EUCLID_TARGET_AVX2 EUCLID_NO_FP_CONTRACT inline size_t FindIndicesOutsideOctagonAvx2(const geometry::Point2D* points,
+                                                                                     size_t size, const double* a,
+                                                                                     const double* b, const double* c,
+                                                                                     size_t* indices) {
+    const double* data = points[0].coords;
+    __m256d a_vectors[kNumOctagonDirections];
+    __m256d b_vectors[kNumOctagonDirections];
+    __m256d c_vectors[kNumOctagonDirections];
+    for (size_t k = 0; k < kNumOctagonDirections; ++k) {
+        a_vectors[k] = _mm256_set1_pd(a[k]);
+        b_vectors[k] = _mm256_set1_pd(b[k]);
+        c_vectors[k] = _mm256_set1_pd(c[k]);
+    }
+    // Lanes hold the points with index = 0, 2, 1, 3 (mod 4), the order produced by unpacking two loads.
+    constexpr size_t kLaneOffsets[4] = {0, 2, 1, 3};
+    size_t num_indices = 0;
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256d first_points = _mm256_loadu_pd(data + 2 * i);
+        __m256d second_points = _mm256_loadu_pd(data + 2 * i + 4);
+        __m256d x = _mm256_unpacklo_pd(first_points, second_points);
+        __m256d y = _mm256_unpackhi_pd(first_points, second_points);
+        __m256d is_inside = _mm256_cmp_pd(
+            _mm256_add_pd(_mm256_mul_pd(a_vectors[0], x), _mm256_mul_pd(b_vectors[0], y)), c_vectors[0], _CMP_GT_OQ);
+        for (size_t k = 1; k < kNumOctagonDirections; ++k) {
+            is_inside = _mm256_and_pd(
+                is_inside, _mm256_cmp_pd(_mm256_add_pd(_mm256_mul_pd(a_vectors[k], x), _mm256_mul_pd(b_vectors[k], y)),
+                                         c_vectors[k], _CMP_GT_OQ));
+        }
+        // Most points lie inside, the others are appended in index order.
+        const int outside_mask = ~_mm256_movemask_pd(is_inside) & 0xF;
+        if (outside_mask != 0) {
+            for (size_t offset : {0, 1, 2, 3}) {
+                const size_t lane = kLaneOffsets[offset];
+                if ((outside_mask >> lane) & 1) {
+                    indices[num_indices++] = i + offset;
+                }
+            }
+        }
+    }
+    return num_indices + FindIndicesOutsideOctagonScalar(points, i, size, a, b, c, indices + num_indices);
+}
+
+#endif
+
+/**
+ * @brief Collects the points not strictly left of all edges a * x + b * y > c, see FindIndicesOutsideOctagonScalar.
+ *
+ * Dispatches to the AVX2 kernel according to util::GetSimdLevel for double coordinates, other coordinate types use the
+ * scalar kernel.
+ */
+template <typename T>
+inline size_t FindIndicesOutsideOctagon(const geometry::BasicPoint2D<T>* points, size_t size, const double* a,
+                                        const double* b, const double* c, size_t* indices) {
+#if defined(EUCLID_X86_64)
+    if constexpr (std::is_same_v<T, double>) {
+        if (euclid::util::GetSimdLevel() >= euclid::util::SimdLevel::kAvx2) {
+            return FindIndicesOutsideOctagonAvx2(points, size, a, b, c, indices);
+        }
+    }
+#endif
+    return FindIndicesOutsideOctagonScalar(points, 0, size, a, b, c, indices);
+}
+
+/**
+ * @brief Keeps the points not strictly inside the octagon of their extreme points in the axis and diagonal directions,
+ * which contain every extreme point in any direction.
+ *
+ * The octagon is found and the points are tested against its edges with vectorized kernels. The test rounds like
+ * util::GetCrossValue up to the order of the operations, so a point dropped lies inside the octagon or within rounding
+ * of its boundary. The vertices of the octagon are always kept.
+ *
+ * @param points The points, at least one.
+ * @param candidates Receives the points kept, in their order.
+ * @param indices Receives the indices of the points kept.
+ */
+template <typename T>
+EUCLID_NO_FP_CONTRACT void FilterByOctagon(std::span<const geometry::BasicPoint2D<T>> points,
+                                           std::vector<geometry::BasicPoint2D<T>>& candidates,
+                                           std::vector<size_t>& indices) {
+    size_t extreme_indices[kNumOctagonDirections];
+    FindOctagonExtremeIndices(points.data(), points.size(), extreme_indices);
+    // The edges p -> q as a * x + b * y > c for the points strictly left of them, padded with edges every point is left
+    // of, so that the test unrolls.
+    double a[kNumOctagonDirections] = {};
+    double b[kNumOctagonDirections] = {};
+    double c[kNumOctagonDirections];
+    std::fill(c, c + kNumOctagonDirections, -1.0);
+    size_t num_edges = 0;
+    for (size_t i = 0; i < kNumOctagonDirections; ++i) {
+        const auto& p = points[extreme_indices[i]];
+        const auto& q = points[extreme_indices[(i + 1) % kNumOctagonDirections]];
+        if (p.coords[0] == q.coords[0] && p.coords[1] == q.coords[1]) {
+            continue;
+        }
+        const double p_x = static_cast<double>(p.coords[0]);
+        const double p_y = static_cast<double>(p.coords[1]);
+        a[num_edges] = p_y - static_cast<double>(q.coords[1]);
+        b[num_edges] = static_cast<double>(q.coords[0]) - p_x;
+        c[num_edges] = a[num_edges] * p_x + b[num_edges] * p_y;
+        num_edges++;
+    }
+    indices.resize(points.size());
+    if (num_edges < 3) {
+        // Fewer than 3 distinct vertices enclose nothing.
+        for (size_t i = 0; i < points.size(); ++i) {
+            indices[i] = i;
+        }
+    } else {
+        size_t num_indices = FindIndicesOutsideOctagon(points.data(), points.size(), a, b, c, indices.data());
+        // The vertices test as on their edges only if the edge constants round like the kernels, so the ones dropped
+        // are merged back, from the back into the room left at the end.
+        std::sort(extreme_indices, extreme_indices + kNumOctagonDirections);
+        size_t missing_indices[kNumOctagonDirections];
+        size_t num_missing = 0;
+        for (size_t i = 0; i < kNumOctagonDirections; ++i) {
+            const size_t index = extreme_indices[i];
+            if ((num_missing == 0 || missing_indices[num_missing - 1] != index) &&
+                !std::binary_search(indices.begin(), indices.begin() + num_indices, index)) {
+                missing_indices[num_missing++] = index;
+            }
+        }
+        const size_t num_kept = num_indices + num_missing;
+        for (size_t k = num_kept; num_missing > 0; --k) {
+            if (num_indices > 0 && indices[num_indices - 1] > missing_indices[num_missing - 1]) {
+                indices[k - 1] = indices[--num_indices];
+            } else {
+                indices[k - 1] = missing_indices[--num_missing];
+            }
+        }
+        indices.resize(num_kept);
+    }
+    candidates.resize(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        candidates[i] = points[indices[i]];
+    }
+}
+
+/**
+ * @brief Computes an approximate convex hull from the extreme points in num_directions uniformly spaced directions.
+ *
+ * The input is scanned in blocks of kApproximateHullBlockPoints points on the thread pool. Every block is reduced to
+ * the points outside the octagon of its extreme points, see FilterByOctagon, which are then scanned once per direction
+ * with the vectorized kernel of Quickhull, from the cache. The extreme points of the blocks are reduced per direction,
+ * and the exact hull of the at most num_directions extreme points is the result.
+ *
+ * Between the extreme points e and f of two neighbouring directions, at an angle of d = 2 pi / num_directions, the
+ * exact hull lies in the triangle bounded by the segment ef and the supporting lines at e and f, whose apex is at most
+ * |ef| / 2 * tan(d / 2) from ef. The largest of these heights is the reported error bound, at most the diameter times
+ * tan(pi / num_directions) / 2.
+ *
+ * Ties and the choice of extreme points do not depend on the number of threads.
+ *
+ * @tparam Predicates The predicate policy of the final hull, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points.
+ * @param num_directions The number of directions, at least 3, fewer are raised to 3. The hull has at most this many
+ * vertices.
+ * @param thread_pool The threads to run on.
+ * @return The approximate hull and its error bound.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+BasicApproximateConvexHull2D<T> GetApproximateConvexHullByDirections(
+    std::span<const geometry::BasicPoint2D<T>> input_points, size_t num_directions,
+    euclid::util::ThreadPool& thread_pool) {
+    euclid::util::ScopedHullCall call("approximate_directions");
+    BasicApproximateConvexHull2D<T> convex_hull;
+    const size_t size = input_points.size();
+    if (size == 0) {
+        return convex_hull;
+    }
+    num_directions = std::max<size_t>(num_directions, 3);
+    std::vector<double> cosines(num_directions);
+    std::vector<double> sines(num_directions);
+    for (size_t j = 0; j < num_directions; ++j) {
+        const double angle = 2.0 * std::numbers::pi * static_cast<double>(j) / static_cast<double>(num_directions);
+        cosines[j] = std::cos(angle);
+        sines[j] = std::sin(angle);
+    }
+    auto Dot = [&](size_t direction, size_t index) {
+        return cosines[direction] * static_cast<double>(input_points[index].coords[0]) +
+               sines[direction] * static_cast<double>(input_points[index].coords[1]);
+    };
+
+    // The extreme point of every block in every direction, then reduced in block order, so that ties go to the first.
+    const size_t num_blocks = (size + kApproximateHullBlockPoints - 1) / kApproximateHullBlockPoints;
+    std::vector<size_t> block_extremes(num_blocks * num_directions);
+    struct alignas(64) ThreadCandidates {
+        std::vector<geometry::BasicPoint2D<T>> points;
+        std::vector<size_t> indices;
+    };
+    std::vector<ThreadCandidates> thread_candidates(thread_pool.NumThreads());
+    thread_pool.ParallelFor(num_blocks, [&](size_t block, size_t thread) {
+        const size_t first = block * kApproximateHullBlockPoints;
+        const size_t block_size = std::min(size, first + kApproximateHullBlockPoints) - first;
+        auto& candidates = thread_candidates[thread];
+        FilterByOctagon(input_points.subspan(first, block_size), candidates.points, candidates.indices);
+        for (size_t j = 0; j < num_directions; ++j) {
+            const size_t candidate =
+                FindFarthestIndexAlong(candidates.points.data(), candidates.points.size(), cosines[j], sines[j]);
+            block_extremes[block * num_directions + j] = first + candidates.indices[candidate];
+        }
+    });
+    std::vector<size_t> extremes(block_extremes.begin(), block_extremes.begin() + num_directions);
+    for (size_t block = 1; block < num_blocks; ++block) {
+        for (size_t j = 0; j < num_directions; ++j) {
+            const size_t candidate = block_extremes[block * num_directions + j];
+            if (Dot(j, candidate) > Dot(j, extremes[j])) {
+                extremes[j] = candidate;
+            }
+        }
+    }
+
+    const double half_tangent = std::tan(std::numbers::pi / static_cast<double>(num_directions)) / 2.0;
+    std::vector<geometry::BasicPoint2D<T>> extreme_points;
+    for (size_t j = 0; j < num_directions; ++j) {
+        const auto& point = input_points[extremes[j]];
+        const auto& next = input_points[extremes[(j + 1) % num_directions]];
+        convex_hull.error_bound = std::max(convex_hull.error_bound, point.Distance(next) * half_tangent);
+        extreme_points.push_back(point);
+    }
+    convex_hull.points = GetConvexHullByMonotoneChain<Predicates>(extreme_points);
+    return convex_hull;
+}
+
+/**
+ * @brief Computes an approximate convex hull from the extreme points in num_directions uniformly spaced directions.
+ *
+ * @tparam Predicates The predicate policy of the final hull, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points.
+ * @param num_directions The number of directions, at least 3.
+ * @param thread_pool The threads to run on.
+ * @return The approximate hull and its error bound.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+BasicApproximateConvexHull2D<T> GetApproximateConvexHullByDirections(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points, size_t num_directions,
+    euclid::util::ThreadPool& thread_pool) {
+    return GetApproximateConvexHullByDirections<Predicates>(std::span<const geometry::BasicPoint2D<T>>(input_points),
+                                                            num_directions, thread_pool);
+}
+
+/**
+ * @brief Computes an approximate convex hull from the lowest and the highest point of every column of a grid, after
+ * J. L. Bentley, F. P. Preparata and M. G. Faust, "Approximation Algorithms for Convex Hulls" (1982).
+ *
+ * The x-range of the points is cut into columns no wider than tolerance. A first pass over blocks of
+ * kApproximateHullBlockPoints points finds the x-range, a second one keeps the lowest and the highest point of every
+ * column, per thread range, and the exact hull of the at most two points per column is the result. A point dropped
+ * from a column lies between the heights of the two points kept, so its horizontal distance to the segment joining
+ * them, and so to the hull, is below the column width, which is the reported error bound.
+ *
+ * When the columns would not be fewer than the points, the exact hull is computed instead, with an error bound of 0.
+ *
+ * @tparam Predicates The predicate policy of the final hull, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points.
+ * @param tolerance The largest acceptable error, the width of the columns.
+ * @param thread_pool The threads to run on.
+ * @return The approximate hull and its error bound.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+BasicApproximateConvexHull2D<T> GetApproximateConvexHullByGrid(std::span<const geometry::BasicPoint2D<T>> input_points,
+                                                               double tolerance,
+                                                               euclid::util::ThreadPool& thread_pool) {
+    euclid::util::ScopedHullCall call("approximate_grid");
+    BasicApproximateConvexHull2D<T> convex_hull;
+    const size_t size = input_points.size();
+    if (size == 0) {
+        return convex_hull;
+    }
+
+    const size_t num_blocks = (size + kApproximateHullBlockPoints - 1) / kApproximateHullBlockPoints;
+    std::vector<double> block_min_x(num_blocks);
+    std::vector<double> block_max_x(num_blocks);
+    thread_pool.ParallelFor(num_blocks, [&](size_t block, size_t) {
+        const size_t first = block * kApproximateHullBlockPoints;
+        const size_t block_size = std::min(size, first + kApproximateHullBlockPoints) - first;
+        double block_min = static_cast<double>(input_points[first].coords[0]);
+        double block_max = block_min;
+        for (size_t i = first + 1; i < first + block_size; ++i) {
+            const double x = static_cast<double>(input_points[i].coords[0]);
+            block_min = x < block_min ? x : block_min;
+            block_max = x > block_max ? x : block_max;
+        }
+        block_min_x[block] = block_min;
+        block_max_x[block] = block_max;
+    });
+    const double min_x = *std::min_element(block_min_x.begin(), block_min_x.end());
+    const double max_x = *std::max_element(block_max_x.begin(), block_max_x.end());
+    const double num_columns_needed = std::ceil((max_x - min_x) / tolerance);
+    if (!(tolerance > 0.0) || !(num_columns_needed < static_cast<double>(size))) {
+        convex_hull.points = GetConvexHullInParallel<Predicates>(input_points, thread_pool);
+        return convex_hull;
+    }
+    const size_t num_columns = std::max<size_t>(1, static_cast<size_t>(num_columns_needed));
+    const double width = (max_x - min_x) / static_cast<double>(num_columns);
+    const double inverse_width = width > 0.0 ? 1.0 / width : 0.0;
+
+    // The lowest and the highest point of every column in every range, compared like the exact hulls sort. The columns
+    // hold copies of the points, as the points they stand for may lie anywhere in the input.
+    struct Column {
+        geometry::BasicPoint2D<T> lowest;
+        geometry::BasicPoint2D<T> highest;
+        bool is_empty = true;
+    };
+    auto Keep = [](Column& column, const geometry::BasicPoint2D<T>& point) {
+        if (column.is_empty) {
+            column.lowest = column.highest = point;
+            column.is_empty = false;
+        } else if (util::IsLowerThenLefter(point, column.lowest)) {
+            column.lowest = point;
+        } else if (util::IsLowerThenLefter(column.highest, point)) {
+            column.highest = point;
+        }
+    };
+    const size_t num_ranges = thread_pool.NumThreads();
+    std::vector<Column> columns(num_ranges * num_columns);
+    thread_pool.ParallelFor(num_ranges, [&](size_t range, size_t) {
+        Column* range_columns = columns.data() + range * num_columns;
+        const size_t last = size * (range + 1) / num_ranges;
+        for (size_t i = size * range / num_ranges; i < last; ++i) {
+            const double offset = (static_cast<double>(input_points[i].coords[0]) - min_x) * inverse_width;
+            Keep(range_columns[std::min(num_columns - 1, static_cast<size_t>(offset))], input_points[i]);
+        }
+    });
+    std::vector<geometry::BasicPoint2D<T>> kept_points;
+    for (size_t i = 0; i < num_columns; ++i) {
+        auto& column = columns[i];
+        for (size_t range = 1; range < num_ranges; ++range) {
+            const auto& range_column = columns[range * num_columns + i];
+            if (!range_column.is_empty) {
+                Keep(column, range_column.lowest);
+                Keep(column, range_column.highest);
+            }
+        }
+        if (!column.is_empty) {
+            kept_points.push_back(column.lowest);
+            if (util::IsLowerThenLefter(column.lowest, column.highest)) {
+                kept_points.push_back(column.highest);
+            }
+        }
+    }
+    convex_hull.points = GetConvexHullByMonotoneChain<Predicates>(kept_points);
+    convex_hull.error_bound = width;
+    return convex_hull;
+}
+
+/**
+ * @brief Computes an approximate convex hull from the lowest and the highest point of every column of a grid.
+ *
+ * @tparam Predicates The predicate policy of the final hull, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points.
+ * @param tolerance The largest acceptable error, the width of the columns.
+ * @param thread_pool The threads to run on.
+ * @return The approximate hull and its error bound.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+BasicApproximateConvexHull2D<T> GetApproximateConvexHullByGrid(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points, double tolerance,
+    euclid::util::ThreadPool& thread_pool) {
+    return GetApproximateConvexHullByGrid<Predicates>(std::span<const geometry::BasicPoint2D<T>>(input_points),
+                                                      tolerance, thread_pool);
+}
+
+}  // namespace euclid::algorithm::convex_hull
@@ -0,0 +1,152 @@
+#pragma once
+
+/**
+ * @file batch.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief The number of points the batch hull hands to a thread at a time, large enough to amortize the stealing.
+ */
+inline constexpr size_t kBatchChunkPoints = 1 << 14;
+
+/**
+ * @brief The group size from which the batch hull switches from the monotone chain to Quickhull, whose octagon filter
+ * discards most points before any sorting happens.
+ */
+inline constexpr size_t kBatchQuickHullMinSize = 20;
+
+/**
+ * @brief Computes the convex hull of a single group for the batch hull, without allocating for small groups.
+ *
+ * Groups of at most util::kMaxSortingNetworkSize points are sorted by a sorting network on the stack and groups below
+ * kBatchQuickHullMinSize by std::sort in the workspace, then both run the chains of the monotone chain algorithm.
+ * Larger groups run Quickhull.
+ *
+ * @return The number of hull vertices written to convex_hull_points, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates, typename T>
+size_t GetConvexHullOfGroup(std::span<const geometry::BasicPoint2D<T>> group_points,
+                            geometry::BasicPoint2D<T>* convex_hull_points, BasicHullWorkspace<T>& workspace) {
+    const size_t size = group_points.size();
+    if (size <= util::kMaxSortingNetworkSize) {
+        geometry::BasicPoint2D<T> buffer[2 * util::kMaxSortingNetworkSize];
+        std::copy(group_points.begin(), group_points.end(), buffer);
+        util::SortBySortingNetwork(buffer, size, util::IsLowerThenLefter<T>);
+        const size_t hull_size = GetConvexHullByMonotoneChainOfSorted<Predicates>(buffer, size);
+        std::copy(buffer, buffer + hull_size, convex_hull_points);
+        return hull_size;
+    }
+    if (size < kBatchQuickHullMinSize) {
+        auto& buffer = workspace.Points();
+        buffer.resize(2 * size);
+        std::copy(group_points.begin(), group_points.end(), buffer.begin());
+        const size_t hull_size = GetConvexHullByMonotoneChainInPlace<Predicates>(buffer.data(), size);
+        std::copy(buffer.begin(), buffer.begin() + hull_size, convex_hull_points);
+        return hull_size;
+    }
+    workspace.Points().resize(size);
+    workspace.HullPoints().resize(size + kNumOctagonDirections);
+    const size_t hull_size = GetConvexHullByQuickHullWithBuffers<Predicates>(group_points, workspace.Points().data(),
+                                                                             workspace.HullPoints().data());
+    std::copy(workspace.HullPoints().begin(), workspace.HullPoints().begin() + hull_size, convex_hull_points);
+    return hull_size;
+}
+
+/**
+ * @brief Computes the convex hulls of many independent point groups in parallel.
+ *
+ * The groups are given in compressed sparse row layout: group i consists of points[offsets[i]] up to, not including,
+ * points[offsets[i + 1]]. Consecutive groups are bundled into chunks of about kBatchChunkPoints points, which the
+ * threads of the pool take and steal from each other, every thread with its own workspace. The algorithm depends on the
+ * size of the group, see GetConvexHullOfGroup.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param points The points of all groups.
+ * @param offsets The first point of every group followed by the end of the last group, non-decreasing and at most
+ * points.size(). Empty or a single entry for no groups.
+ * @param convex_hull_points Receives the hull vertices of all groups back to back, every hull in counter-clockwise
+ * order starting from its lowest then leftest point. A group whose hull has fewer than 3 vertices gets an empty hull.
+ * @param convex_hull_offsets Receives the offsets of the hulls in convex_hull_points in the same layout, i.e.
+ * offsets.size() entries starting with 0.
+ * @param thread_pool The threads to run on.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename PointAllocator,
+          typename OffsetAllocator>
+void GetConvexHulls(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> points,
+                    std::span<const size_t> offsets,
+                    std::vector<geometry::BasicPoint2D<T>, PointAllocator>& convex_hull_points,
+                    std::vector<size_t, OffsetAllocator>& convex_hull_offsets, euclid::util::ThreadPool& thread_pool) {
+    euclid::util::ScopedHullCall call("batch");
+    if (offsets.size() < 2) {
+        convex_hull_points.clear();
+        convex_hull_offsets.assign(offsets.size(), 0);
+        return;
+    }
+    const size_t num_groups = offsets.size() - 1;
+    const size_t base = offsets[0];
+    const size_t num_points = offsets[num_groups] - base;
+
+    // Every hull is written where its group starts, it never has more vertices than the group has points.
+    convex_hull_points.resize(num_points);
+    convex_hull_offsets.resize(num_groups + 1);
+    convex_hull_offsets[0] = 0;
+
+    // At least 4 chunks per thread, so that stealing can even out groups of different sizes.
+    size_t groups_per_chunk = std::max<size_t>(1, num_groups * kBatchChunkPoints / std::max<size_t>(1, num_points));
+    groups_per_chunk = std::min(groups_per_chunk, (num_groups + 4 * thread_pool.NumThreads() - 1) /
+                                                      (4 * thread_pool.NumThreads()));
+    groups_per_chunk = std::max<size_t>(1, groups_per_chunk);
+    const size_t num_chunks = (num_groups + groups_per_chunk - 1) / groups_per_chunk;
+
+    // Padded so that the buffer sizes of different threads do not share a cache line.
+    struct alignas(64) ThreadWorkspace {
+        BasicHullWorkspace<T> workspace;
+    };
+    std::vector<ThreadWorkspace> workspaces(thread_pool.NumThreads());
+    thread_pool.ParallelFor(num_chunks, [&](size_t chunk, size_t thread) {
+        const size_t first_group = chunk * groups_per_chunk;
+        const size_t last_group = std::min(first_group + groups_per_chunk, num_groups);
+        for (size_t group = first_group; group < last_group; ++group) {
+            std::span<const geometry::BasicPoint2D<T>> group_points(points.data() + offsets[group],
+                                                                    offsets[group + 1] - offsets[group]);
+            // The hull size is stored in place of the offset until all hulls are known.
+            convex_hull_offsets[group + 1] = GetConvexHullOfGroup<Predicates>(
+                group_points, convex_hull_points.data() + (offsets[group] - base), workspaces[thread].workspace);
+        }
+    });
+
+    // Moves the hulls together, each one to the left of or exactly where it was written.
+    size_t num_hull_points = 0;
+    for (size_t group = 0; group < num_groups; ++group) {
+        const size_t hull_size = convex_hull_offsets[group + 1];
+        const size_t source = offsets[group] - base;
+        if (source != num_hull_points) {
+            std::copy(convex_hull_points.begin() + source, convex_hull_points.begin() + source + hull_size,
+                      convex_hull_points.begin() + num_hull_points);
+        }
+        num_hull_points += hull_size;
+        convex_hull_offsets[group + 1] = num_hull_points;
+    }
+    convex_hull_points.resize(num_hull_points);
+}
+
+}  // namespace euclid::algorithm::convex_hull
@@ -0,0 +1,389 @@
+#pragma once
+
+/**
+ * @file chan.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+
+namespace euclid::algorithm::convex_hull {
+
+namespace detail {
+
+/**
+ * @brief Classifies the turn p -> q -> r.
+ *
+ * @return 1 for a left turn, 0 if the points are collinear and -1 for a right turn.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+int GetTurn(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+            const geometry::BasicPoint2D<T>& r) {
+    return Predicates::GetOrientation(p, q, r);
+}
+
+/**
+ * @brief Finds the vertex of a counter-clockwise convex polygon such that no vertex lies right of the ray from point
+ * through it, i.e. the next vertex a counter-clockwise gift wrapping around point would pick from this polygon.
+ *
+ * Uses a binary search over the polygon, falling back to a linear scan if the search lands on a vertex that is not a
+ * tangent point (degenerate polygons). Among collinear candidates the one farthest from point is returned.
+ *
+ * @param convex_polygon The polygon vertices in counter-clockwise order.
+ * @param point The point outside of (or on a vertex of) the polygon.
+ * @return The index of the tangent vertex.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetTangentIndex(std::span<const geometry::BasicPoint2D<T>> convex_polygon,
+                       const geometry::BasicPoint2D<T>& point) {
+    const size_t size = convex_polygon.size();
+    auto Vertex = [&convex_polygon, size](size_t index) -> const geometry::BasicPoint2D<T>& {
+        return convex_polygon[index % size];
+    };
+    auto IsTangent = [&](size_t index) {
+        return GetTurn<Predicates>(point, Vertex(index), Vertex(index + size - 1)) != -1 &&
+               GetTurn<Predicates>(point, Vertex(index), Vertex(index + 1)) != -1;
+    };
+    auto SquaredDistance = [&point](const geometry::BasicPoint2D<T>& other) {
+        return util::GetDotValue(point, other, other);
+    };
+    // Prefers the farther of two vertices on the same ray from point.
+    auto Farther = [&](size_t index, size_t other) {
+        if (GetTurn<Predicates>(point, Vertex(index), Vertex(other)) == 0 &&
+            SquaredDistance(Vertex(other)) > SquaredDistance(Vertex(index))) {
+            return other % size;
+        }
+        return index % size;
+    };
+
+    if (size <= 3) {
+        size_t best = 0;
+        for (size_t i = 1; i < size; ++i) {
+            auto turn = GetTurn<Predicates>(point, convex_polygon[best], convex_polygon[i]);
+            if (turn == -1 ||
+                (turn == 0 && SquaredDistance(convex_polygon[i]) > SquaredDistance(convex_polygon[best]))) {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    size_t left = 0;
+    size_t right = size;
+    int left_before = GetTurn<Predicates>(point, Vertex(left), Vertex(left + size - 1));
+    int left_after = GetTurn<Predicates>(point, Vertex(left), Vertex(left + 1));
+    while (left < right) {
+        size_t middle = (left + right) / 2;
+        int middle_before = GetTurn<Predicates>(point, Vertex(middle), Vertex(middle + size - 1));
+        int middle_after = GetTurn<Predicates>(point, Vertex(middle), Vertex(middle + 1));
+        if (middle_before != -1 && middle_after != -1) {
+            return Farther(Farther(middle, middle + 1), middle + size - 1);
+        }
+        int middle_side = GetTurn<Predicates>(point, Vertex(left), Vertex(middle));
+        if ((middle_side == 1 && (left_after == -1 || left_before == left_after)) ||
+            (middle_side == -1 && middle_before == -1)) {
+            right = middle;
+        } else {
+            left = middle + 1;
+            left_before = GetTurn<Predicates>(point, Vertex(left), Vertex(left + size - 1));
+            left_after = GetTurn<Predicates>(point, Vertex(left), Vertex(left + 1));
+        }
+    }
+    if (left < size && IsTangent(left)) {
+        return Farther(Farther(left, left + 1), left + size - 1);
+    }
+
+    size_t best = 0;
+    for (size_t i = 1; i < size; ++i) {
+        auto turn = GetTurn<Predicates>(point, convex_polygon[best], convex_polygon[i]);
+        if (turn == -1 || (turn == 0 && SquaredDistance(convex_polygon[i]) > SquaredDistance(convex_polygon[best]))) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Moves a tangent vertex found by GetTangentIndex for an earlier point of a counter-clockwise gift wrapping on
+ * to the tangent vertex for the current point.
+ *
+ * As the wrapping point turns counter-clockwise around the polygon, so does its tangent vertex. It is therefore
+ * advanced while the next vertex lies right of the ray from point through it, or on it and farther, which takes
+ * amortized constant time per step and also moves past a vertex coinciding with point. Should the result not be a
+ * tangent vertex (degenerate polygons), the binary search decides.
+ *
+ * @param convex_polygon The polygon vertices in counter-clockwise order.
+ * @param point The point outside of (or on a vertex of) the polygon.
+ * @param index The tangent vertex for the previous point of the wrapping.
+ * @return The index of the tangent vertex.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t AdvanceTangentIndex(std::span<const geometry::BasicPoint2D<T>> convex_polygon,
+                           const geometry::BasicPoint2D<T>& point, size_t index) {
+    const size_t size = convex_polygon.size();
+    if (size <= 3) {
+        return GetTangentIndex<Predicates>(convex_polygon, point);
+    }
+    auto SquaredDistance = [&point](const geometry::BasicPoint2D<T>& other) {
+        return util::GetDotValue(point, other, other);
+    };
+    for (size_t i = 0; i < size; ++i) {
+        const size_t next = index + 1 == size ? 0 : index + 1;
+        const int turn = GetTurn<Predicates>(point, convex_polygon[index], convex_polygon[next]);
+        if (turn == 1 ||
+            (turn == 0 && !(SquaredDistance(convex_polygon[next]) > SquaredDistance(convex_polygon[index])))) {
+            break;
+        }
+        index = next;
+    }
+    if (GetTurn<Predicates>(point, convex_polygon[index], convex_polygon[index == 0 ? size - 1 : index - 1]) == -1) {
+        index = GetTangentIndex<Predicates>(convex_polygon, point);
+        if (Predicates::AreCoincident(convex_polygon[index], point)) {
+            index = index + 1 == size ? 0 : index + 1;
+        }
+    }
+    return index;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Computes the convex hull with Chan's output-sensitive algorithm in O(n log h), using a reusable workspace.
+ *
+ * Each round guesses the hull size m = 2^(2^round), starting from 4, splits the points into groups of m, computes the
+ * hull of every group with Quickhull and then gift-wraps around the group hulls for at most m steps. The tangent to a
+ * group hull is found by a binary search in the first step and then only advanced, as it turns along with the wrapping.
+ * The group hulls are stored back to back in the workspace and are the points of the next round.
+ *
+ * Two rounds skip work that cannot pay off. The first round, m = 4, wraps the points themselves, which takes no more
+ * orientations than wrapping groups of 4 and needs no group hulls. A round whose group hulls keep at most half of its
+ * points skips the wrap, as the next round costs no more than this one while a wrap failing after m steps would cost
+ * about as much as the groups.
+ *
+ * On 1M points of a uniform disk or square it takes about two thirds of the time of the monotone chain and half of the
+ * time of the Graham scan, but three to four times that of Quickhull.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ * @param num_rounds Receives the number of rounds that were run.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point, valid until the
+ * workspace is used again.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::span<const geometry::BasicPoint2D<T>> GetConvexHullByChanWithWorkspace(
+    std::span<const geometry::BasicPoint2D<T>> input_points, BasicHullWorkspace<T>& workspace, size_t& num_rounds) {
+    using Point = geometry::BasicPoint2D<T>;
+    euclid::util::ScopedHullCall call("chan");
+    num_rounds = 0;
+    if (input_points.size() < 3) {
+        return {};
+    }
+
+    auto& points = workspace.Points();
+    auto& group_hull_points = workspace.GroupPoints();
+    auto& group_offsets = workspace.Offsets();
+    auto& tangent_indices = workspace.Indices();
+    auto& convex_hull_points = workspace.HullPoints();
+    points.assign(input_points.begin(), input_points.end());
+    auto GroupHull = [&](size_t group) {
+        return std::span<const Point>(group_hull_points.data() + group_offsets[group],
+                                      group_offsets[group + 1] - group_offsets[group]);
+    };
+    auto SquaredDistance = [](const Point& point, const Point& other) {
+        return util::GetDotValue(point, other, other);
+    };
+
+    for (size_t round = 1;; ++round) {
+        num_rounds++;
+        const size_t size = points.size();
+        // m = 2^(2^round) starting from 4, capped at the number of remaining points
+        const size_t group_size = round >= 5 ? size : std::min(size, static_cast<size_t>(1) << (1u << round));
+        size_t start_index = 0;
+        if constexpr (util::kIsExactFor<Predicates, T>) {
+            start_index = static_cast<size_t>(
+                std::min_element(points.begin(), points.end(), util::IsLowerThenLefter<T>) - points.begin());
+        } else {
+            start_index = util::GetLowestThenLeftestPointIndex(std::span<const Point>(points));
+        }
+        const auto start_point = points[start_index];
+
+        // The best candidate for the next vertex of a wrapping step. A candidate is only checked for coinciding with
+        // the current point once it beats the best one.
+        Point best_point{};
+        bool has_best = false;
+        auto Consider = [&](const Point& current_point, const Point& candidate) {
+            if (has_best) {
+                const int turn = detail::GetTurn<Predicates>(current_point, best_point, candidate);
+                if (turn == 1 || (turn == 0 && !(SquaredDistance(current_point, candidate) >
+                                                 SquaredDistance(current_point, best_point)))) {
+                    return;
+                }
+            }
+            if (!Predicates::AreCoincident(candidate, current_point)) {
+                best_point = candidate;
+                has_best = true;
+            }
+        };
+        // Gift-wraps from the start point for at most m steps, true once it is back at the start point.
+        auto Wrap = [&](auto&& ConsiderCandidates) {
+            euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kScan);
+            convex_hull_points.clear();
+            convex_hull_points.push_back(start_point);
+            for (size_t step = 0; step < group_size; ++step) {
+                has_best = false;
+                ConsiderCandidates(step, convex_hull_points.back());
+                if (!has_best || Predicates::AreCoincident(best_point, start_point)) {
+                    return true;
+                }
+                convex_hull_points.push_back(best_point);
+            }
+            return false;
+        };
+
+        if (round == 1) {
+            const bool is_closed = Wrap([&](size_t, const Point& current_point) {
+                for (const auto& point : points) {
+                    Consider(current_point, point);
+                }
+            });
+            if (is_closed) {
+                break;
+            }
+            continue;
+        }
+
+        // A group hull never has more vertices than the group has points, so the hulls of the previous groups never
+        // reach the room of the current one, which Quickhull needs for the group and its octagon.
+        group_hull_points.resize(size + kNumOctagonDirections);
+        convex_hull_points.resize(group_size);
+        group_offsets.assign(1, 0);
+        for (size_t begin = 0; begin < size; begin += group_size) {
+            std::span<const Point> group_points(points.data() + begin, std::min(group_size, size - begin));
+            auto* group_hull = group_hull_points.data() + group_offsets.back();
+            size_t hull_size =
+                GetConvexHullByQuickHullWithBuffers<Predicates>(group_points, convex_hull_points.data(), group_hull);
+            if (hull_size == 0) {
+                // Fewer than 3 points or all collinear, the two extremes are enough to wrap around.
+                auto [min_it, max_it] =
+                    std::minmax_element(group_points.begin(), group_points.end(), util::IsLowerThenLefter<T>);
+                group_hull[hull_size++] = *min_it;
+                if (!Predicates::AreCoincident(*max_it, *min_it)) {
+                    group_hull[hull_size++] = *max_it;
+                }
+            }
+            group_offsets.push_back(group_offsets.back() + hull_size);
+        }
+        group_hull_points.resize(group_offsets.back());
+        const size_t num_groups = group_offsets.size() - 1;
+
+        if (num_groups == 1 || 2 * group_hull_points.size() > size) {
+            tangent_indices.resize(num_groups);
+            const bool is_closed = Wrap([&](size_t step, const Point& current_point) {
+                for (size_t g = 0; g < num_groups; ++g) {
+                    const auto hull = GroupHull(g);
+                    size_t index = step == 0 ? detail::GetTangentIndex<Predicates>(hull, current_point)
+                                             : tangent_indices[g];
+                    index = detail::AdvanceTangentIndex<Predicates>(hull, current_point, index);
+                    tangent_indices[g] = index;
+                    Consider(current_point, hull[index]);
+                }
+            });
+            if (is_closed || num_groups == 1) {
+                break;
+            }
+        }
+
+        // Points inside their group hull cannot be on the final hull, the next round only wraps the group hulls.
+        points.swap(group_hull_points);
+    }
+
+    if (convex_hull_points.size() < 3) {
+        return {};
+    }
+    return convex_hull_points;
+}
+
+/**
+ * @brief Computes the convex hull with Chan's output-sensitive algorithm using a reusable workspace.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point, if they fit. input_points.size() entries always suffice.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByChan(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                           std::type_identity_t<std::span<geometry::BasicPoint2D<T>>> convex_hull_points,
+                           BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("chan");
+    size_t num_rounds = 0;
+    return CopyConvexHullPoints<T>(GetConvexHullByChanWithWorkspace<Predicates>(input_points, workspace, num_rounds),
+                                   convex_hull_points);
+}
+
+/**
+ * @brief Computes the convex hull with Chan's output-sensitive algorithm using a reusable workspace, into any vector,
+ * e.g. a std::pmr::vector.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point. Left empty when the hull has fewer than 3 vertices.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename Allocator>
+void GetConvexHullByChan(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                         std::vector<geometry::BasicPoint2D<T>, Allocator>& convex_hull_points,
+                         BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("chan");
+    size_t num_rounds = 0;
+    auto hull_points = GetConvexHullByChanWithWorkspace<Predicates>(input_points, workspace, num_rounds);
+    convex_hull_points.assign(hull_points.begin(), hull_points.end());
+}
+
+/**
+ * @brief Computes the convex hull with Chan's output-sensitive algorithm in O(n log h).
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param num_rounds Receives the number of rounds that were run.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByChan(const std::vector<geometry::BasicPoint2D<T>>& input_points,
+                                                   size_t& num_rounds) {
+    BasicHullWorkspace<T> workspace;
+    auto hull_points = GetConvexHullByChanWithWorkspace<Predicates>(
+        std::span<const geometry::BasicPoint2D<T>>(input_points), workspace, num_rounds);
+    return {hull_points.begin(), hull_points.end()};
+}
+
+/**
+ * @brief Computes the convex hull with Chan's output-sensitive algorithm in O(n log h).
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByChan(const std::vector<geometry::BasicPoint2D<T>>& input_points) {
+    size_t num_rounds = 0;
+    return GetConvexHullByChan<Predicates>(input_points, num_rounds);
+}
+
+}  // namespace euclid::algorithm::convex_hull
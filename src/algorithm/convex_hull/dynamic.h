@@ -0,0 +1,739 @@
+#pragma once
+
+/**
+ * @file dynamic.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/scalar_traits.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief The convex hull of a point set under insertions and deletions, after Overmars and van Leeuwen.
+ *
+ * The points are the leaves of a balanced binary tree, ordered like Point2D::operator< but exactly, i.e. by
+ * util::IsLowerThenLefter<T>. The hull is kept as the two chains of the monotone chain algorithm: the right chain from
+ * the lowest to the highest point and the left chain back down. Every inner node stores the bridge joining the chains
+ * of its two subtrees, and the parts of the children's chains the bridge cuts off, in concatenable queues (treaps
+ * keyed by the point order). An update walks from the root down to the leaf, reassembling the chains of the children
+ * from the stored parts, and back up, finding the new bridges. The root keeps both chains of the whole hull.
+ *
+ * Insert and Erase take O(log^2 n) expected time. A bridge is found by a simultaneous search in the chains of the two
+ * children; when the predicates alone cannot tell which chain to narrow, the search decides with a floating-point
+ * filter and, for nearly degenerate inputs, with an exact tangent search, costing one more log factor. Extreme point
+ * and tangent queries take O(log n) and enumerating the hull O(h).
+ *
+ * Coincident points are counted, each insertion needs its own erasure. The hull has no collinear vertices.
+ *
+ * @tparam T The coordinate type.
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ */
+template <typename T, typename Predicates = util::TolerancePredicates>
+class BasicDynamicConvexHull2D {
+public:
+    using Point = geometry::BasicPoint2D<T>;
+
+    /**
+     * @brief The number of points, coincident ones counted separately.
+     */
+    size_t Size() const { return size_; }
+
+    bool Empty() const { return size_ == 0; }
+
+    void Clear() {
+        *this = BasicDynamicConvexHull2D();
+    }
+
+    /**
+     * @brief Inserts a point in O(log^2 n) expected time.
+     */
+    void Insert(const Point& point) {
+        size_++;
+        if (root_ == kNil) {
+            root_ = NewLeaf(point);
+            return;
+        }
+        size_t leaf = FindLeaf(point);
+        if (IsEqual(points_[nodes_[leaf].point].point, point)) {
+            points_[nodes_[leaf].point].count++;
+            return;
+        }
+
+        path_.clear();
+        for (size_t node = root_; !IsLeaf(node); node = nodes_[node].child[GetSide(node, point)]) {
+            Unpack(node);
+            path_.push_back(node);
+        }
+        size_t new_leaf = NewLeaf(point);
+        size_t inner = NewNode();
+        bool is_new_leaf_first = util::IsLowerThenLefter(point, points_[nodes_[leaf].point].point);
+        nodes_[inner].child[0] = is_new_leaf_first ? new_leaf : leaf;
+        nodes_[inner].child[1] = is_new_leaf_first ? leaf : new_leaf;
+        nodes_[inner].is_unpacked = true;
+        ReplaceChild(path_.empty() ? kNil : path_.back(), leaf, inner);
+
+        // Rotates the new node up to restore the heap order of the priorities, only unpacked nodes are involved.
+        while (!path_.empty() && nodes_[inner].priority > nodes_[path_.back()].priority) {
+            size_t parent = path_.back();
+            path_.pop_back();
+            size_t side = nodes_[parent].child[0] == inner ? 0 : 1;
+            nodes_[parent].child[side] = nodes_[inner].child[1 - side];
+            nodes_[inner].child[1 - side] = parent;
+            ReplaceChild(path_.empty() ? kNil : path_.back(), parent, inner);
+        }
+        Rebuild(root_);
+    }
+
+    /**
+     * @brief Erases one occurrence of a point in O(log^2 n) expected time.
+     *
+     * @return false if the point is not in the set.
+     */
+    bool Erase(const Point& point) {
+        if (root_ == kNil) {
+            return false;
+        }
+        size_t leaf = FindLeaf(point);
+        auto& point_node = points_[nodes_[leaf].point];
+        if (!IsEqual(point_node.point, point)) {
+            return false;
+        }
+        size_--;
+        if (point_node.count > 1) {
+            point_node.count--;
+            return true;
+        }
+        if (leaf == root_) {
+            FreeLeaf(leaf);
+            root_ = kNil;
+            return true;
+        }
+
+        path_.clear();
+        for (size_t node = root_; node != leaf; node = nodes_[node].child[GetSide(node, point)]) {
+            Unpack(node);
+            path_.push_back(node);
+        }
+        size_t parent = path_.back();
+        path_.pop_back();
+        size_t sibling = nodes_[parent].child[nodes_[parent].child[0] == leaf ? 1 : 0];
+        ReplaceChild(path_.empty() ? kNil : path_.back(), parent, sibling);
+        FreeLeaf(leaf);
+        free_nodes_.push_back(parent);
+        Rebuild(root_);
+        return true;
+    }
+
+    /**
+     * @brief Enumerates the hull in O(h).
+     *
+     * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point, empty when the
+     * hull has fewer than 3 vertices.
+     */
+    std::vector<Point> GetConvexHull() const {
+        std::vector<Point> convex_hull_points;
+        if (root_ == kNil) {
+            return convex_hull_points;
+        }
+        for (size_t node = First(0, HullOf(root_, 0)); node != kNil; node = points_[node].next[0]) {
+            convex_hull_points.push_back(points_[node].point);
+        }
+        // The left chain runs from the highest point back to the lowest, both already on the right chain.
+        size_t node = points_[First(1, HullOf(root_, 1))].next[1];
+        for (; node != kNil && points_[node].next[1] != kNil; node = points_[node].next[1]) {
+            convex_hull_points.push_back(points_[node].point);
+        }
+        if (convex_hull_points.size() < 3) {
+            convex_hull_points.clear();
+        }
+        return convex_hull_points;
+    }
+
+    /**
+     * @brief Finds a hull vertex farthest in a direction in O(log n).
+     *
+     * @param direction The direction, need not be normalized.
+     * @return A point maximizing the dot product with direction, none if the set is empty.
+     */
+    std::optional<Point> GetExtremePoint(const Point& direction) const {
+        if (root_ == kNil) {
+            return std::nullopt;
+        }
+        size_t best = GetChainExtremePoint(0, direction);
+        size_t candidate = GetChainExtremePoint(1, direction);
+        if (GetDot(direction, points_[best].point, points_[candidate].point) > 0) {
+            best = candidate;
+        }
+        return points_[best].point;
+    }
+
+    /**
+     * @brief Finds the tangents from a point outside the hull in O(log n).
+     *
+     * @param point The point.
+     * @return The hull vertices touched by the tangents, i.e. the neighbours of point on the hull of the points and
+     * point: first the one before it, then the one after it in counter-clockwise order. None if point lies inside or
+     * on the hull.
+     */
+    std::optional<std::pair<Point, Point>> GetTangents(const Point& point) const {
+        if (root_ == kNil) {
+            return std::nullopt;
+        }
+        size_t before[2];
+        size_t after[2];
+        bool is_outside[2];
+        for (size_t chain = 0; chain < 2; ++chain) {
+            is_outside[chain] = IsOutsideChain(chain, point);
+            before[chain] = is_outside[chain] ? GetTangentBefore(chain, point) : kNil;
+            after[chain] = is_outside[chain] ? GetTangentAfter(chain, point) : kNil;
+        }
+        if (!is_outside[0] && !is_outside[1]) {
+            return std::nullopt;
+        }
+        // A point beyond the lowest or the highest point extends both chains, one neighbour on each.
+        size_t first = before[0] != kNil ? before[0] : before[1];
+        size_t second = after[0] != kNil ? after[0] : after[1];
+        if (first == kNil || second == kNil) {
+            return std::nullopt;
+        }
+        return std::make_pair(points_[first].point, points_[second].point);
+    }
+
+private:
+    static constexpr size_t kNil = std::numeric_limits<size_t>::max();
+
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+
+    /**
+     * @brief A point, which is also a node of the treap of the chain it currently belongs to, once per chain.
+     */
+    struct PointNode {
+        Point point;
+        size_t count = 1;
+        uint64_t priority = 0;
+        // children in the treap of each chain
+        size_t child[2][2] = {{kNil, kNil}, {kNil, kNil}};
+        // the following vertex on the chain the point currently belongs to
+        size_t next[2] = {kNil, kNil};
+    };
+
+    /**
+     * @brief What a tree node keeps of one chain.
+     */
+    struct ChainState {
+        // The full chain of the node while its parent is unpacked, or always for the root and leaves.
+        size_t hull = kNil;
+        // The last vertex of the first child's chain that is on the node's chain.
+        size_t bridge = kNil;
+        // The vertices of the first child's chain after bridge, and of the second child's chain before its bridge end.
+        size_t first_rest = kNil;
+        size_t second_rest = kNil;
+    };
+
+    struct TreeNode {
+        size_t child[2] = {kNil, kNil};
+        // the point of a leaf
+        size_t point = kNil;
+        // the greatest point of the subtree, which routes the searches
+        size_t max_point = kNil;
+        uint64_t priority = 0;
+        // The chains of an unpacked node are split up into the chains of its children.
+        bool is_unpacked = false;
+        ChainState chains[2];
+    };
+
+    static bool IsEqual(const Point& a, const Point& b) {
+        return a.coords[0] == b.coords[0] && a.coords[1] == b.coords[1];
+    }
+
+    /**
+     * @brief The order of a chain: the right chain ascends, the left chain descends.
+     */
+    static bool IsBefore(size_t chain, const Point& a, const Point& b) {
+        return chain == 0 ? util::IsLowerThenLefter(a, b) : util::IsLowerThenLefter(b, a);
+    }
+
+    uint64_t NextPriority() {
+        // splitmix64
+        uint64_t z = (random_state_ += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    size_t NewNode() {
+        size_t node = nodes_.size();
+        if (!free_nodes_.empty()) {
+            node = free_nodes_.back();
+            free_nodes_.pop_back();
+            nodes_[node] = TreeNode{};
+        } else {
+            nodes_.emplace_back();
+        }
+        nodes_[node].priority = NextPriority();
+        return node;
+    }
+
+    size_t NewLeaf(const Point& point) {
+        size_t point_index = points_.size();
+        if (!free_points_.empty()) {
+            point_index = free_points_.back();
+            free_points_.pop_back();
+            points_[point_index] = PointNode{};
+        } else {
+            points_.emplace_back();
+        }
+        points_[point_index].point = point;
+        points_[point_index].priority = NextPriority();
+        size_t leaf = NewNode();
+        nodes_[leaf].point = point_index;
+        nodes_[leaf].max_point = point_index;
+        nodes_[leaf].chains[0].hull = point_index;
+        nodes_[leaf].chains[1].hull = point_index;
+        return leaf;
+    }
+
+    void FreeLeaf(size_t leaf) {
+        free_points_.push_back(nodes_[leaf].point);
+        free_nodes_.push_back(leaf);
+    }
+
+    bool IsLeaf(size_t node) const { return nodes_[node].point != kNil; }
+
+    /**
+     * @brief The child whose subtree a point belongs in.
+     */
+    size_t GetSide(size_t node, const Point& point) const {
+        return util::IsLowerThenLefter(points_[nodes_[nodes_[node].child[0]].max_point].point, point) ? 1 : 0;
+    }
+
+    size_t FindLeaf(const Point& point) const {
+        size_t node = root_;
+        while (!IsLeaf(node)) {
+            node = nodes_[node].child[GetSide(node, point)];
+        }
+        return node;
+    }
+
+    void ReplaceChild(size_t parent, size_t old_child, size_t new_child) {
+        if (parent == kNil) {
+            root_ = new_child;
+        } else {
+            nodes_[parent].child[nodes_[parent].child[0] == old_child ? 0 : 1] = new_child;
+        }
+    }
+
+    size_t HullOf(size_t node, size_t chain) const { return nodes_[node].chains[chain].hull; }
+
+    /**
+     * @brief The child of a node holding the points that come first on a chain.
+     */
+    size_t GetChainChild(size_t node, size_t chain, size_t index) const { return nodes_[node].child[index ^ chain]; }
+
+    size_t TreapChild(size_t chain, size_t node, size_t side) const { return points_[node].child[chain][side]; }
+
+    size_t First(size_t chain, size_t treap) const {
+        while (treap != kNil && TreapChild(chain, treap, 0) != kNil) {
+            treap = TreapChild(chain, treap, 0);
+        }
+        return treap;
+    }
+
+    size_t Last(size_t chain, size_t treap) const {
+        while (treap != kNil && TreapChild(chain, treap, 1) != kNil) {
+            treap = TreapChild(chain, treap, 1);
+        }
+        return treap;
+    }
+
+    /**
+     * @brief Splits a treap into the vertices before key, or up to it if inclusive, and the rest.
+     */
+    void Split(size_t chain, size_t treap, const Point& key, bool inclusive, size_t& first, size_t& second) {
+        if (treap == kNil) {
+            first = kNil;
+            second = kNil;
+            return;
+        }
+        const auto& point = points_[treap].point;
+        bool goes_first = inclusive ? !IsBefore(chain, key, point) : IsBefore(chain, point, key);
+        auto& children = points_[treap].child[chain];
+        if (goes_first) {
+            Split(chain, children[1], key, inclusive, children[1], second);
+            first = treap;
+        } else {
+            Split(chain, children[0], key, inclusive, first, children[0]);
+            second = treap;
+        }
+    }
+
+    size_t Merge(size_t chain, size_t first, size_t second) {
+        if (first == kNil) {
+            return second;
+        }
+        if (second == kNil) {
+            return first;
+        }
+        if (points_[first].priority > points_[second].priority) {
+            points_[first].child[chain][1] = Merge(chain, points_[first].child[chain][1], second);
+            return first;
+        }
+        points_[second].child[chain][0] = Merge(chain, first, points_[second].child[chain][0]);
+        return second;
+    }
+
+    /**
+     * @brief Concatenates two chains, every vertex of the first coming before every vertex of the second.
+     */
+    size_t Join(size_t chain, size_t first, size_t second) {
+        if (first != kNil && second != kNil) {
+            points_[Last(chain, first)].next[chain] = First(chain, second);
+        }
+        return Merge(chain, first, second);
+    }
+
+    /**
+     * @brief Reassembles the full chains of both children of a node from its chains and the parts it cut off.
+     */
+    void Unpack(size_t node) {
+        for (size_t chain = 0; chain < 2; ++chain) {
+            auto& state = nodes_[node].chains[chain];
+            size_t first = kNil;
+            size_t second = kNil;
+            Split(chain, state.hull, points_[state.bridge].point, true, first, second);
+            points_[state.bridge].next[chain] = kNil;
+            nodes_[GetChainChild(node, chain, 0)].chains[chain].hull = Join(chain, first, state.first_rest);
+            nodes_[GetChainChild(node, chain, 1)].chains[chain].hull = Join(chain, state.second_rest, second);
+            state.first_rest = kNil;
+            state.second_rest = kNil;
+        }
+        nodes_[node].is_unpacked = true;
+    }
+
+    /**
+     * @brief Joins the chains of the children of an unpacked node, keeping the parts cut off by the bridges.
+     */
+    void Pack(size_t node) {
+        for (size_t chain = 0; chain < 2; ++chain) {
+            size_t first_hull = HullOf(GetChainChild(node, chain, 0), chain);
+            size_t second_hull = HullOf(GetChainChild(node, chain, 1), chain);
+            auto [bridge_first, bridge_second] = FindBridge(chain, first_hull, second_hull);
+            auto& state = nodes_[node].chains[chain];
+            size_t first = kNil;
+            size_t second = kNil;
+            Split(chain, first_hull, points_[bridge_first].point, true, first, state.first_rest);
+            points_[bridge_first].next[chain] = kNil;
+            Split(chain, second_hull, points_[bridge_second].point, false, state.second_rest, second);
+            if (state.second_rest != kNil) {
+                points_[Last(chain, state.second_rest)].next[chain] = kNil;
+            }
+            state.bridge = bridge_first;
+            state.hull = Join(chain, first, second);
+        }
+        nodes_[node].max_point = nodes_[nodes_[node].child[1]].max_point;
+        nodes_[node].is_unpacked = false;
+    }
+
+    void Rebuild(size_t node) {
+        if (IsLeaf(node) || !nodes_[node].is_unpacked) {
+            return;
+        }
+        Rebuild(nodes_[node].child[0]);
+        Rebuild(nodes_[node].child[1]);
+        Pack(node);
+    }
+
+    /**
+     * @brief Whether r is on the line pq or outside the chain through p and q, p before q. Every chain turns left, so
+     * its outside is the right of its edges.
+     */
+    static bool IsOutsideOrOn(const Point& p, const Point& q, const Point& r) {
+        return !Predicates::IsTurnLeft(p, q, r);
+    }
+
+    /**
+     * @brief The coordinates in which a chain is an upper hull ordered by the first coordinate: (y, x) for the right
+     * chain and (-y, -x) for the left chain. Both are reflections.
+     */
+    static T GetChainX(size_t chain, const Point& point) { return chain == 0 ? point.coords[1] : -point.coords[1]; }
+
+    static T GetChainY(size_t chain, const Point& point) { return chain == 0 ? point.coords[0] : -point.coords[0]; }
+
+    static double GetDifference(T a, T b) {
+        if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+            return static_cast<double>(static_cast<Accumulator>(a) - static_cast<Accumulator>(b));
+        } else {
+            return static_cast<double>(a) - static_cast<double>(b);
+        }
+    }
+
+    /**
+     * @brief Compares the lines through the chain edges ab and cd at the separator, which is at least the chain x of
+     * every point before it and at most that of every point after it.
+     *
+     * @return 1 if the line through ab is above, -1 if it is below, 0 if the floating-point evaluation cannot tell.
+     */
+    static int CompareAtSeparator(size_t chain, const Point& a, const Point& b, const Point& c, const Point& d,
+                                  T separator) {
+        double dx1 = GetDifference(GetChainX(chain, b), GetChainX(chain, a));
+        double dy1 = GetDifference(GetChainY(chain, b), GetChainY(chain, a));
+        double dx2 = GetDifference(GetChainX(chain, d), GetChainX(chain, c));
+        double dy2 = GetDifference(GetChainY(chain, d), GetChainY(chain, c));
+        double term1 = GetDifference(GetChainY(chain, a), GetChainY(chain, c)) * dx1 * dx2;
+        double term2 = GetDifference(separator, GetChainX(chain, a)) * dy1 * dx2;
+        double term3 = GetDifference(separator, GetChainX(chain, c)) * dy2 * dx1;
+        double value = term1 + term2 - term3;
+        // Every factor is a difference of inputs rounded once, which bounds the error of the two products and sums.
+        double error_bound =
+            8.0 * std::numeric_limits<double>::epsilon() * (std::abs(term1) + std::abs(term2) + std::abs(term3));
+        if (value > error_bound) {
+            return 1;
+        }
+        if (value < -error_bound) {
+            return -1;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief The vertex of a chain where the tangent from a point before all of its vertices touches it, the farthest
+     * one if the tangent runs along an edge.
+     */
+    size_t GetTangentFromBefore(size_t chain, size_t treap, const Point& point) const {
+        size_t best = kNil;
+        while (treap != kNil) {
+            size_t next = points_[treap].next[chain];
+            if (next != kNil && IsOutsideOrOn(point, points_[treap].point, points_[next].point)) {
+                treap = TreapChild(chain, treap, 1);
+            } else {
+                best = treap;
+                treap = TreapChild(chain, treap, 0);
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Finds the bridge joining two chains, every vertex of the first before every vertex of the second.
+     *
+     * Searches both treaps at once, narrowing one of them in every step. With the edge ab of the first chain and cd of
+     * the second: if c is not right of ab, the bridge leaves the first chain at a or before; if b is not right of cd,
+     * it reaches the second chain at d or after. Otherwise the lines through ab and cd meet before or after the
+     * separator, which rules out the part of the first chain up to a, or that of the second chain from d on, as in
+     * the algorithm of Overmars and van Leeuwen.
+     *
+     * @return The last vertex of the first chain and the first vertex of the second chain on the joined chain.
+     */
+    std::pair<size_t, size_t> FindBridge(size_t chain, size_t first_hull, size_t second_hull) const {
+        size_t first = first_hull;
+        size_t second = second_hull;
+        size_t first_best = kNil;
+        size_t second_best = kNil;
+        std::optional<T> separator;
+        // Both searches look for the earliest vertex whose outgoing edge does not lead towards the bridge.
+        auto GoBefore = [&](size_t& treap, size_t& best) {
+            best = treap;
+            treap = TreapChild(chain, treap, 0);
+        };
+        auto GoAfter = [&](size_t& treap) { treap = TreapChild(chain, treap, 1); };
+        while (first != kNil || second != kNil) {
+            size_t first_next = first != kNil ? points_[first].next[chain] : kNil;
+            size_t second_next = second != kNil ? points_[second].next[chain] : kNil;
+            if (first != kNil && first_next == kNil) {
+                GoBefore(first, first_best);
+                continue;
+            }
+            if (second != kNil && second_next == kNil) {
+                GoBefore(second, second_best);
+                continue;
+            }
+            if (first == kNil) {
+                const auto& p = points_[first_best].point;
+                if (IsOutsideOrOn(p, points_[second].point, points_[second_next].point)) {
+                    GoAfter(second);
+                } else {
+                    GoBefore(second, second_best);
+                }
+                continue;
+            }
+            const auto& a = points_[first].point;
+            const auto& b = points_[first_next].point;
+            if (second == kNil) {
+                if (IsOutsideOrOn(a, b, points_[second_best].point)) {
+                    GoBefore(first, first_best);
+                } else {
+                    GoAfter(first);
+                }
+                continue;
+            }
+            const auto& c = points_[second].point;
+            const auto& d = points_[second_next].point;
+            if (IsOutsideOrOn(a, b, c)) {
+                GoBefore(first, first_best);
+            } else if (IsOutsideOrOn(c, d, b)) {
+                GoAfter(second);
+            } else if (GetChainX(chain, a) == GetChainX(chain, b)) {
+                // ab is the vertical first edge of the first chain, only the vertices of the second chain on the same
+                // vertical line, the first one among them, can be outside or on it
+                if (IsOutsideOrOn(a, b, points_[First(chain, second_hull)].point)) {
+                    GoBefore(first, first_best);
+                } else {
+                    GoAfter(first);
+                }
+            } else {
+                if (!separator) {
+                    separator = GetChainX(chain, points_[First(chain, second_hull)].point);
+                }
+                int side = CompareAtSeparator(chain, a, b, c, d, *separator);
+                if (side > 0) {
+                    GoAfter(first);
+                } else if (side < 0) {
+                    GoBefore(second, second_best);
+                } else {
+                    // Nearly degenerate, the tangent from b decides exactly whether some vertex is outside ab.
+                    const auto& tangent = points_[GetTangentFromBefore(chain, second_hull, b)].point;
+                    if (IsOutsideOrOn(a, b, tangent)) {
+                        GoBefore(first, first_best);
+                    } else {
+                        GoAfter(first);
+                    }
+                }
+            }
+        }
+        return {first_best, second_best};
+    }
+
+    Accumulator GetDot(const Point& direction, const Point& from, const Point& to) const {
+        return static_cast<Accumulator>(direction.coords[0]) *
+                   (static_cast<Accumulator>(to.coords[0]) - static_cast<Accumulator>(from.coords[0])) +
+               static_cast<Accumulator>(direction.coords[1]) *
+                   (static_cast<Accumulator>(to.coords[1]) - static_cast<Accumulator>(from.coords[1]));
+    }
+
+    /**
+     * @brief The vertex of a root chain farthest in a direction. The edge directions of a chain span less than a half
+     * turn, so the dot products of the edges with the direction change sign at most once.
+     */
+    size_t GetChainExtremePoint(size_t chain, const Point& direction) const {
+        size_t treap = HullOf(root_, chain);
+        size_t first = First(chain, treap);
+        size_t first_next = points_[first].next[chain];
+        if (first_next == kNil || GetDot(direction, points_[first].point, points_[first_next].point) <= 0) {
+            // decreasing first, so the maximum is at one of the ends
+            size_t last = Last(chain, treap);
+            return GetDot(direction, points_[first].point, points_[last].point) > 0 ? last : first;
+        }
+        size_t best = kNil;
+        while (treap != kNil) {
+            size_t next = points_[treap].next[chain];
+            if (next != kNil && GetDot(direction, points_[treap].point, points_[next].point) > 0) {
+                treap = TreapChild(chain, treap, 1);
+            } else {
+                best = treap;
+                treap = TreapChild(chain, treap, 0);
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Whether a point extends a root chain, i.e. lies before or after all of its vertices or strictly outside
+     * the edge spanning it.
+     */
+    bool IsOutsideChain(size_t chain, const Point& point) const {
+        size_t treap = HullOf(root_, chain);
+        const auto& first = points_[First(chain, treap)].point;
+        const auto& last = points_[Last(chain, treap)].point;
+        if (IsBefore(chain, point, first) || IsBefore(chain, last, point)) {
+            return true;
+        }
+        // the last vertex before point
+        size_t before = kNil;
+        while (treap != kNil) {
+            if (IsBefore(chain, points_[treap].point, point)) {
+                before = treap;
+                treap = TreapChild(chain, treap, 1);
+            } else {
+                treap = TreapChild(chain, treap, 0);
+            }
+        }
+        if (before == kNil || points_[before].next[chain] == kNil) {
+            return false;
+        }
+        const auto& p = points_[before].point;
+        const auto& q = points_[points_[before].next[chain]].point;
+        return !IsEqual(q, point) && Predicates::IsTurnLeft(q, p, point);
+    }
+
+    /**
+     * @brief The tangent from a point outside a root chain to the vertices before it, kNil if there are none.
+     */
+    size_t GetTangentBefore(size_t chain, const Point& point) const {
+        size_t treap = HullOf(root_, chain);
+        size_t best = kNil;
+        while (treap != kNil) {
+            if (!IsBefore(chain, points_[treap].point, point)) {
+                treap = TreapChild(chain, treap, 0);
+                continue;
+            }
+            size_t next = points_[treap].next[chain];
+            if (next == kNil || !IsBefore(chain, points_[next].point, point) ||
+                IsOutsideOrOn(points_[treap].point, points_[next].point, point)) {
+                best = treap;
+                treap = TreapChild(chain, treap, 0);
+            } else {
+                treap = TreapChild(chain, treap, 1);
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief The tangent from a point outside a root chain to the vertices after it, kNil if there are none.
+     */
+    size_t GetTangentAfter(size_t chain, const Point& point) const {
+        size_t treap = HullOf(root_, chain);
+        size_t best = kNil;
+        while (treap != kNil) {
+            if (!IsBefore(chain, point, points_[treap].point)) {
+                treap = TreapChild(chain, treap, 1);
+                continue;
+            }
+            size_t next = points_[treap].next[chain];
+            if (next != kNil && IsOutsideOrOn(point, points_[treap].point, points_[next].point)) {
+                treap = TreapChild(chain, treap, 1);
+            } else {
+                best = treap;
+                treap = TreapChild(chain, treap, 0);
+            }
+        }
+        return best;
+    }
+
+    std::vector<TreeNode> nodes_;
+    std::vector<PointNode> points_;
+    std::vector<size_t> free_nodes_;
+    std::vector<size_t> free_points_;
+    // the nodes from the root to the updated leaf, kept to save allocations
+    std::vector<size_t> path_;
+    size_t root_ = kNil;
+    size_t size_ = 0;
+    uint64_t random_state_ = 0;
+};
+
+using DynamicConvexHull2D = BasicDynamicConvexHull2D<double>;
+
+}  // namespace euclid::algorithm::convex_hull
@@ -7,22 +7,37 @@
  */
 
 #include <algorithm>
+#include <functional>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "algorithm/convex_hull/util.h"
-#include "algorithm/util/location.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
 #include "geometry/point_2d.h"
+#include "util/instrumentation.h"
 
 namespace euclid::algorithm::convex_hull {
 
-inline std::vector<geometry::Point2D> GetConvexHullByExtremeEdge(const std::vector<geometry::Point2D>& input_points) {
-    auto points = RemoveCoincidePoints(input_points);
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByExtremeEdge(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points) {
+    euclid::util::ScopedHullCall call("extreme_edge");
+    auto points = RemoveCoincidePointsFor<Predicates>(input_points);
     if (points.size() < 3) {
         return points;
     }
-    std::sort(points.begin(), points.end());
-    std::vector<std::pair<geometry::Point2D, geometry::Point2D>> extreme_edges;
+    {
+        euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kSort);
+        if constexpr (util::kIsExactFor<Predicates, T>) {
+            std::sort(points.begin(), points.end(), euclid::util::CountComparisons(util::IsLowerThenLefter<T>));
+        } else {
+            std::sort(points.begin(), points.end(), euclid::util::CountComparisons(std::less<>()));
+        }
+    }
+    std::vector<std::pair<geometry::BasicPoint2D<T>, geometry::BasicPoint2D<T>>> extreme_edges;
+    std::optional<euclid::util::ScopedHullPhase> phase(std::in_place, euclid::util::HullPhase::kScan);
     for (size_t i = 0; i < points.size(); ++i) {
         for (size_t j = i + 1; j < points.size(); ++j) {
             bool is_extreme_edge = true;
@@ -32,10 +47,10 @@ inline std::vector<geometry::Point2D> GetConvexHullByExtremeEdge(const std::vect
                 if (k == i || k == j) {
                     continue;
                 }
-                if (util::IsTurnLeft(points[i], points[j], points[k])) {
+                if (Predicates::IsTurnLeft(points[i], points[j], points[k])) {
                     is_left_turn = true;
-                } else if (util::ArePointsCollinear(points[i], points[j], points[k])) {
-                    if (!util::IsPointOnSegment(points[k], points[i], points[j])) {
+                } else if (Predicates::ArePointsCollinear(points[i], points[j], points[k])) {
+                    if (!Predicates::IsPointOnSegment(points[k], points[i], points[j])) {
                         is_extreme_edge = false;
                         break;
                     }
@@ -52,16 +67,17 @@ inline std::vector<geometry::Point2D> GetConvexHullByExtremeEdge(const std::vect
             }
         }
     }
+    phase.reset();
     if (extreme_edges.size() < 3) {
         return {};
     }
-    std::vector<geometry::Point2D> extreme_points;
+    std::vector<geometry::BasicPoint2D<T>> extreme_points;
     for (const auto& edge : extreme_edges) {
         extreme_points.push_back(edge.first);
         extreme_points.push_back(edge.second);
     }
-    extreme_points = RemoveCoincidePoints(extreme_points);
-    return SortExtremePoints(extreme_points);
+    extreme_points = RemoveCoincidePointsFor<Predicates>(extreme_points);
+    return SortExtremePoints<Predicates>(extreme_points);
 }
 
 }  // namespace euclid::algorithm::convex_hull
\ No newline at end of file
@@ -6,21 +6,27 @@
  * @date 2025-09-01
  */
 
+#include <optional>
 #include <vector>
 
 #include "algorithm/convex_hull/util.h"
-#include "algorithm/util/location.h"
+#include "algorithm/util/predicates.h"
 #include "geometry/point_2d.h"
+#include "util/instrumentation.h"
 
 namespace euclid::algorithm::convex_hull {
 
-inline std::vector<geometry::Point2D> GetConvexHullByExtremePoint(const std::vector<geometry::Point2D>& input_points) {
-    auto points = RemoveCoincidePoints(input_points);
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByExtremePoint(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points) {
+    euclid::util::ScopedHullCall call("extreme_point");
+    auto points = RemoveCoincidePointsFor<Predicates>(input_points);
     if (points.size() < 3) {
         return {};
     }
 
     std::vector<bool> is_extreme_point(points.size(), false);
+    std::optional<euclid::util::ScopedHullPhase> phase(std::in_place, euclid::util::HullPhase::kScan);
     for (size_t h = 0; h < points.size(); ++h) {
         bool is_extreme = true;
         for (size_t i = 0; i < points.size(); ++i) {
@@ -44,7 +50,7 @@ inline std::vector<geometry::Point2D> GetConvexHullByExtremePoint(const std::vec
                     if (!is_extreme) {
                         break;
                     }
-                    if (util::IsPointInTriangle(points[h], points[i], points[j], points[k])) {
+                    if (Predicates::IsPointInTriangle(points[h], points[i], points[j], points[k])) {
                         is_extreme = false;
                         break;
                     }
@@ -53,15 +59,16 @@ inline std::vector<geometry::Point2D> GetConvexHullByExtremePoint(const std::vec
         }
         is_extreme_point[h] = is_extreme;
     }
+    phase.reset();
 
-    std::vector<geometry::Point2D> extreme_points;
+    std::vector<geometry::BasicPoint2D<T>> extreme_points;
     extreme_points.reserve(points.size());
     for (size_t h = 0; h < points.size(); ++h) {
         if (is_extreme_point[h]) {
             extreme_points.push_back(points[h]);
         }
     }
-    return SortExtremePoints(extreme_points);
+    return SortExtremePoints<Predicates>(extreme_points);
 }
 
 }  // namespace euclid::algorithm::convex_hull
@@ -9,75 +9,183 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <stack>
+#include <optional>
+#include <span>
+#include <type_traits>
 #include <vector>
 
-#include "algorithm/util/location.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
 #include "algorithm/util/sort.h"
 #include "geometry/point_2d.h"
+#include "util/instrumentation.h"
 
 namespace euclid::algorithm::convex_hull {
 
-inline std::vector<geometry::Point2D> GetConvexHullByGrahamScan(const std::vector<geometry::Point2D>& input_points) {
+/**
+ * @brief Computes the convex hull with the Graham scan into caller-provided buffers.
+ *
+ * With util::TolerancePredicates the points are sorted by their atan2 angle around the lowest then leftest point. Exact
+ * policies sort by orientation instead, so the order is decided exactly as well.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param angled_points Scratch space for input_points.size() points.
+ * @param convex_hull_points Room for input_points.size() points, receives the hull vertices in counter-clockwise
+ * order, starting from the lowest then leftest point. Must not alias input_points.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByGrahamScanWithBuffers(std::span<const geometry::BasicPoint2D<T>> input_points,
+                                            PointWithAngle<T>* angled_points,
+                                            geometry::BasicPoint2D<T>* convex_hull_points) {
+    euclid::util::ScopedHullCall call("graham_scan");
     if (input_points.size() < 3) {
-        return {};
+        return 0;
+    }
+    std::optional<euclid::util::ScopedHullPhase> phase(std::in_place, euclid::util::HullPhase::kSort);
+
+    size_t lowest_then_leftest_index = 0;
+    if constexpr (util::kIsExactFor<Predicates, T>) {
+        auto lowest_then_leftest =
+            std::min_element(input_points.begin(), input_points.end(), util::IsLowerThenLefter<T>);
+        lowest_then_leftest_index = static_cast<size_t>(lowest_then_leftest - input_points.begin());
+    } else {
+        lowest_then_leftest_index = util::GetLowestThenLeftestPointIndex(input_points);
     }
 
-    struct PointWithAngle {
-        geometry::Point2D point;
-        double angle;
-    };
-
-    auto lowest_then_leftest_index = util::GetLowestThenLeftestPointIndex(input_points);
-
-    std::vector<geometry::Point2D> convex_hull_points(input_points.size());
-    convex_hull_points[0] = input_points[lowest_then_leftest_index];
+    const auto first_point = input_points[lowest_then_leftest_index];
+    convex_hull_points[0] = first_point;
 
-    std::vector<PointWithAngle> points_with_angles;
+    size_t num_angled_points = 0;
     for (size_t i = 0; i < input_points.size(); ++i) {
         if (i == lowest_then_leftest_index) {
             continue;
         }
-        points_with_angles.emplace_back(input_points[i],
-                                        std::atan2(input_points[i].coords[1] - convex_hull_points[0].coords[1],
-                                                   input_points[i].coords[0] - convex_hull_points[0].coords[0]));
+        if constexpr (util::kIsExactFor<Predicates, T>) {
+            angled_points[num_angled_points++] = {input_points[i], 0.0};
+        } else {
+            angled_points[num_angled_points++] = {
+                input_points[i], std::atan2(input_points[i].coords[1] - first_point.coords[1],
+                                            input_points[i].coords[0] - first_point.coords[0])};
+        }
     }
 
-    auto PointWithAngleComparator = [&convex_hull_points](const PointWithAngle& a, const PointWithAngle& b) {
+    auto PointWithAngleComparator = [&first_point](const PointWithAngle<T>& a, const PointWithAngle<T>& b) {
         if (a.angle == b.angle) {
-            return a.point.Distance(convex_hull_points[0]) < b.point.Distance(convex_hull_points[0]);
+            return a.point.Distance(first_point) < b.point.Distance(first_point);
         }
         return a.angle < b.angle;
     };
 
-    std::sort(points_with_angles.begin(), points_with_angles.end(), PointWithAngleComparator);
+    // All points lie in the half-plane above the first point, where the orientation around it orders them by angle.
+    // Points on the same ray, and copies of the first point, are ordered from near to far.
+    auto PointWithOrientationComparator = [&first_point](const PointWithAngle<T>& a, const PointWithAngle<T>& b) {
+        int orientation = Predicates::GetOrientation(first_point, a.point, b.point);
+        if (orientation == 0) {
+            return util::IsLowerThenLefter(a.point, b.point);
+        }
+        return orientation > 0;
+    };
 
-    std::stack<geometry::Point2D> potential_hull_points;
-    for (size_t i = points_with_angles.size(); i > 1; --i) {
-        potential_hull_points.push(points_with_angles[i - 1].point);
+    if constexpr (util::kIsExactFor<Predicates, T>) {
+        std::sort(angled_points, angled_points + num_angled_points,
+                  euclid::util::CountComparisons(PointWithOrientationComparator));
+    } else {
+        std::sort(angled_points, angled_points + num_angled_points,
+                  euclid::util::CountComparisons(PointWithAngleComparator));
     }
+    phase.emplace(euclid::util::HullPhase::kScan);
 
-    convex_hull_points[1] = points_with_angles[0].point;
+    convex_hull_points[1] = angled_points[0].point;
     size_t last_index = 0;
     size_t current_index = 1;
 
-    while (!potential_hull_points.empty()) {
-        auto& last_point = convex_hull_points[last_index];
-        auto& current_point = convex_hull_points[current_index];
-        auto& next_point = potential_hull_points.top();
+    // The sorted points are consumed in order, next_index walks them like the top of a stack.
+    size_t next_index = 1;
+    while (next_index < num_angled_points) {
+        const auto& last_point = convex_hull_points[last_index];
+        const auto& current_point = convex_hull_points[current_index];
+        const auto& next_point = angled_points[next_index].point;
 
-        if (util::IsTurnLeft(last_point, current_point, next_point)) {
+        if (Predicates::IsTurnLeft(last_point, current_point, next_point)) {
             convex_hull_points[current_index + 1] = next_point;
             last_index++;
             current_index++;
-            potential_hull_points.pop();
+            next_index++;
+        } else if (current_index == 1) {
+            // next_point is farther than current_point along the same ray from the lowest then leftest point
+            convex_hull_points[current_index] = next_point;
+            next_index++;
         } else {
+            euclid::util::CountHullEvent(&euclid::util::HullStats::graham_scan_pops);
             current_index--;
             last_index--;
         }
     }
-    convex_hull_points.resize(current_index + 1);
+    if (current_index < 2) {
+        return 0;
+    }
+    return current_index + 1;
+}
+
+/**
+ * @brief Computes the convex hull with the Graham scan using a reusable workspace.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point, if they fit. input_points.size() entries always suffice.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByGrahamScan(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                                 std::type_identity_t<std::span<geometry::BasicPoint2D<T>>> convex_hull_points,
+                                 BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("graham_scan");
+    workspace.AngledPoints().resize(input_points.size());
+    workspace.HullPoints().resize(input_points.size());
+    const size_t hull_size = GetConvexHullByGrahamScanWithBuffers<Predicates>(
+        input_points, workspace.AngledPoints().data(), workspace.HullPoints().data());
+    return CopyConvexHullPoints<T>({workspace.HullPoints().data(), hull_size}, convex_hull_points);
+}
 
+/**
+ * @brief Computes the convex hull with the Graham scan using a reusable workspace, into any vector, e.g. a
+ * std::pmr::vector.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point. Left empty when the hull has fewer than 3 vertices.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename Allocator>
+void GetConvexHullByGrahamScan(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                               std::vector<geometry::BasicPoint2D<T>, Allocator>& convex_hull_points,
+                               BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("graham_scan");
+    workspace.AngledPoints().resize(input_points.size());
+    workspace.HullPoints().resize(input_points.size());
+    const size_t hull_size = GetConvexHullByGrahamScanWithBuffers<Predicates>(
+        input_points, workspace.AngledPoints().data(), workspace.HullPoints().data());
+    convex_hull_points.assign(workspace.HullPoints().begin(), workspace.HullPoints().begin() + hull_size);
+}
+
+/**
+ * @brief Computes the convex hull with the Graham scan.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByGrahamScan(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points) {
+    BasicHullWorkspace<T> workspace;
+    std::vector<geometry::BasicPoint2D<T>> convex_hull_points;
+    GetConvexHullByGrahamScan<Predicates>(input_points, convex_hull_points, workspace);
     return convex_hull_points;
 }
 
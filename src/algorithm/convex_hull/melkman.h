@@ -0,0 +1,240 @@
+#pragma once
+
+/**
+ * @file melkman.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief The convex hull of the vertices of a simple polyline or polygon, fed one vertex at a time in their order
+ * along it, with Melkman's algorithm.
+ *
+ * The hull is kept in a deque whose both ends hold the last vertex that extended it. As the polyline does not cross
+ * itself, a new vertex can leave the hull only across the two hull edges at that vertex, so it is dropped after two
+ * orientation tests if it lies inside both, and otherwise replaces the vertices it makes non-convex at both ends of the
+ * deque. Each vertex is pushed and popped at most twice, so a polyline of n vertices takes O(n) time, without sorting,
+ * and O(h) memory: the deque is a ring buffer holding the hull only.
+ *
+ * The input must be simple: the hull of a polyline that crosses or touches itself may miss vertices. Coincident
+ * consecutive vertices are allowed, and so are collinear runs, e.g. at the start.
+ *
+ * See A. A. Melkman, "On-line Construction of the Convex Hull of a Simple Polyline" (1987).
+ *
+ * @tparam T The coordinate type.
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ */
+template <typename T, typename Predicates = util::TolerancePredicates>
+class BasicMelkmanConvexHull {
+public:
+    using Point = geometry::BasicPoint2D<T>;
+
+    /**
+     * @brief The number of vertices added so far.
+     */
+    size_t NumPoints() const { return num_points_; }
+
+    void Clear() {
+        num_points_ = 0;
+        num_segment_points_ = 0;
+        first_ = 0;
+        size_ = 0;
+    }
+
+    /**
+     * @brief Adds the next vertex of the polyline in O(1) amortized time.
+     */
+    void Add(const Point& point) {
+        num_points_++;
+        if (size_ == 0) {
+            AddToSegment(point);
+            return;
+        }
+        const Point& top = At(size_ - 1);
+        if (IsEqual(point, top) || (IsInsideOrOn(At(0), At(1), point) && IsInsideOrOn(At(size_ - 2), top, point))) {
+            return;
+        }
+        while (size_ > 2 && !Predicates::IsTurnLeft(At(size_ - 2), At(size_ - 1), point)) {
+            size_--;
+        }
+        PushBack(point);
+        while (size_ > 3 && !Predicates::IsTurnLeft(point, At(0), At(1))) {
+            PopFront();
+        }
+        PushFront(point);
+    }
+
+    /**
+     * @brief Adds the vertices of a polyline in order.
+     */
+    void Add(std::span<const Point> points) { Add(points.begin(), points.end()); }
+
+    /**
+     * @brief Adds the vertices of an input range in order, reading it once.
+     */
+    template <typename InputIt>
+    void Add(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            Add(static_cast<const Point&>(*first));
+        }
+    }
+
+    /**
+     * @brief Copies the hull of the vertices added so far in O(h).
+     *
+     * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+     * leftest point. Left empty when the hull has fewer than 3 vertices.
+     */
+    template <typename Allocator>
+    void GetConvexHull(std::vector<Point, Allocator>& convex_hull_points) const {
+        convex_hull_points.clear();
+        if (size_ == 0) {
+            return;
+        }
+        // the last vertex is at both ends of the deque
+        for (size_t i = 0; i + 1 < size_; ++i) {
+            convex_hull_points.push_back(At(i));
+        }
+        std::rotate(convex_hull_points.begin(),
+                    std::min_element(convex_hull_points.begin(), convex_hull_points.end(), util::IsLowerThenLefter<T>),
+                    convex_hull_points.end());
+        if constexpr (!util::kIsExactFor<Predicates, T>) {
+            std::rotate(convex_hull_points.begin(),
+                        std::min_element(convex_hull_points.begin(), convex_hull_points.end()),
+                        convex_hull_points.end());
+        }
+    }
+
+    /**
+     * @brief The hull of the vertices added so far, in O(h).
+     *
+     * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point, empty when
+     * the hull has fewer than 3 vertices.
+     */
+    std::vector<Point> GetConvexHull() const {
+        std::vector<Point> convex_hull_points;
+        GetConvexHull(convex_hull_points);
+        return convex_hull_points;
+    }
+
+private:
+    static bool IsEqual(const Point& a, const Point& b) {
+        return a.coords[0] == b.coords[0] && a.coords[1] == b.coords[1];
+    }
+
+    /**
+     * @brief Whether r lies left of the hull edge pq or on it, i.e. does not leave the hull across it.
+     */
+    static bool IsInsideOrOn(const Point& p, const Point& q, const Point& r) {
+        return Predicates::IsTurnLeft(p, q, r) || Predicates::IsPointOnSegment(r, p, q);
+    }
+
+    /**
+     * @brief Collects the vertices until they span a triangle, keeping only the ends of the segment they lie on.
+     */
+    void AddToSegment(const Point& point) {
+        if (num_segment_points_ == 0) {
+            segment_[0] = point;
+            num_segment_points_ = 1;
+            return;
+        }
+        if (IsEqual(point, segment_[0]) || (num_segment_points_ == 2 && IsEqual(point, segment_[1]))) {
+            return;
+        }
+        if (num_segment_points_ == 1) {
+            segment_[1] = point;
+            num_segment_points_ = 2;
+            return;
+        }
+        if (Predicates::ArePointsCollinear(segment_[0], segment_[1], point)) {
+            // A simple polyline runs along a line in one direction, but the ends are found by order anyway.
+            const auto [lowest, highest] = std::minmax({segment_[0], segment_[1], point}, util::IsLowerThenLefter<T>);
+            segment_[0] = lowest;
+            segment_[1] = highest;
+            return;
+        }
+        // The first triangle, counter-clockwise and with the last vertex at both ends.
+        const bool is_left = Predicates::IsTurnLeft(segment_[0], segment_[1], point);
+        PushBack(point);
+        PushBack(segment_[is_left ? 0 : 1]);
+        PushBack(segment_[is_left ? 1 : 0]);
+        PushBack(point);
+    }
+
+    const Point& At(size_t i) const { return deque_[(first_ + i) & (deque_.size() - 1)]; }
+
+    /**
+     * @brief Doubles the ring buffer when it is full, keeping its capacity a power of two.
+     */
+    void Reserve() {
+        if (size_ < deque_.size()) {
+            return;
+        }
+        std::vector<Point> deque(std::max<size_t>(8, 2 * deque_.size()));
+        for (size_t i = 0; i < size_; ++i) {
+            deque[i] = At(i);
+        }
+        deque_.swap(deque);
+        first_ = 0;
+    }
+
+    void PushBack(const Point& point) {
+        Reserve();
+        deque_[(first_ + size_) & (deque_.size() - 1)] = point;
+        size_++;
+    }
+
+    void PushFront(const Point& point) {
+        Reserve();
+        first_ = (first_ + deque_.size() - 1) & (deque_.size() - 1);
+        deque_[first_] = point;
+        size_++;
+    }
+
+    void PopFront() {
+        first_ = (first_ + 1) & (deque_.size() - 1);
+        size_--;
+    }
+
+    size_t num_points_ = 0;
+    // the distinct vertices before the first triangle, reduced to the ends of their segment
+    Point segment_[2];
+    size_t num_segment_points_ = 0;
+    // the ring buffer of the deque, from first_ on, its capacity a power of two
+    std::vector<Point> deque_;
+    size_t first_ = 0;
+    size_t size_ = 0;
+};
+
+using MelkmanConvexHull = BasicMelkmanConvexHull<double>;
+
+/**
+ * @brief Computes the convex hull of a simple polyline or polygon in O(n) with Melkman's algorithm, see
+ * BasicMelkmanConvexHull.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param polyline The vertices of the polyline in order. A polygon need not repeat its first vertex.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point, empty when the
+ * hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByMelkman(const std::vector<geometry::BasicPoint2D<T>>& polyline) {
+    euclid::util::ScopedHullCall call("melkman");
+    BasicMelkmanConvexHull<T, Predicates> convex_hull;
+    convex_hull.Add(polyline);
+    return convex_hull.GetConvexHull();
+}
+
+}  // namespace euclid::algorithm::convex_hull
@@ -0,0 +1,181 @@
+#pragma once
+
+/**
+ * @file monotone_chain.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief Runs the chain construction of Andrew's monotone chain algorithm on points already sorted by
+ * util::IsLowerThenLefter<T>, inside one buffer.
+ *
+ * The sorted points and the right chain share the first half of the buffer, the left chain grows in its second half.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param buffer Holds the sorted points in its first size entries and has room for size more. Receives the hull
+ * vertices in counter-clockwise order, starting from the lowest then leftest point.
+ * @param size The number of points.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByMonotoneChainOfSorted(geometry::BasicPoint2D<T>* buffer, size_t size) {
+    if (size < 3) {
+        return 0;
+    }
+    euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kScan);
+
+    auto* sorted_points = buffer;
+    auto* left_chain = buffer + size;
+
+    // The right chain overwrites sorted points that have already been consumed, it never holds more than i + 1 points.
+    auto* right_chain = sorted_points;
+    size_t right_size = 0;
+    size_t left_size = 0;
+    for (size_t i = 0; i < size; ++i) {
+        const auto point = sorted_points[i];
+        while (right_size >= 2 &&
+               !Predicates::IsTurnLeft(right_chain[right_size - 2], right_chain[right_size - 1], point)) {
+            right_size--;
+        }
+        right_chain[right_size++] = point;
+        while (left_size >= 2 && !Predicates::IsTurnLeft(point, left_chain[left_size - 1], left_chain[left_size - 2])) {
+            left_size--;
+        }
+        left_chain[left_size++] = point;
+    }
+
+    // Both chains share the lowest and the highest point.
+    const size_t hull_size = right_size + left_size - 2;
+    if (hull_size < 3) {
+        return 0;
+    }
+    for (size_t i = left_size - 2; i > 0; --i) {
+        buffer[right_size++] = left_chain[i];
+    }
+    if constexpr (!util::kIsExactFor<Predicates, T>) {
+        std::rotate(buffer, std::min_element(buffer, buffer + hull_size), buffer + hull_size);
+    }
+    return hull_size;
+}
+
+/**
+ * @brief Runs Andrew's monotone chain algorithm inside one buffer.
+ *
+ * The points are sorted by y, then x, and both chains are built with IsTurnLeft only, so no trigonometry or distance is
+ * evaluated. The sort compares exactly (util::IsLowerThenLefter<T>) and, with util::TolerancePredicates,
+ * Point2D::operator< only picks the first vertex: its tolerance makes it intransitive, and sweeping in that order turns
+ * back on large inputs.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param buffer Holds the points in its first size entries and has room for size more. Receives the hull vertices in
+ * counter-clockwise order, starting from the lowest then leftest point.
+ * @param size The number of points.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByMonotoneChainInPlace(geometry::BasicPoint2D<T>* buffer, size_t size) {
+    euclid::util::ScopedHullCall call("monotone_chain");
+    {
+        euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kSort);
+        std::sort(buffer, buffer + size, euclid::util::CountComparisons(util::IsLowerThenLefter<T>));
+    }
+    return GetConvexHullByMonotoneChainOfSorted<Predicates>(buffer, size);
+}
+
+/**
+ * @brief Computes the convex hull with Andrew's monotone chain algorithm into a caller-provided buffer.
+ *
+ * The buffer doubles as scratch space, see GetConvexHullByMonotoneChainOfSorted. Once its capacity reaches
+ * 2 * input_points.size(), repeated calls do not allocate.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of. Must not alias convex_hull_points.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point. Left empty when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+void GetConvexHullByMonotoneChain(const std::vector<geometry::BasicPoint2D<T>>& input_points,
+                                  std::vector<geometry::BasicPoint2D<T>>& convex_hull_points) {
+    euclid::util::ScopedHullCall call("monotone_chain");
+    const size_t size = input_points.size();
+    convex_hull_points.resize(2 * size);
+    std::copy(input_points.begin(), input_points.end(), convex_hull_points.begin());
+    convex_hull_points.resize(GetConvexHullByMonotoneChainInPlace<Predicates>(convex_hull_points.data(), size));
+}
+
+/**
+ * @brief Computes the convex hull with Andrew's monotone chain algorithm using a reusable workspace.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point, if they fit. input_points.size() entries always suffice.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByMonotoneChain(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                                    std::type_identity_t<std::span<geometry::BasicPoint2D<T>>> convex_hull_points,
+                                    BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("monotone_chain");
+    auto& buffer = workspace.Points();
+    buffer.resize(2 * input_points.size());
+    std::copy(input_points.begin(), input_points.end(), buffer.begin());
+    const size_t hull_size = GetConvexHullByMonotoneChainInPlace<Predicates>(buffer.data(), input_points.size());
+    return CopyConvexHullPoints<T>({buffer.data(), hull_size}, convex_hull_points);
+}
+
+/**
+ * @brief Computes the convex hull with Andrew's monotone chain algorithm using a reusable workspace, into any vector,
+ * e.g. a std::pmr::vector.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point. Left empty when the hull has fewer than 3 vertices.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename Allocator>
+void GetConvexHullByMonotoneChain(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                                  std::vector<geometry::BasicPoint2D<T>, Allocator>& convex_hull_points,
+                                  BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("monotone_chain");
+    auto& buffer = workspace.Points();
+    buffer.resize(2 * input_points.size());
+    std::copy(input_points.begin(), input_points.end(), buffer.begin());
+    const size_t hull_size = GetConvexHullByMonotoneChainInPlace<Predicates>(buffer.data(), input_points.size());
+    convex_hull_points.assign(buffer.begin(), buffer.begin() + hull_size);
+}
+
+/**
+ * @brief Computes the convex hull with Andrew's monotone chain algorithm.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByMonotoneChain(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points) {
+    std::vector<geometry::BasicPoint2D<T>> convex_hull_points;
+    GetConvexHullByMonotoneChain<Predicates>(input_points, convex_hull_points);
+    convex_hull_points.shrink_to_fit();
+    return convex_hull_points;
+}
+
+}  // namespace euclid::algorithm::convex_hull
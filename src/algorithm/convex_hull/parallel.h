@@ -0,0 +1,180 @@
+#pragma once
+
+/**
+ * @file parallel.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief The number of points per chunk of the parallel hull. It does not depend on the number of threads, so neither
+ * does the result.
+ */
+inline constexpr size_t kParallelHullChunkPoints = 1 << 16;
+
+/**
+ * @brief Reduces points sorted by util::IsLowerThenLefter<T> to the vertices of their convex hull, still sorted, in
+ * linear time.
+ *
+ * Builds both chains of the monotone chain algorithm, which come out sorted as well, and merges them. Collinear and
+ * coincident points reduce to the two extremes.
+ *
+ * @param sorted_points The sorted points.
+ * @param chains Scratch space for 2 * sorted_points.size() points.
+ * @param hull_vertices Room for sorted_points.size() points, receives the sorted hull vertices. May alias
+ * sorted_points.
+ * @return The number of hull vertices.
+ */
+template <typename Predicates, typename T>
+size_t ReduceToSortedHullVertices(std::span<const geometry::BasicPoint2D<T>> sorted_points,
+                                  geometry::BasicPoint2D<T>* chains, geometry::BasicPoint2D<T>* hull_vertices) {
+    const size_t size = sorted_points.size();
+    auto* right_chain = chains;
+    auto* left_chain = chains + size;
+    size_t right_size = 0;
+    size_t left_size = 0;
+    for (const auto& point : sorted_points) {
+        while (right_size >= 2 &&
+               !Predicates::IsTurnLeft(right_chain[right_size - 2], right_chain[right_size - 1], point)) {
+            right_size--;
+        }
+        right_chain[right_size++] = point;
+        while (left_size >= 2 && !Predicates::IsTurnLeft(point, left_chain[left_size - 1], left_chain[left_size - 2])) {
+            left_size--;
+        }
+        left_chain[left_size++] = point;
+    }
+    // The chains share their first and last point.
+    if (left_size <= 2) {
+        return static_cast<size_t>(std::copy(right_chain, right_chain + right_size, hull_vertices) - hull_vertices);
+    }
+    return static_cast<size_t>(std::merge(right_chain, right_chain + right_size, left_chain + 1,
+                                          left_chain + left_size - 1, hull_vertices, util::IsLowerThenLefter<T>) -
+                               hull_vertices);
+}
+
+/**
+ * @brief Computes the convex hull of a large point set on several threads.
+ *
+ * The input is split into chunks of kParallelHullChunkPoints points, and the hull of every chunk is computed
+ * concurrently with Quickhull. Each chunk hull is then sorted, and the hulls are merged pairwise in a fixed tree, also
+ * concurrently. Two sorted vertex sets are merged in linear time, and ReduceToSortedHullVertices drops the vertices
+ * that are not on the combined hull. No global sort happens, so a parallel std::sort is never needed. The last set runs
+ * through the chains of the monotone chain algorithm.
+ *
+ * Every vertex of the hull is a vertex of the hull of its chunk, so with an exact predicate policy or integer
+ * coordinates the result equals that of the sequential algorithms with the same policy, vertex for vertex. That is why
+ * the policy defaults to util::AdaptivePredicates here. With util::TolerancePredicates, which vertices nearly collinear
+ * within the tolerance are kept depends on the order of evaluation, so the result may differ from the sequential
+ * algorithms in such vertices, but never between runs or numbers of threads.
+ *
+ * @tparam Predicates The predicate policy, util::AdaptivePredicates by default or util::TolerancePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param thread_pool The threads to run on.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::AdaptivePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullInParallel(std::span<const geometry::BasicPoint2D<T>> input_points,
+                                                               euclid::util::ThreadPool& thread_pool) {
+    euclid::util::ScopedHullCall call("parallel");
+    const size_t size = input_points.size();
+    const size_t num_chunks = std::max<size_t>(1, (size + kParallelHullChunkPoints - 1) / kParallelHullChunkPoints);
+
+    // Every chunk ends up as its hull vertices sorted by util::IsLowerThenLefter<T>.
+    std::vector<std::vector<geometry::BasicPoint2D<T>>> vertex_sets(num_chunks);
+    std::vector<BasicHullWorkspace<T>> workspaces(thread_pool.NumThreads());
+    thread_pool.ParallelFor(num_chunks, [&](size_t chunk, size_t thread) {
+        auto chunk_points = input_points.subspan(size * chunk / num_chunks,
+                                                 size * (chunk + 1) / num_chunks - size * chunk / num_chunks);
+        auto& workspace = workspaces[thread];
+        auto& vertices = vertex_sets[chunk];
+        GetConvexHullByQuickHull<Predicates>(chunk_points, vertices, workspace);
+        if (vertices.empty()) {
+            // Fewer than 3 points or all collinear, the two extremes stand for the chunk.
+            if (!chunk_points.empty()) {
+                auto [min_it, max_it] =
+                    std::minmax_element(chunk_points.begin(), chunk_points.end(), util::IsLowerThenLefter<T>);
+                vertices.push_back(*min_it);
+                vertices.push_back(*max_it);
+            }
+            return;
+        }
+        euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kSort);
+        std::sort(vertices.begin(), vertices.end(), euclid::util::CountComparisons(util::IsLowerThenLefter<T>));
+    });
+
+    for (size_t stride = 1; stride < num_chunks; stride *= 2) {
+        const size_t num_merges = (num_chunks + 2 * stride - 1) / (2 * stride);
+        thread_pool.ParallelFor(num_merges, [&](size_t merge, size_t thread) {
+            const size_t first = 2 * stride * merge;
+            const size_t second = first + stride;
+            if (second >= num_chunks) {
+                return;
+            }
+            euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kMerge);
+            auto& merged = workspaces[thread].GroupPoints();
+            auto& chains = workspaces[thread].Points();
+            auto& vertices = vertex_sets[first];
+            merged.resize(vertices.size() + vertex_sets[second].size());
+            std::merge(vertices.begin(), vertices.end(), vertex_sets[second].begin(), vertex_sets[second].end(),
+                       merged.begin(), util::IsLowerThenLefter<T>);
+            chains.resize(2 * merged.size());
+            vertices.resize(merged.size());
+            vertices.resize(ReduceToSortedHullVertices<Predicates, T>(merged, chains.data(), vertices.data()));
+            std::vector<geometry::BasicPoint2D<T>>().swap(vertex_sets[second]);
+        });
+    }
+
+    auto& vertices = vertex_sets[0];
+    const size_t num_vertices = vertices.size();
+    vertices.resize(2 * num_vertices);
+    vertices.resize(GetConvexHullByMonotoneChainOfSorted<Predicates>(vertices.data(), num_vertices));
+    return std::move(vertices);
+}
+
+/**
+ * @brief Computes the convex hull of a large point set on several threads.
+ *
+ * @tparam Predicates The predicate policy, util::AdaptivePredicates by default or util::TolerancePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param thread_pool The threads to run on.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::AdaptivePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullInParallel(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points, euclid::util::ThreadPool& thread_pool) {
+    return GetConvexHullInParallel<Predicates>(std::span<const geometry::BasicPoint2D<T>>(input_points), thread_pool);
+}
+
+/**
+ * @brief Computes the convex hull of a large point set on a temporary pool of num_threads threads.
+ *
+ * @tparam Predicates The predicate policy, util::AdaptivePredicates by default or util::TolerancePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param num_threads The number of threads, 0 for the number of hardware threads.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::AdaptivePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullInParallel(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points, size_t num_threads) {
+    euclid::util::ThreadPool thread_pool(num_threads);
+    return GetConvexHullInParallel<Predicates>(input_points, thread_pool);
+}
+
+}  // namespace euclid::algorithm::convex_hull
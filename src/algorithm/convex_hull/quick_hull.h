@@ -0,0 +1,686 @@
+#pragma once
+
+/**
+ * @file quick_hull.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/compare.h"
+#include "util/instrumentation.h"
+#include "util/simd.h"
+
+namespace euclid::algorithm::convex_hull {
+
+static_assert(sizeof(geometry::Point2D) == 2 * sizeof(double), "the kernels read points as interleaved x, y doubles");
+
+/**
+ * @brief Number of directions scanned for the Akl-Toussaint octagon.
+ */
+inline constexpr size_t kNumOctagonDirections = 8;
+
+/**
+ * @brief The recursion depth of Quickhull past which the points right of an edge are scanned like in Andrew's
+ * monotone chain instead, for inputs like points on a curve, where every step of the recursion may split off only a
+ * few points.
+ */
+inline constexpr size_t kQuickHullMaxDepth = 64;
+
+/**
+ * @brief Finds the extreme points in the axis and diagonal directions without vectorization.
+ *
+ * @param points The points to scan, at least one.
+ * @param size The number of points.
+ * @param indices Receives the first index of the point with minimal y, maximal x - y, maximal x, maximal x + y, maximal
+ * y, minimal x - y, minimal x and minimal x + y, i.e. the octagon vertices in counter-clockwise order.
+ */
+template <typename T>
+inline void FindOctagonExtremeIndicesScalar(const geometry::BasicPoint2D<T>* points, size_t size, size_t* indices) {
+    // Sums and differences of integer coordinates are evaluated in the wider accumulator type.
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+    Accumulator max_values[4];
+    Accumulator min_values[4];
+    size_t max_indices[4] = {0, 0, 0, 0};
+    size_t min_indices[4] = {0, 0, 0, 0};
+    auto Project = [](const geometry::BasicPoint2D<T>& point, Accumulator* values) {
+        values[0] = point.coords[0];
+        values[1] = point.coords[1];
+        values[2] = Accumulator(point.coords[0]) + Accumulator(point.coords[1]);
+        values[3] = Accumulator(point.coords[0]) - Accumulator(point.coords[1]);
+    };
+    Project(points[0], max_values);
+    Project(points[0], min_values);
+    for (size_t i = 1; i < size; ++i) {
+        Accumulator values[4];
+        Project(points[i], values);
+        for (size_t k = 0; k < 4; ++k) {
+            if (values[k] > max_values[k]) {
+                max_values[k] = values[k];
+                max_indices[k] = i;
+            }
+            if (values[k] < min_values[k]) {
+                min_values[k] = values[k];
+                min_indices[k] = i;
+            }
+        }
+    }
+    indices[0] = min_indices[1];
+    indices[1] = max_indices[3];
+    indices[2] = max_indices[0];
+    indices[3] = max_indices[2];
+    indices[4] = max_indices[1];
+    indices[5] = min_indices[3];
+    indices[6] = min_indices[0];
+    indices[7] = min_indices[2];
+}
+
+/**
+ * @brief Finds the point farthest to the right of the directed line p -> q without vectorization.
+ *
+ * The cross product of util::IsTurnLeft is evaluated as r.y * (q.x - p.x) - r.x * (q.y - p.y) plus a term that does
+ * not depend on r, which is dropped.
+ *
+ * @param points The points to scan, at least one.
+ * @param size The number of points.
+ * @param p The start of the line.
+ * @param q The end of the line.
+ * @return The first index of a point with the smallest cross product.
+ */
+template <typename T>
+inline size_t FindFarthestRightIndexScalar(const geometry::BasicPoint2D<T>* points, size_t size,
+                                           const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q) {
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+    const Accumulator dx = Accumulator(q.coords[0]) - Accumulator(p.coords[0]);
+    const Accumulator neg_dy = Accumulator(p.coords[1]) - Accumulator(q.coords[1]);
+    auto Value = [&](const geometry::BasicPoint2D<T>& point) {
+        return Accumulator(point.coords[0]) * neg_dy + Accumulator(point.coords[1]) * dx;
+    };
+    Accumulator best_value = Value(points[0]);
+    size_t best_index = 0;
+    for (size_t i = 1; i < size; ++i) {
+        Accumulator value = Value(points[i]);
+        if (value < best_value) {
+            best_value = value;
+            best_index = i;
+        }
+    }
+    return best_index;
+}
+
+#if defined(EUCLID_X86_64)
+
+/**
+ * @brief SSE2 version of FindOctagonExtremeIndicesScalar, two points per iteration.
+ */
+inline void FindOctagonExtremeIndicesSse2(const geometry::Point2D* points, size_t size, size_t* indices) {
+    const double* data = points[0].coords;
+    // Lane k holds the extremes of the points with index = k (mod 2), projections x, y, x + y and x - y.
+    __m128d max_values[4];
+    __m128d min_values[4];
+    __m128d max_indices[4];
+    __m128d min_indices[4];
+    const __m128d inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    const __m128d neg_inf = _mm_set1_pd(-std::numeric_limits<double>::infinity());
+    for (size_t k = 0; k < 4; ++k) {
+        max_values[k] = neg_inf;
+        min_values[k] = inf;
+        max_indices[k] = _mm_setzero_pd();
+        min_indices[k] = _mm_setzero_pd();
+    }
+    auto Select = [](__m128d mask, __m128d a, __m128d b) {
+        return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+    };
+    __m128d index = _mm_setr_pd(0.0, 1.0);
+    const __m128d step = _mm_set1_pd(2.0);
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        __m128d a = _mm_loadu_pd(data + 2 * i);
+        __m128d b = _mm_loadu_pd(data + 2 * i + 2);
+        __m128d values[4];
+        values[0] = _mm_unpacklo_pd(a, b);
+        values[1] = _mm_unpackhi_pd(a, b);
+        values[2] = _mm_add_pd(values[0], values[1]);
+        values[3] = _mm_sub_pd(values[0], values[1]);
+        for (size_t k = 0; k < 4; ++k) {
+            __m128d greater = _mm_cmpgt_pd(values[k], max_values[k]);
+            max_values[k] = Select(greater, values[k], max_values[k]);
+            max_indices[k] = Select(greater, index, max_indices[k]);
+            __m128d less = _mm_cmplt_pd(values[k], min_values[k]);
+            min_values[k] = Select(less, values[k], min_values[k]);
+            min_indices[k] = Select(less, index, min_indices[k]);
+        }
+        index = _mm_add_pd(index, step);
+    }
+
+    double lane_values[2];
+    double lane_indices[2];
+    double max_result[4];
+    double min_result[4];
+    size_t max_result_indices[4];
+    size_t min_result_indices[4];
+    for (size_t k = 0; k < 4; ++k) {
+        _mm_storeu_pd(lane_values, max_values[k]);
+        _mm_storeu_pd(lane_indices, max_indices[k]);
+        max_result[k] = lane_values[0];
+        max_result_indices[k] = static_cast<size_t>(lane_indices[0]);
+        if (lane_values[1] > max_result[k] ||
+            (lane_values[1] == max_result[k] && static_cast<size_t>(lane_indices[1]) < max_result_indices[k])) {
+            max_result[k] = lane_values[1];
+            max_result_indices[k] = static_cast<size_t>(lane_indices[1]);
+        }
+        _mm_storeu_pd(lane_values, min_values[k]);
+        _mm_storeu_pd(lane_indices, min_indices[k]);
+        min_result[k] = lane_values[0];
+        min_result_indices[k] = static_cast<size_t>(lane_indices[0]);
+        if (lane_values[1] < min_result[k] ||
+            (lane_values[1] == min_result[k] && static_cast<size_t>(lane_indices[1]) < min_result_indices[k])) {
+            min_result[k] = lane_values[1];
+            min_result_indices[k] = static_cast<size_t>(lane_indices[1]);
+        }
+    }
+    for (; i < size; ++i) {
+        double values[4] = {points[i].coords[0], points[i].coords[1], points[i].coords[0] + points[i].coords[1],
+                            points[i].coords[0] - points[i].coords[1]};
+        for (size_t k = 0; k < 4; ++k) {
+            if (values[k] > max_result[k]) {
+                max_result[k] = values[k];
+                max_result_indices[k] = i;
+            }
+            if (values[k] < min_result[k]) {
+                min_result[k] = values[k];
+                min_result_indices[k] = i;
+            }
+        }
+    }
+    indices[0] = min_result_indices[1];
+    indices[1] = max_result_indices[3];
+    indices[2] = max_result_indices[0];
+    indices[3] = max_result_indices[2];
+    indices[4] = max_result_indices[1];
+    indices[5] = min_result_indices[3];
+    indices[6] = min_result_indices[0];
+    indices[7] = min_result_indices[2];
+}
+
+/**
+ * @brief AVX2 version of FindOctagonExtremeIndicesScalar, four points per iteration.
+ */
+EUCLID_TARGET_AVX2 inline void FindOctagonExtremeIndicesAvx2(const geometry::Point2D* points, size_t size,
+                                                             size_t* indices) {
+    const double* data = points[0].coords;
+    // Lanes hold the points with index = 0, 2, 1, 3 (mod 4), the order produced by unpacking two loads.
+    __m256d max_values[4];
+    __m256d min_values[4];
+    __m256d max_indices[4];
+    __m256d min_indices[4];
+    const __m256d inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    const __m256d neg_inf = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+    for (size_t k = 0; k < 4; ++k) {
+        max_values[k] = neg_inf;
+        min_values[k] = inf;
+        max_indices[k] = _mm256_setzero_pd();
+        min_indices[k] = _mm256_setzero_pd();
+    }
+    __m256d index = _mm256_setr_pd(0.0, 2.0, 1.0, 3.0);
+    const __m256d step = _mm256_set1_pd(4.0);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256d a = _mm256_loadu_pd(data + 2 * i);
+        __m256d b = _mm256_loadu_pd(data + 2 * i + 4);
+        __m256d values[4];
+        values[0] = _mm256_unpacklo_pd(a, b);
+        values[1] = _mm256_unpackhi_pd(a, b);
+        values[2] = _mm256_add_pd(values[0], values[1]);
+        values[3] = _mm256_sub_pd(values[0], values[1]);
+        for (size_t k = 0; k < 4; ++k) {
+            __m256d greater = _mm256_cmp_pd(values[k], max_values[k], _CMP_GT_OQ);
+            max_values[k] = _mm256_blendv_pd(max_values[k], values[k], greater);
+            max_indices[k] = _mm256_blendv_pd(max_indices[k], index, greater);
+            __m256d less = _mm256_cmp_pd(values[k], min_values[k], _CMP_LT_OQ);
+            min_values[k] = _mm256_blendv_pd(min_values[k], values[k], less);
+            min_indices[k] = _mm256_blendv_pd(min_indices[k], index, less);
+        }
+        index = _mm256_add_pd(index, step);
+    }
+
+    double lane_values[4];
+    double lane_indices[4];
+    double max_result[4];
+    double min_result[4];
+    size_t max_result_indices[4];
+    size_t min_result_indices[4];
+    for (size_t k = 0; k < 4; ++k) {
+        max_result[k] = -std::numeric_limits<double>::infinity();
+        max_result_indices[k] = 0;
+        _mm256_storeu_pd(lane_values, max_values[k]);
+        _mm256_storeu_pd(lane_indices, max_indices[k]);
+        for (size_t lane = 0; lane < 4; ++lane) {
+            auto lane_index = static_cast<size_t>(lane_indices[lane]);
+            if (lane_values[lane] > max_result[k] ||
+                (lane_values[lane] == max_result[k] && lane_index < max_result_indices[k])) {
+                max_result[k] = lane_values[lane];
+                max_result_indices[k] = lane_index;
+            }
+        }
+        min_result[k] = std::numeric_limits<double>::infinity();
+        min_result_indices[k] = 0;
+        _mm256_storeu_pd(lane_values, min_values[k]);
+        _mm256_storeu_pd(lane_indices, min_indices[k]);
+        for (size_t lane = 0; lane < 4; ++lane) {
+            auto lane_index = static_cast<size_t>(lane_indices[lane]);
+            if (lane_values[lane] < min_result[k] ||
+                (lane_values[lane] == min_result[k] && lane_index < min_result_indices[k])) {
+                min_result[k] = lane_values[lane];
+                min_result_indices[k] = lane_index;
+            }
+        }
+    }
+    for (; i < size; ++i) {
+        double values[4] = {points[i].coords[0], points[i].coords[1], points[i].coords[0] + points[i].coords[1],
+                            points[i].coords[0] - points[i].coords[1]};
+        for (size_t k = 0; k < 4; ++k) {
+            if (values[k] > max_result[k]) {
+                max_result[k] = values[k];
+                max_result_indices[k] = i;
+            }
+            if (values[k] < min_result[k]) {
+                min_result[k] = values[k];
+                min_result_indices[k] = i;
+            }
+        }
+    }
+    indices[0] = min_result_indices[1];
+    indices[1] = max_result_indices[3];
+    indices[2] = max_result_indices[0];
+    indices[3] = max_result_indices[2];
+    indices[4] = max_result_indices[1];
+    indices[5] = min_result_indices[3];
+    indices[6] = min_result_indices[0];
+    indices[7] = min_result_indices[2];
+}
+
+/**
+ * @brief SSE2 version of FindFarthestRightIndexScalar, two points per iteration.
+ */
+inline size_t FindFarthestRightIndexSse2(const geometry::Point2D* points, size_t size, const geometry::Point2D& p,
+                                         const geometry::Point2D& q) {
+    const double* data = points[0].coords;
+    const double dx = q.coords[0] - p.coords[0];
+    const double neg_dy = p.coords[1] - q.coords[1];
+    const __m128d dx_vector = _mm_set1_pd(dx);
+    const __m128d neg_dy_vector = _mm_set1_pd(neg_dy);
+    __m128d best_values = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    __m128d best_indices = _mm_setzero_pd();
+    __m128d index = _mm_setr_pd(0.0, 1.0);
+    const __m128d step = _mm_set1_pd(2.0);
+    size_t i = 0;
+    for (; i + 2 <= size; i += 2) {
+        __m128d a = _mm_loadu_pd(data + 2 * i);
+        __m128d b = _mm_loadu_pd(data + 2 * i + 2);
+        __m128d values = _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(a, b), neg_dy_vector),
+                                    _mm_mul_pd(_mm_unpackhi_pd(a, b), dx_vector));
+        __m128d less = _mm_cmplt_pd(values, best_values);
+        best_values = _mm_or_pd(_mm_and_pd(less, values), _mm_andnot_pd(less, best_values));
+        best_indices = _mm_or_pd(_mm_and_pd(less, index), _mm_andnot_pd(less, best_indices));
+        index = _mm_add_pd(index, step);
+    }
+    double lane_values[2];
+    double lane_indices[2];
+    _mm_storeu_pd(lane_values, best_values);
+    _mm_storeu_pd(lane_indices, best_indices);
+    double best_value = lane_values[0];
+    auto best_index = static_cast<size_t>(lane_indices[0]);
+    if (lane_values[1] < best_value ||
+        (lane_values[1] == best_value && static_cast<size_t>(lane_indices[1]) < best_index)) {
+        best_value = lane_values[1];
+        best_index = static_cast<size_t>(lane_indices[1]);
+    }
+    for (; i < size; ++i) {
+        double value = points[i].coords[0] * neg_dy + points[i].coords[1] * dx;
+        if (value < best_value) {
+            best_value = value;
+            best_index = i;
+        }
+    }
+    return best_index;
+}
+
+/**
+ * @brief AVX2 version of FindFarthestRightIndexScalar, four points per iteration.
+ */
+EUCLID_TARGET_AVX2 inline size_t FindFarthestRightIndexAvx2(const geometry::Point2D* points, size_t size,
+                                                            const geometry::Point2D& p, const geometry::Point2D& q) {
+    const double* data = points[0].coords;
+    const double dx = q.coords[0] - p.coords[0];
+    const double neg_dy = p.coords[1] - q.coords[1];
+    const __m256d dx_vector = _mm256_set1_pd(dx);
+    const __m256d neg_dy_vector = _mm256_set1_pd(neg_dy);
+    __m256d best_values = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    __m256d best_indices = _mm256_setzero_pd();
+    __m256d index = _mm256_setr_pd(0.0, 2.0, 1.0, 3.0);
+    const __m256d step = _mm256_set1_pd(4.0);
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        __m256d a = _mm256_loadu_pd(data + 2 * i);
+        __m256d b = _mm256_loadu_pd(data + 2 * i + 4);
+        __m256d values = _mm256_add_pd(_mm256_mul_pd(_mm256_unpacklo_pd(a, b), neg_dy_vector),
+                                       _mm256_mul_pd(_mm256_unpackhi_pd(a, b), dx_vector));
+        __m256d less = _mm256_cmp_pd(values, best_values, _CMP_LT_OQ);
+        best_values = _mm256_blendv_pd(best_values, values, less);
+        best_indices = _mm256_blendv_pd(best_indices, index, less);
+        index = _mm256_add_pd(index, step);
+    }
+    double lane_values[4];
+    double lane_indices[4];
+    _mm256_storeu_pd(lane_values, best_values);
+    _mm256_storeu_pd(lane_indices, best_indices);
+    double best_value = std::numeric_limits<double>::infinity();
+    size_t best_index = 0;
+    for (size_t lane = 0; lane < 4; ++lane) {
+        auto lane_index = static_cast<size_t>(lane_indices[lane]);
+        if (lane_values[lane] < best_value || (lane_values[lane] == best_value && lane_index < best_index)) {
+            best_value = lane_values[lane];
+            best_index = lane_index;
+        }
+    }
+    for (; i < size; ++i) {
+        double value = points[i].coords[0] * neg_dy + points[i].coords[1] * dx;
+        if (value < best_value) {
+            best_value = value;
+            best_index = i;
+        }
+    }
+    return best_index;
+}
+
+#endif
+
+/**
+ * @brief Finds the extreme points in the axis and diagonal directions, see FindOctagonExtremeIndicesScalar.
+ *
+ * Dispatches to the AVX2 or SSE2 kernel according to util::GetSimdLevel for double coordinates, other coordinate
+ * types use the scalar kernel.
+ */
+template <typename T>
+inline void FindOctagonExtremeIndices(const geometry::BasicPoint2D<T>* points, size_t size, size_t* indices) {
+#if defined(EUCLID_X86_64)
+    if constexpr (std::is_same_v<T, double>) {
+        switch (euclid::util::GetSimdLevel()) {
+            case euclid::util::SimdLevel::kAvx512:
+            case euclid::util::SimdLevel::kAvx2:
+                return FindOctagonExtremeIndicesAvx2(points, size, indices);
+            case euclid::util::SimdLevel::kSse2:
+                return FindOctagonExtremeIndicesSse2(points, size, indices);
+            default:
+                break;
+        }
+    }
+#endif
+    FindOctagonExtremeIndicesScalar(points, size, indices);
+}
+
+/**
+ * @brief Finds the point farthest to the right of the directed line p -> q, see FindFarthestRightIndexScalar.
+ *
+ * Dispatches to the AVX2 or SSE2 kernel according to util::GetSimdLevel for double coordinates, other coordinate
+ * types use the scalar kernel.
+ */
+template <typename T>
+inline size_t FindFarthestRightIndex(const geometry::BasicPoint2D<T>* points, size_t size,
+                                     const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q) {
+#if defined(EUCLID_X86_64)
+    if constexpr (std::is_same_v<T, double>) {
+        switch (euclid::util::GetSimdLevel()) {
+            case euclid::util::SimdLevel::kAvx512:
+            case euclid::util::SimdLevel::kAvx2:
+                return FindFarthestRightIndexAvx2(points, size, p, q);
+            case euclid::util::SimdLevel::kSse2:
+                return FindFarthestRightIndexSse2(points, size, p, q);
+            default:
+                break;
+        }
+    }
+#endif
+    return FindFarthestRightIndexScalar(points, size, p, q);
+}
+
+/**
+ * @brief Determines if r lies strictly right of the directed line p -> q, the complement of IsTurnLeft and
+ * ArePointsCollinear of the predicate policy.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+bool IsTurnRight(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                 const geometry::BasicPoint2D<T>& r) {
+    return Predicates::GetOrientation(p, q, r) < 0;
+}
+
+/**
+ * @brief Appends the hull vertices strictly between p and q like QuickHullRecursive, by sorting the points and keeping
+ * the left turns like Andrew's monotone chain.
+ *
+ * The hull between the extreme points of two neighbouring octagon directions, and so between any two of its vertices,
+ * has edges in a 45 degree sector, within the quadrant of q - p. It is therefore monotone in the order by x, then y,
+ * each flipped to increase along q - p, which is compared exactly.
+ */
+template <typename Predicates, typename T>
+void QuickHullByMonotoneScan(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                             geometry::BasicPoint2D<T>* first, geometry::BasicPoint2D<T>* last,
+                             geometry::BasicPoint2D<T>* convex_hull_points, size_t& hull_size) {
+    const bool is_x_increasing = q.coords[0] >= p.coords[0];
+    const bool is_y_increasing = q.coords[1] >= p.coords[1];
+    std::sort(first, last, [&](const geometry::BasicPoint2D<T>& a, const geometry::BasicPoint2D<T>& b) {
+        if (a.coords[0] != b.coords[0]) {
+            return (a.coords[0] < b.coords[0]) == is_x_increasing;
+        }
+        return a.coords[1] != b.coords[1] && (a.coords[1] < b.coords[1]) == is_y_increasing;
+    });
+    const size_t begin = hull_size;
+    for (auto* it = first; it != last + 1; ++it) {
+        const auto& point = it == last ? q : *it;
+        while (hull_size > begin &&
+               !Predicates::IsTurnLeft(hull_size - begin >= 2 ? convex_hull_points[hull_size - 2] : p,
+                                       convex_hull_points[hull_size - 1], point)) {
+            hull_size--;
+        }
+        if (it != last) {
+            convex_hull_points[hull_size++] = point;
+        }
+    }
+}
+
+/**
+ * @brief Appends the hull vertices strictly between p and q, all points in [first, last) lie right of p -> q. Past
+ * kQuickHullMaxDepth, the points are handed to QuickHullByMonotoneScan, so that the depth stays bounded.
+ */
+template <typename Predicates, typename T>
+void QuickHullRecursive(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                        geometry::BasicPoint2D<T>* first, geometry::BasicPoint2D<T>* last,
+                        geometry::BasicPoint2D<T>* convex_hull_points, size_t& hull_size, size_t depth = 0) {
+    if (first == last) {
+        return;
+    }
+    if (depth == kQuickHullMaxDepth) {
+        QuickHullByMonotoneScan<Predicates>(p, q, first, last, convex_hull_points, hull_size);
+        return;
+    }
+    const auto farthest_point = first[FindFarthestRightIndex(first, static_cast<size_t>(last - first), p, q)];
+    auto* middle = std::partition(first, last, [&](const geometry::BasicPoint2D<T>& point) {
+        return IsTurnRight<Predicates>(p, farthest_point, point);
+    });
+    auto* end = std::partition(middle, last, [&](const geometry::BasicPoint2D<T>& point) {
+        return IsTurnRight<Predicates>(farthest_point, q, point);
+    });
+    QuickHullRecursive<Predicates>(p, farthest_point, first, middle, convex_hull_points, hull_size, depth + 1);
+    convex_hull_points[hull_size++] = farthest_point;
+    QuickHullRecursive<Predicates>(farthest_point, q, middle, end, convex_hull_points, hull_size, depth + 1);
+}
+
+/**
+ * @brief Computes the convex hull with Quickhull after an Akl-Toussaint pre-filter, into caller-provided buffers.
+ *
+ * The extreme points in the 8 axis and diagonal directions form a convex octagon, every point inside it is discarded
+ * and every other point is assigned to the first octagon edge it lies right of before recursing. The extreme scan and
+ * the farthest point scan are vectorized with AVX2 or SSE2, chosen at runtime. The farthest point only steers the
+ * recursion, which side of an edge a point lies on is always decided by the predicate policy.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param points Scratch space for input_points.size() points.
+ * @param convex_hull_points Room for input_points.size() + kNumOctagonDirections points, receives the hull vertices in
+ * counter-clockwise order, starting from the lowest then leftest point.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByQuickHullWithBuffers(std::span<const geometry::BasicPoint2D<T>> input_points,
+                                           geometry::BasicPoint2D<T>* points,
+                                           geometry::BasicPoint2D<T>* convex_hull_points) {
+    euclid::util::ScopedHullCall call("quick_hull");
+    if (input_points.size() < 3) {
+        return 0;
+    }
+
+    size_t extreme_indices[kNumOctagonDirections];
+    {
+        euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kFilter);
+        FindOctagonExtremeIndices(input_points.data(), input_points.size(), extreme_indices);
+    }
+    euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kScan);
+    geometry::BasicPoint2D<T> octagon[kNumOctagonDirections];
+    size_t octagon_size = 0;
+    for (size_t i = 0; i < kNumOctagonDirections; ++i) {
+        const auto& point = input_points[extreme_indices[i]];
+        if (octagon_size == 0 || !Predicates::AreCoincident(octagon[octagon_size - 1], point)) {
+            octagon[octagon_size++] = point;
+        }
+    }
+    while (octagon_size > 1 && Predicates::AreCoincident(octagon[octagon_size - 1], octagon[0])) {
+        octagon_size--;
+    }
+    if (octagon_size < 2) {
+        return 0;
+    }
+
+    std::copy(input_points.begin(), input_points.end(), points);
+    size_t num_candidates = 0;
+    auto* first = points;
+    auto* last = points + input_points.size();
+    for (size_t i = 0; i < octagon_size; ++i) {
+        const auto& p = octagon[i];
+        const auto& q = octagon[(i + 1) % octagon_size];
+        auto* middle = std::partition(first, last, [&](const geometry::BasicPoint2D<T>& point) {
+            return IsTurnRight<Predicates>(p, q, point);
+        });
+        convex_hull_points[num_candidates++] = p;
+        QuickHullRecursive<Predicates>(p, q, first, middle, convex_hull_points, num_candidates);
+        first = middle;
+    }
+
+    // Ties between extremes may leave coincident or collinear octagon vertices behind.
+    size_t hull_size = 0;
+    for (size_t i = 0; i < num_candidates; ++i) {
+        const auto point = convex_hull_points[i];
+        while (hull_size >= 2 &&
+               !Predicates::IsTurnLeft(convex_hull_points[hull_size - 2], convex_hull_points[hull_size - 1], point)) {
+            hull_size--;
+        }
+        convex_hull_points[hull_size++] = point;
+    }
+    size_t begin = 0;
+    while (hull_size - begin >= 3) {
+        if (!Predicates::IsTurnLeft(convex_hull_points[hull_size - 2], convex_hull_points[hull_size - 1],
+                                    convex_hull_points[begin])) {
+            hull_size--;
+        } else if (!Predicates::IsTurnLeft(convex_hull_points[hull_size - 1], convex_hull_points[begin],
+                                           convex_hull_points[begin + 1])) {
+            begin++;
+        } else {
+            break;
+        }
+    }
+    std::copy(convex_hull_points + begin, convex_hull_points + hull_size, convex_hull_points);
+    hull_size -= begin;
+    if (hull_size < 3) {
+        return 0;
+    }
+
+    auto* hull_end = convex_hull_points + hull_size;
+    if constexpr (util::kIsExactFor<Predicates, T>) {
+        std::rotate(convex_hull_points, std::min_element(convex_hull_points, hull_end, util::IsLowerThenLefter<T>),
+                    hull_end);
+    } else {
+        std::rotate(convex_hull_points, std::min_element(convex_hull_points, hull_end), hull_end);
+    }
+    return hull_size;
+}
+
+/**
+ * @brief Computes the convex hull with Quickhull using a reusable workspace.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point, if they fit. input_points.size() entries always suffice.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ * @return The number of hull vertices, 0 when the hull has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetConvexHullByQuickHull(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                                std::type_identity_t<std::span<geometry::BasicPoint2D<T>>> convex_hull_points,
+                                BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("quick_hull");
+    workspace.Points().resize(input_points.size());
+    workspace.HullPoints().resize(input_points.size() + kNumOctagonDirections);
+    const size_t hull_size = GetConvexHullByQuickHullWithBuffers<Predicates>(input_points, workspace.Points().data(),
+                                                                             workspace.HullPoints().data());
+    return CopyConvexHullPoints<T>({workspace.HullPoints().data(), hull_size}, convex_hull_points);
+}
+
+/**
+ * @brief Computes the convex hull with Quickhull using a reusable workspace, into any vector, e.g. a std::pmr::vector.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point. Left empty when the hull has fewer than 3 vertices.
+ * @param workspace The scratch memory, no allocation happens once it has served an input of this size.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename Allocator>
+void GetConvexHullByQuickHull(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> input_points,
+                              std::vector<geometry::BasicPoint2D<T>, Allocator>& convex_hull_points,
+                              BasicHullWorkspace<T>& workspace) {
+    euclid::util::ScopedHullCall call("quick_hull");
+    workspace.Points().resize(input_points.size());
+    workspace.HullPoints().resize(input_points.size() + kNumOctagonDirections);
+    const size_t hull_size = GetConvexHullByQuickHullWithBuffers<Predicates>(input_points, workspace.Points().data(),
+                                                                             workspace.HullPoints().data());
+    convex_hull_points.assign(workspace.HullPoints().begin(), workspace.HullPoints().begin() + hull_size);
+}
+
+/**
+ * @brief Computes the convex hull with Quickhull after an Akl-Toussaint pre-filter.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param input_points The points to compute the convex hull of.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetConvexHullByQuickHull(
+    const std::vector<geometry::BasicPoint2D<T>>& input_points) {
+    BasicHullWorkspace<T> workspace;
+    std::vector<geometry::BasicPoint2D<T>> convex_hull_points;
+    GetConvexHullByQuickHull<Predicates>(input_points, convex_hull_points, workspace);
+    return convex_hull_points;
+}
+
+}  // namespace euclid::algorithm::convex_hull
@@ -0,0 +1,644 @@
+#pragma once
+
+/**
+ * @file sliding_window.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/scalar_traits.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief The convex hull of a window of points sliding over a stream: points enter at the back and leave at the
+ * front, e.g. the fixes of the last N seconds of a track.
+ *
+ * The window is a queue made of two stacks. The back half holds the points pushed since the front half was last
+ * built, the front half the older ones. Each half keeps the hull of its points as the two chains of the monotone chain
+ * algorithm, every chain in a treap with its vertices also linked in chain order. A push inserts the point into the
+ * chains of the back half in O(log h) amortized, removing the vertices it makes non-convex. The front half is built
+ * from all points of the back half once it runs empty, newest first, recording what every insertion changed, so a pop
+ * undoes the insertion of the oldest point in time proportional to its changes. Every point is inserted into two
+ * halves and undone once, so both operations take O(log h) amortized expected time.
+ *
+ * Extreme point queries take the better of the extreme points of both halves, found in O(log h) in their treaps. The
+ * other queries merge the vertices of both halves into the hull of the window once per change of the window, in O(h),
+ * then enumerate it directly or find tangents by binary searches over its chains in O(log h).
+ *
+ * Coincident points are counted, the hull has no collinear vertices.
+ *
+ * @tparam T The coordinate type.
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ */
+template <typename T, typename Predicates = util::TolerancePredicates>
+class BasicSlidingWindowHull2D {
+public:
+    using Point = geometry::BasicPoint2D<T>;
+
+    /**
+     * @brief The number of points in the window, coincident ones counted separately.
+     */
+    size_t Size() const { return points_.size() - first_; }
+
+    bool Empty() const { return Size() == 0; }
+
+    void Clear() { *this = BasicSlidingWindowHull2D(); }
+
+    /**
+     * @brief The oldest point of the window, which PopFront removes. The window must not be empty.
+     */
+    const Point& Front() const { return points_[first_]; }
+
+    /**
+     * @brief Adds a point at the back of the window in O(log h) amortized expected time.
+     */
+    void PushBack(const Point& point) {
+        points_.push_back(point);
+        halves_[kBack].Push(point);
+        is_merged_ = false;
+    }
+
+    /**
+     * @brief Removes the oldest point of the window in O(log h) amortized expected time.
+     *
+     * @return False if the window is empty.
+     */
+    bool PopFront() {
+        if (Empty()) {
+            return false;
+        }
+        if (first_ == front_end_) {
+            // The front half ran empty: all points move to it, the oldest inserted last.
+            points_.erase(points_.begin(), points_.begin() + static_cast<std::ptrdiff_t>(first_));
+            first_ = 0;
+            front_end_ = points_.size();
+            halves_[kFront].Clear();
+            halves_[kBack].Clear();
+            for (size_t i = points_.size(); i > 0; --i) {
+                halves_[kFront].Push(points_[i - 1]);
+            }
+        }
+        halves_[kFront].Undo();
+        first_++;
+        is_merged_ = false;
+        return true;
+    }
+
+    /**
+     * @brief The hull of the window, merged from the halves in O(h) if the window changed since the last query.
+     *
+     * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point, empty when the
+     * hull has fewer than 3 vertices.
+     */
+    const std::vector<Point>& GetConvexHull() {
+        MergeHalves();
+        return convex_hull_points_;
+    }
+
+    /**
+     * @brief Finds a hull vertex farthest in a direction in O(log h) expected time, from the hulls of both halves
+     * without merging them.
+     *
+     * @param direction The direction, need not be normalized.
+     * @return A point maximizing the dot product with direction, none if the window is empty.
+     */
+    std::optional<Point> GetExtremePoint(const Point& direction) const {
+        auto best = halves_[kFront].GetExtremePoint(direction);
+        auto candidate = halves_[kBack].GetExtremePoint(direction);
+        if (!best || (candidate && GetDot(direction, *best, *candidate) > 0)) {
+            return candidate;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Finds the tangents from a point outside the hull in O(log h), after merging the halves if needed.
+     *
+     * @param point The point.
+     * @return The hull vertices touched by the tangents, i.e. the neighbours of point on the hull of the window and
+     * point: first the one before it, then the one after it in counter-clockwise order. None if point lies inside or
+     * on the hull.
+     */
+    std::optional<std::pair<Point, Point>> GetTangents(const Point& point) {
+        MergeHalves();
+        if (chains_[0].empty()) {
+            return std::nullopt;
+        }
+        size_t before[2];
+        size_t after[2];
+        bool is_outside[2];
+        for (size_t chain = 0; chain < 2; ++chain) {
+            is_outside[chain] = IsOutsideChain(chain, point);
+            before[chain] = is_outside[chain] ? GetTangentBefore(chain, point) : kNil;
+            after[chain] = is_outside[chain] ? GetTangentAfter(chain, point) : kNil;
+        }
+        if (!is_outside[0] && !is_outside[1]) {
+            return std::nullopt;
+        }
+        // A point beyond the lowest or the highest point extends both chains, one neighbour on each.
+        const Point* first = before[0] != kNil ? &chains_[0][before[0]]
+                                               : (before[1] != kNil ? &chains_[1][before[1]] : nullptr);
+        const Point* second = after[0] != kNil ? &chains_[0][after[0]]
+                                               : (after[1] != kNil ? &chains_[1][after[1]] : nullptr);
+        if (first == nullptr || second == nullptr) {
+            return std::nullopt;
+        }
+        return std::make_pair(*first, *second);
+    }
+
+private:
+    static constexpr size_t kNil = std::numeric_limits<size_t>::max();
+    static constexpr size_t kFront = 0;
+    static constexpr size_t kBack = 1;
+
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+
+    static bool IsEqual(const Point& a, const Point& b) {
+        return a.coords[0] == b.coords[0] && a.coords[1] == b.coords[1];
+    }
+
+    /**
+     * @brief The order of a chain: the right chain ascends, the left chain descends.
+     */
+    static bool IsBefore(size_t chain, const Point& a, const Point& b) {
+        return chain == 0 ? util::IsLowerThenLefter(a, b) : util::IsLowerThenLefter(b, a);
+    }
+
+    /**
+     * @brief Whether r is on the line pq or outside the chain through p and q, p before q. Every chain turns left, so
+     * its outside is the right of its edges.
+     */
+    static bool IsOutsideOrOn(const Point& p, const Point& q, const Point& r) {
+        return !Predicates::IsTurnLeft(p, q, r);
+    }
+
+    /**
+     * @brief The hull of one half of the window: a stack of points whose last push can be undone.
+     */
+    class Half {
+    public:
+        void Clear() {
+            nodes_.clear();
+            free_nodes_.clear();
+            changes_.clear();
+            removed_.clear();
+            roots_[0] = roots_[1] = kNil;
+        }
+
+        /**
+         * @brief Inserts a point into both chains, recording the change.
+         */
+        void Push(const Point& point) {
+            Change change;
+            change.point = point;
+            change.first_removed = removed_.size();
+            for (size_t chain = 0; chain < 2; ++chain) {
+                const size_t num_removed = removed_.size();
+                change.is_inserted[chain] = Insert(chain, point);
+                change.num_removed[chain] = removed_.size() - num_removed;
+            }
+            changes_.push_back(change);
+        }
+
+        /**
+         * @brief Reverts the last push.
+         */
+        void Undo() {
+            const Change change = changes_.back();
+            changes_.pop_back();
+            size_t removed = change.first_removed;
+            for (size_t chain = 0; chain < 2; ++chain) {
+                if (change.is_inserted[chain]) {
+                    Erase(chain, Find(chain, change.point));
+                }
+                for (size_t i = 0; i < change.num_removed[chain]; ++i) {
+                    Link(chain, removed_[removed + i]);
+                }
+                removed += change.num_removed[chain];
+            }
+            removed_.resize(change.first_removed);
+        }
+
+        /**
+         * @brief A vertex of the hull farthest in a direction, none if the half is empty.
+         */
+        std::optional<Point> GetExtremePoint(const Point& direction) const {
+            if (roots_[0] == kNil) {
+                return std::nullopt;
+            }
+            size_t best = GetChainExtremePoint(0, direction);
+            size_t candidate = GetChainExtremePoint(1, direction);
+            if (GetDot(direction, nodes_[best].point, nodes_[candidate].point) > 0) {
+                best = candidate;
+            }
+            return nodes_[best].point;
+        }
+
+        /**
+         * @brief Appends the vertices of the hull, ascending by util::IsLowerThenLefter.
+         */
+        void AppendVertices(std::vector<Point>& vertices) const {
+            if (roots_[0] == kNil) {
+                return;
+            }
+            // The right chain ascends, the left chain descends, they share the lowest and the highest point.
+            size_t right = GetEnd(0, 0);
+            size_t left = GetEnd(1, 1);
+            while (right != kNil || left != kNil) {
+                const bool is_right_first =
+                    left == kNil || (right != kNil && util::IsLowerThenLefter(nodes_[right].point, nodes_[left].point));
+                if (is_right_first) {
+                    vertices.push_back(nodes_[right].point);
+                    right = nodes_[right].next;
+                } else if (right == kNil || util::IsLowerThenLefter(nodes_[left].point, nodes_[right].point)) {
+                    vertices.push_back(nodes_[left].point);
+                    left = nodes_[left].prev;
+                } else {
+                    vertices.push_back(nodes_[right].point);
+                    right = nodes_[right].next;
+                    left = nodes_[left].prev;
+                }
+            }
+        }
+
+    private:
+        /**
+         * @brief A vertex of one chain, a node of the treap of the chain.
+         */
+        struct Node {
+            Point point;
+            uint64_t priority = 0;
+            size_t child[2] = {kNil, kNil};
+            // the neighbours on the chain, in chain order
+            size_t prev = kNil;
+            size_t next = kNil;
+        };
+
+        /**
+         * @brief What a push changed: whether the point became a vertex of each chain, and the vertices it removed,
+         * those of the right chain first.
+         */
+        struct Change {
+            Point point;
+            bool is_inserted[2] = {false, false};
+            size_t first_removed = 0;
+            size_t num_removed[2] = {0, 0};
+        };
+
+        uint64_t NextPriority() {
+            // splitmix64
+            uint64_t z = (random_state_ += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        size_t NewNode(const Point& point) {
+            size_t node = nodes_.size();
+            if (!free_nodes_.empty()) {
+                node = free_nodes_.back();
+                free_nodes_.pop_back();
+                nodes_[node] = Node{};
+            } else {
+                nodes_.emplace_back();
+            }
+            nodes_[node].point = point;
+            nodes_[node].priority = NextPriority();
+            return node;
+        }
+
+        /**
+         * @brief The first vertex of a chain in chain order if side is 0, else the last.
+         */
+        size_t GetEnd(size_t chain, size_t side) const {
+            size_t node = roots_[chain];
+            if (node == kNil) {
+                return kNil;
+            }
+            while (nodes_[node].child[side] != kNil) {
+                node = nodes_[node].child[side];
+            }
+            return node;
+        }
+
+        /**
+         * @brief The vertex of a chain farthest in a direction. The edge directions of a chain span less than a half
+         * turn, so the dot products of the edges with the direction change sign at most once.
+         */
+        size_t GetChainExtremePoint(size_t chain, const Point& direction) const {
+            const size_t first = GetEnd(chain, 0);
+            const size_t first_next = nodes_[first].next;
+            if (first_next == kNil || GetDot(direction, nodes_[first].point, nodes_[first_next].point) <= 0) {
+                // decreasing first, so the maximum is at one of the ends
+                const size_t last = GetEnd(chain, 1);
+                return GetDot(direction, nodes_[first].point, nodes_[last].point) > 0 ? last : first;
+            }
+            size_t best = kNil;
+            for (size_t node = roots_[chain]; node != kNil;) {
+                const size_t next = nodes_[node].next;
+                if (next != kNil && GetDot(direction, nodes_[node].point, nodes_[next].point) > 0) {
+                    node = nodes_[node].child[1];
+                } else {
+                    best = node;
+                    node = nodes_[node].child[0];
+                }
+            }
+            return best;
+        }
+
+        size_t Find(size_t chain, const Point& point) const {
+            size_t node = roots_[chain];
+            while (node != kNil && !IsEqual(nodes_[node].point, point)) {
+                node = nodes_[node].child[IsBefore(chain, nodes_[node].point, point) ? 1 : 0];
+            }
+            return node;
+        }
+
+        /**
+         * @brief Splits a treap into the vertices before key and the rest.
+         */
+        void Split(size_t chain, size_t treap, const Point& key, size_t& first, size_t& second) {
+            if (treap == kNil) {
+                first = second = kNil;
+                return;
+            }
+            if (IsBefore(chain, nodes_[treap].point, key)) {
+                Split(chain, nodes_[treap].child[1], key, nodes_[treap].child[1], second);
+                first = treap;
+            } else {
+                Split(chain, nodes_[treap].child[0], key, first, nodes_[treap].child[0]);
+                second = treap;
+            }
+        }
+
+        size_t Merge(size_t first, size_t second) {
+            if (first == kNil) {
+                return second;
+            }
+            if (second == kNil) {
+                return first;
+            }
+            if (nodes_[first].priority > nodes_[second].priority) {
+                nodes_[first].child[1] = Merge(nodes_[first].child[1], second);
+                return first;
+            }
+            nodes_[second].child[0] = Merge(first, nodes_[second].child[0]);
+            return second;
+        }
+
+        /**
+         * @brief Adds a vertex to a chain without restoring convexity, linking it to its neighbours.
+         */
+        size_t Link(size_t chain, const Point& point) {
+            size_t before = kNil;
+            size_t after = kNil;
+            for (size_t node = roots_[chain]; node != kNil;) {
+                if (IsBefore(chain, nodes_[node].point, point)) {
+                    before = node;
+                    node = nodes_[node].child[1];
+                } else {
+                    after = node;
+                    node = nodes_[node].child[0];
+                }
+            }
+            const size_t node = NewNode(point);
+            nodes_[node].prev = before;
+            nodes_[node].next = after;
+            if (before != kNil) {
+                nodes_[before].next = node;
+            }
+            if (after != kNil) {
+                nodes_[after].prev = node;
+            }
+            size_t first;
+            size_t second;
+            Split(chain, roots_[chain], point, first, second);
+            roots_[chain] = Merge(Merge(first, node), second);
+            return node;
+        }
+
+        size_t EraseFromTreap(size_t chain, size_t treap, const Point& key) {
+            if (IsEqual(nodes_[treap].point, key)) {
+                return Merge(nodes_[treap].child[0], nodes_[treap].child[1]);
+            }
+            const size_t side = IsBefore(chain, nodes_[treap].point, key) ? 1 : 0;
+            nodes_[treap].child[side] = EraseFromTreap(chain, nodes_[treap].child[side], key);
+            return treap;
+        }
+
+        void Erase(size_t chain, size_t node) {
+            const size_t prev = nodes_[node].prev;
+            const size_t next = nodes_[node].next;
+            if (prev != kNil) {
+                nodes_[prev].next = next;
+            }
+            if (next != kNil) {
+                nodes_[next].prev = prev;
+            }
+            roots_[chain] = EraseFromTreap(chain, roots_[chain], nodes_[node].point);
+            free_nodes_.push_back(node);
+        }
+
+        /**
+         * @brief Inserts a point into a chain if it lies outside it, removing the vertices it makes non-convex.
+         *
+         * @return Whether the point became a vertex.
+         */
+        bool Insert(size_t chain, const Point& point) {
+            size_t before = kNil;
+            size_t after = kNil;
+            for (size_t node = roots_[chain]; node != kNil;) {
+                if (IsBefore(chain, nodes_[node].point, point)) {
+                    before = node;
+                    node = nodes_[node].child[1];
+                } else {
+                    after = node;
+                    node = nodes_[node].child[0];
+                }
+            }
+            if (after != kNil && IsEqual(nodes_[after].point, point)) {
+                return false;
+            }
+            // between two vertices, the point must be strictly right of the edge joining them
+            if (before != kNil && after != kNil && !Predicates::IsTurnLeft(nodes_[before].point, point,
+                                                                           nodes_[after].point)) {
+                return false;
+            }
+            const size_t node = Link(chain, point);
+            for (size_t prev = nodes_[node].prev; prev != kNil && nodes_[prev].prev != kNil;
+                 prev = nodes_[node].prev) {
+                if (Predicates::IsTurnLeft(nodes_[nodes_[prev].prev].point, nodes_[prev].point, point)) {
+                    break;
+                }
+                removed_.push_back(nodes_[prev].point);
+                Erase(chain, prev);
+            }
+            for (size_t next = nodes_[node].next; next != kNil && nodes_[next].next != kNil;
+                 next = nodes_[node].next) {
+                if (Predicates::IsTurnLeft(point, nodes_[next].point, nodes_[nodes_[next].next].point)) {
+                    break;
+                }
+                removed_.push_back(nodes_[next].point);
+                Erase(chain, next);
+            }
+            return true;
+        }
+
+        std::vector<Node> nodes_;
+        std::vector<size_t> free_nodes_;
+        // the changes of the pushes, the last one on top
+        std::vector<Change> changes_;
+        // the vertices removed by the pushes, in the order of changes_
+        std::vector<Point> removed_;
+        size_t roots_[2] = {kNil, kNil};
+        uint64_t random_state_ = 0;
+    };
+
+    /**
+     * @brief Merges the vertices of both halves into the chains and the hull of the window, unless already done.
+     */
+    void MergeHalves() {
+        if (is_merged_) {
+            return;
+        }
+        is_merged_ = true;
+        vertices_[0].clear();
+        vertices_[1].clear();
+        halves_[kFront].AppendVertices(vertices_[0]);
+        halves_[kBack].AppendVertices(vertices_[1]);
+        sorted_points_.clear();
+        std::set_union(vertices_[0].begin(), vertices_[0].end(), vertices_[1].begin(), vertices_[1].end(),
+                       std::back_inserter(sorted_points_), util::IsLowerThenLefter<T>);
+
+        // the chains of the monotone chain algorithm, the left chain built ascending and then reversed
+        auto& right_chain = chains_[0];
+        auto& left_chain = chains_[1];
+        right_chain.clear();
+        left_chain.clear();
+        for (const auto& point : sorted_points_) {
+            while (right_chain.size() >= 2 &&
+                   !Predicates::IsTurnLeft(right_chain[right_chain.size() - 2], right_chain.back(), point)) {
+                right_chain.pop_back();
+            }
+            right_chain.push_back(point);
+            while (left_chain.size() >= 2 &&
+                   !Predicates::IsTurnLeft(point, left_chain.back(), left_chain[left_chain.size() - 2])) {
+                left_chain.pop_back();
+            }
+            left_chain.push_back(point);
+        }
+        std::reverse(left_chain.begin(), left_chain.end());
+
+        convex_hull_points_.clear();
+        if (right_chain.size() + left_chain.size() < 5) {
+            return;
+        }
+        convex_hull_points_.insert(convex_hull_points_.end(), right_chain.begin(), right_chain.end());
+        convex_hull_points_.insert(convex_hull_points_.end(), left_chain.begin() + 1, left_chain.end() - 1);
+        if constexpr (!util::kIsExactFor<Predicates, T>) {
+            std::rotate(convex_hull_points_.begin(),
+                        std::min_element(convex_hull_points_.begin(), convex_hull_points_.end()),
+                        convex_hull_points_.end());
+        }
+    }
+
+    static Accumulator GetDot(const Point& direction, const Point& from, const Point& to) {
+        return static_cast<Accumulator>(direction.coords[0]) *
+                   (static_cast<Accumulator>(to.coords[0]) - static_cast<Accumulator>(from.coords[0])) +
+               static_cast<Accumulator>(direction.coords[1]) *
+                   (static_cast<Accumulator>(to.coords[1]) - static_cast<Accumulator>(from.coords[1]));
+    }
+
+    /**
+     * @brief The first index in [first, last) where a predicate monotone over the range turns true, last if none.
+     */
+    template <typename Predicate>
+    static size_t FindFirst(size_t first, size_t last, Predicate&& predicate) {
+        while (first < last) {
+            const size_t middle = first + (last - first) / 2;
+            if (predicate(middle)) {
+                last = middle;
+            } else {
+                first = middle + 1;
+            }
+        }
+        return first;
+    }
+
+    /**
+     * @brief Whether a point extends a chain, i.e. lies before or after all of its vertices or strictly outside the
+     * edge spanning it.
+     */
+    bool IsOutsideChain(size_t chain, const Point& point) const {
+        const auto& vertices = chains_[chain];
+        if (IsBefore(chain, point, vertices.front()) || IsBefore(chain, vertices.back(), point)) {
+            return true;
+        }
+        // the first vertex not before point
+        const size_t after =
+            FindFirst(0, vertices.size(), [&](size_t i) { return !IsBefore(chain, vertices[i], point); });
+        if (after == 0 || after == vertices.size()) {
+            return false;
+        }
+        return !IsEqual(vertices[after], point) && Predicates::IsTurnLeft(vertices[after], vertices[after - 1], point);
+    }
+
+    /**
+     * @brief The tangent from a point outside a chain to the vertices before it, kNil if there are none.
+     */
+    size_t GetTangentBefore(size_t chain, const Point& point) const {
+        const auto& vertices = chains_[chain];
+        const size_t num_before =
+            FindFirst(0, vertices.size(), [&](size_t i) { return !IsBefore(chain, vertices[i], point); });
+        if (num_before == 0) {
+            return kNil;
+        }
+        return FindFirst(0, num_before - 1, [&](size_t i) {
+            return !IsBefore(chain, vertices[i + 1], point) || IsOutsideOrOn(vertices[i], vertices[i + 1], point);
+        });
+    }
+
+    /**
+     * @brief The tangent from a point outside a chain to the vertices after it, kNil if there are none.
+     */
+    size_t GetTangentAfter(size_t chain, const Point& point) const {
+        const auto& vertices = chains_[chain];
+        const size_t first_after =
+            FindFirst(0, vertices.size(), [&](size_t i) { return IsBefore(chain, point, vertices[i]); });
+        if (first_after == vertices.size()) {
+            return kNil;
+        }
+        return FindFirst(first_after, vertices.size() - 1,
+                         [&](size_t i) { return !IsOutsideOrOn(point, vertices[i], vertices[i + 1]); });
+    }
+
+    // the points of the window, oldest first, from first_ on
+    std::vector<Point> points_;
+    size_t first_ = 0;
+    // the end of the points of the front half in points_, the back half holds the rest
+    size_t front_end_ = 0;
+    Half halves_[2];
+    bool is_merged_ = true;
+    // the vertices of the halves, the merged sorted vertices, the chains of the window and its hull
+    std::vector<Point> vertices_[2];
+    std::vector<Point> sorted_points_;
+    std::vector<Point> chains_[2];
+    std::vector<Point> convex_hull_points_;
+};
+
+using SlidingWindowHull2D = BasicSlidingWindowHull2D<double>;
+
+}  // namespace euclid::algorithm::convex_hull
@@ -0,0 +1,292 @@
+#pragma once
+
+/**
+ * @file streaming.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_hull/parallel.h"
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+#include "util/mapped_file.h"
+#include "util/scalar_traits.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief The default number of points per chunk of the streaming hull, 16 MiB of double points.
+ */
+inline constexpr size_t kStreamingHullChunkPoints = 1 << 20;
+
+/**
+ * @brief The coordinate type of a point file: a flat array of interleaved x, y coordinates in native byte order,
+ * without a header.
+ */
+enum class PointFileFormat {
+    kFloat,
+    kDouble,
+};
+
+/**
+ * @brief The convex hull of points arriving in chunks, e.g. from a file larger than the memory.
+ *
+ * Keeps only the vertices of the hull so far, sorted by util::IsLowerThenLefter<T>. Incoming points strictly inside a
+ * box known to lie in that hull are dropped at once, the others are collected into chunks. Every chunk is reduced to
+ * its hull with Quickhull, whose vertices are sorted and merged with the kept ones, and ReduceToSortedHullVertices
+ * drops those not on the combined hull, as in the merge step of GetConvexHullInParallel. Memory use is O(h + chunk),
+ * and after the first chunks no allocation happens unless the hull grows.
+ *
+ * The result equals that of the other algorithms with an exact predicate policy or integer coordinates, see
+ * GetConvexHullInParallel for util::TolerancePredicates.
+ *
+ * @tparam T The coordinate type.
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ */
+template <typename T, typename Predicates = util::TolerancePredicates>
+class BasicStreamingConvexHull {
+public:
+    using Point = geometry::BasicPoint2D<T>;
+
+    /**
+     * @param chunk_points The number of points folded at once, at most.
+     * @param resource The memory resource of the buffers.
+     */
+    explicit BasicStreamingConvexHull(size_t chunk_points = kStreamingHullChunkPoints,
+                                      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : chunk_points_(std::max<size_t>(chunk_points, 1)),
+          workspace_(resource),
+          chunk_(resource),
+          vertices_(resource),
+          merged_(resource) {}
+
+    /**
+     * @brief The number of points added so far.
+     */
+    size_t NumPoints() const { return num_points_; }
+
+    size_t ChunkPoints() const { return chunk_points_; }
+
+    void Clear() {
+        num_points_ = 0;
+        chunk_.clear();
+        vertices_.clear();
+        UpdateBox();
+    }
+
+    /**
+     * @brief Adds points, folding them into the hull ChunkPoints() at a time.
+     */
+    void Add(std::span<const Point> points) { Add(points.begin(), points.end()); }
+
+    /**
+     * @brief Adds the points of an input range, reading it once.
+     */
+    template <typename InputIt>
+    void Add(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            Collect(*first);
+        }
+        Fold();
+    }
+
+    /**
+     * @brief Adds points given as interleaved x, y coordinates, e.g. read from a file.
+     *
+     * @param coordinates The 2 * num_points coordinates, converted to T.
+     * @param num_points The number of points.
+     */
+    template <typename U>
+    void AddInterleaved(const U* coordinates, size_t num_points) {
+        for (size_t i = 0; i < num_points; ++i) {
+            Collect({static_cast<T>(coordinates[2 * i]), static_cast<T>(coordinates[2 * i + 1])});
+        }
+        Fold();
+    }
+
+    /**
+     * @brief The hull of the points added so far, in O(h).
+     *
+     * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point, empty when
+     * the hull has fewer than 3 vertices.
+     */
+    std::vector<Point> GetConvexHull() const {
+        std::vector<Point> convex_hull_points(2 * vertices_.size());
+        std::copy(vertices_.begin(), vertices_.end(), convex_hull_points.begin());
+        convex_hull_points.resize(
+            GetConvexHullByMonotoneChainOfSorted<Predicates>(convex_hull_points.data(), vertices_.size()));
+        return convex_hull_points;
+    }
+
+private:
+    /**
+     * @brief Keeps a point for the next fold unless it lies strictly inside the box, folding full chunks.
+     */
+    void Collect(const Point& point) {
+        num_points_++;
+        if (point.coords[0] > box_min_.coords[0] && point.coords[0] < box_max_.coords[0] &&
+            point.coords[1] > box_min_.coords[1] && point.coords[1] < box_max_.coords[1]) {
+            return;
+        }
+        chunk_.push_back(point);
+        if (chunk_.size() >= chunk_points_) {
+            Fold();
+        }
+    }
+
+    /**
+     * @brief Folds the collected points into the hull: reduces them to their hull with Quickhull, merges its sorted
+     * vertices with the kept ones and drops those not on the combined hull.
+     */
+    void Fold() {
+        if (chunk_.empty()) {
+            return;
+        }
+        euclid::util::ScopedHullCall call("streaming");
+        auto& chunk_vertices = workspace_.GroupPoints();
+        GetConvexHullByQuickHull<Predicates>(chunk_, chunk_vertices, workspace_);
+        if (chunk_vertices.empty()) {
+            // Fewer than 3 points or all collinear, the two extremes stand for the chunk.
+            auto [min_it, max_it] = std::minmax_element(chunk_.begin(), chunk_.end(), util::IsLowerThenLefter<T>);
+            chunk_vertices.assign({*min_it, *max_it});
+        } else {
+            euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kSort);
+            std::sort(chunk_vertices.begin(), chunk_vertices.end(),
+                      euclid::util::CountComparisons(util::IsLowerThenLefter<T>));
+        }
+        chunk_.clear();
+
+        euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kMerge);
+        auto& chains = workspace_.Points();
+        merged_.resize(vertices_.size() + chunk_vertices.size());
+        std::merge(vertices_.begin(), vertices_.end(), chunk_vertices.begin(), chunk_vertices.end(), merged_.begin(),
+                   util::IsLowerThenLefter<T>);
+        chains.resize(2 * merged_.size());
+        vertices_.resize(merged_.size());
+        vertices_.resize(ReduceToSortedHullVertices<Predicates, T>(merged_, chains.data(), vertices_.data()));
+        UpdateBox();
+    }
+
+    /**
+     * @brief Fits a box between the kept vertices extreme in the four diagonal directions, which drops most points of
+     * a large input with four comparisons each before the chunk hull.
+     *
+     * A point strictly inside the box lies strictly between the bottom and top sides of the quadrilateral of these
+     * vertices on a vertical line, and between its left and right sides on a horizontal line, so it is interior to
+     * the hull and cannot be a vertex. This holds for any four vertices, the rounding of the sums does not matter.
+     */
+    void UpdateBox() {
+        box_min_ = {std::numeric_limits<T>::max(), std::numeric_limits<T>::max()};
+        box_max_ = {std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest()};
+        if (vertices_.size() < 3) {
+            return;
+        }
+        // extreme in the directions (-1, -1), (1, -1), (1, 1) and (-1, 1)
+        Point extremes[4] = {vertices_[0], vertices_[0], vertices_[0], vertices_[0]};
+        auto Sum = [](const Point& point) { return static_cast<Accumulator>(point.coords[0]) + point.coords[1]; };
+        auto Difference = [](const Point& point) {
+            return static_cast<Accumulator>(point.coords[0]) - point.coords[1];
+        };
+        for (const auto& vertex : vertices_) {
+            if (Sum(vertex) < Sum(extremes[0])) {
+                extremes[0] = vertex;
+            }
+            if (Difference(vertex) > Difference(extremes[1])) {
+                extremes[1] = vertex;
+            }
+            if (Sum(vertex) > Sum(extremes[2])) {
+                extremes[2] = vertex;
+            }
+            if (Difference(vertex) < Difference(extremes[3])) {
+                extremes[3] = vertex;
+            }
+        }
+        box_min_ = {std::max(extremes[0].coords[0], extremes[3].coords[0]),
+                    std::max(extremes[0].coords[1], extremes[1].coords[1])};
+        box_max_ = {std::min(extremes[1].coords[0], extremes[2].coords[0]),
+                    std::min(extremes[2].coords[1], extremes[3].coords[1])};
+    }
+
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+
+    size_t chunk_points_;
+    size_t num_points_ = 0;
+    BasicHullWorkspace<T> workspace_;
+    std::pmr::vector<Point> chunk_;
+    // the hull vertices so far, sorted by util::IsLowerThenLefter<T>
+    std::pmr::vector<Point> vertices_;
+    std::pmr::vector<Point> merged_;
+    // An empty box until the hull has 3 vertices.
+    Point box_min_ = {std::numeric_limits<T>::max(), std::numeric_limits<T>::max()};
+    Point box_max_ = {std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest()};
+};
+
+using StreamingConvexHull = BasicStreamingConvexHull<double>;
+
+/**
+ * @brief Computes the convex hull of the points of an input range in chunks, holding O(h + chunk) points at a time.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param first The first point.
+ * @param last The end of the points, which are read once, so single-pass input iterators will do.
+ * @param chunk_points The number of points per chunk.
+ * @return The hull vertices in counter-clockwise order, starting from the lowest then leftest point.
+ */
+template <typename Predicates = util::TolerancePredicates, typename InputIt>
+auto GetConvexHullByStreaming(InputIt first, InputIt last, size_t chunk_points = kStreamingHullChunkPoints) {
+    using T = typename std::iterator_traits<InputIt>::value_type::Scalar;
+    BasicStreamingConvexHull<T, Predicates> streaming_convex_hull(chunk_points);
+    streaming_convex_hull.Add(first, last);
+    return streaming_convex_hull.GetConvexHull();
+}
+
+/**
+ * @brief Computes the convex hull of the points of a file, mapped into memory and read sequentially, holding
+ * O(h + chunk) points at a time. The pages of the file are dropped from memory once consumed.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param path The file, a flat array of interleaved x, y coordinates.
+ * @param format The coordinate type of the file.
+ * @param convex_hull_points Receives the hull vertices in counter-clockwise order, starting from the lowest then
+ * leftest point.
+ * @param chunk_points The number of points per chunk.
+ * @return false if the file cannot be mapped or its size is not a whole number of points.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+bool GetConvexHullOfPointFile(const char* path, PointFileFormat format,
+                              std::vector<geometry::BasicPoint2D<T>>& convex_hull_points,
+                              size_t chunk_points = kStreamingHullChunkPoints) {
+    euclid::util::MappedFile file(path);
+    const size_t point_size = 2 * (format == PointFileFormat::kFloat ? sizeof(float) : sizeof(double));
+    if (!file.IsOpen() || file.Size() % point_size != 0) {
+        return false;
+    }
+    BasicStreamingConvexHull<T, Predicates> streaming_convex_hull(chunk_points);
+    const size_t num_points = file.Size() / point_size;
+    for (size_t begin = 0; begin < num_points; begin += streaming_convex_hull.ChunkPoints()) {
+        const size_t count = std::min(streaming_convex_hull.ChunkPoints(), num_points - begin);
+        if (format == PointFileFormat::kFloat) {
+            streaming_convex_hull.AddInterleaved(reinterpret_cast<const float*>(file.Data()) + 2 * begin, count);
+        } else {
+            streaming_convex_hull.AddInterleaved(reinterpret_cast<const double*>(file.Data()) + 2 * begin, count);
+        }
+        file.Discard(begin * point_size, (begin + count) * point_size);
+    }
+    convex_hull_points = streaming_convex_hull.GetConvexHull();
+    return true;
+}
+
+}  // namespace euclid::algorithm::convex_hull
@@ -7,43 +7,271 @@
  */
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <vector>
 
-#include "algorithm/util/location.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
 #include "geometry/point_2d.h"
+#include "util/compare.h"
+#include "util/instrumentation.h"
 
 namespace euclid::algorithm::convex_hull {
 
-inline std::vector<geometry::Point2D> RemoveCoincidePoints(const std::vector<geometry::Point2D>& points) {
+/**
+ * @brief Removes coincident points using a uniform grid with cells about as wide as the comparison tolerance, or
+ * wider for inputs spanning more than 2^40 tolerances.
+ *
+ * Two points coincide if Point2D::operator== holds, i.e. they are closer than util::kDefaultTolerance, so a point
+ * only has to be compared with the unique points in its own and the 8 neighbouring cells. The cells are kept in an
+ * open addressing hash table, which makes the removal linear in expectation. The first occurrence of every point is
+ * kept, in input order, and a point coinciding with several unique points is mapped to the earliest of them, exactly
+ * as a pairwise scan would.
+ *
+ * @param points The input points.
+ * @param representative_indices If not null, receives for every input point the index of its representative in the
+ * returned vector.
+ * @return The unique points.
+ */
+template <typename T>
+inline std::vector<geometry::BasicPoint2D<T>> RemoveCoincidePointsByGrid(
+    const std::vector<geometry::BasicPoint2D<T>>& points, std::vector<size_t>* representative_indices) {
+    static_assert(!euclid::util::ScalarTraits<T>::kIsExact, "exact coordinates are deduplicated by RemoveEqualPoints");
+    constexpr size_t kNone = std::numeric_limits<size_t>::max();
+    if (representative_indices != nullptr) {
+        representative_indices->assign(points.size(), kNone);
+    }
     if (points.empty()) {
         return {};
     }
-    std::vector<geometry::Point2D> unique_points;
-    unique_points.reserve(points.size());
-    for (const auto& pt : points) {
-        bool is_unique = true;
-        for (const auto& upt : unique_points) {
-            if (pt == upt) {
-                is_unique = false;
-                break;
+
+    // The cells are at least as wide as the tolerance and at most 2^40 span the input, so that points far from the
+    // origin do not all share one clamped cell. Indices are taken from the lower bounds, then the rounding of a
+    // difference is below 2^-11 cells and the slightly wider cells keep coinciding points in neighbouring ones.
+    double min_x = HUGE_VAL;
+    double min_y = HUGE_VAL;
+    double max_x = -HUGE_VAL;
+    double max_y = -HUGE_VAL;
+    for (const auto& point : points) {
+        const double x = point.coords[0];
+        const double y = point.coords[1];
+        if (std::isfinite(x) && std::isfinite(y)) {
+            min_x = std::min(min_x, x);
+            min_y = std::min(min_y, y);
+            max_x = std::max(max_x, x);
+            max_y = std::max(max_y, y);
+        }
+    }
+    const double span = min_x <= max_x ? std::max(max_x - min_x, max_y - min_y) : 0.0;
+    const double cell_width = std::max(euclid::util::kDefaultTolerance, span * 0x1p-40) * (1.0 + 0x1p-10);
+    const double inverse_cell_width = 1.0 / cell_width;
+
+    struct GridCell {
+        int64_t x;
+        int64_t y;
+    };
+    auto ToCell = [&](const geometry::BasicPoint2D<T>& point) {
+        // Clamped so that the neighbouring cells of infinite or NaN points do not overflow, those merely share a cell.
+        constexpr double kLimit = 4.0e18;
+        auto ToIndex = [&](double coord, double min_coord) {
+            double index = std::floor((coord - min_coord) * inverse_cell_width);
+            if (!(index > -kLimit)) {
+                index = -kLimit;
+            } else if (index > kLimit) {
+                index = kLimit;
+            }
+            return static_cast<int64_t>(index);
+        };
+        return GridCell{ToIndex(point.coords[0], min_x), ToIndex(point.coords[1], min_y)};
+    };
+    auto Hash = [](const GridCell& cell) {
+        auto hash = static_cast<uint64_t>(cell.x) * 0x9E3779B97F4A7C15ull ^ static_cast<uint64_t>(cell.y);
+        hash ^= hash >> 29;
+        hash *= 0xBF58476D1CE4E5B9ull;
+        return hash ^ (hash >> 32);
+    };
+
+    size_t capacity = 64;
+    while (capacity < 2 * points.size()) {
+        capacity *= 2;
+    }
+    // Every slot holds a cell and the most recent unique point inside it, older ones are chained by next_in_cell.
+    struct Slot {
+        GridCell cell;
+        size_t head;
+    };
+    std::vector<Slot> slots(capacity, Slot{{0, 0}, kNone});
+    std::vector<size_t> next_in_cell;
+    next_in_cell.reserve(points.size());
+    // Most neighbouring cells are empty, a bitmap with 8 bits per slot answers them without touching the slots.
+    const size_t num_bits = 8 * capacity;
+    std::vector<uint64_t> occupied_bits(num_bits / 64, 0);
+    auto FindSlot = [&](const GridCell& cell, size_t index) -> Slot& {
+        while (slots[index].head != kNone && (slots[index].cell.x != cell.x || slots[index].cell.y != cell.y)) {
+            index = (index + 1) & (capacity - 1);
+        }
+        return slots[index];
+    };
+
+    std::vector<geometry::BasicPoint2D<T>> unique_points;
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto& pt = points[i];
+        auto cell = ToCell(pt);
+        size_t representative = kNone;
+        for (int64_t dx = -1; dx <= 1; ++dx) {
+            for (int64_t dy = -1; dy <= 1; ++dy) {
+                GridCell neighbour{cell.x + dx, cell.y + dy};
+                auto hash = Hash(neighbour);
+                size_t bit = hash & (num_bits - 1);
+                if ((occupied_bits[bit / 64] & (uint64_t{1} << (bit % 64))) == 0) {
+                    continue;
+                }
+                for (size_t u = FindSlot(neighbour, hash & (capacity - 1)).head; u != kNone; u = next_in_cell[u]) {
+                    if (u < representative && pt == unique_points[u]) {
+                        representative = u;
+                    }
+                }
             }
         }
-        if (is_unique) {
+        if (representative == kNone) {
+            representative = unique_points.size();
             unique_points.push_back(pt);
+            auto hash = Hash(cell);
+            size_t bit = hash & (num_bits - 1);
+            occupied_bits[bit / 64] |= uint64_t{1} << (bit % 64);
+            auto& slot = FindSlot(cell, hash & (capacity - 1));
+            slot.cell = cell;
+            next_in_cell.push_back(slot.head);
+            slot.head = representative;
+        }
+        if (representative_indices != nullptr) {
+            (*representative_indices)[i] = representative;
+        }
+    }
+    euclid::util::CountHullEvent(&euclid::util::HullStats::removed_coincide_points,
+                                 points.size() - unique_points.size());
+    return unique_points;
+}
+
+/**
+ * @brief Removes exactly equal points, keeping the first occurrence of every point in input order.
+ *
+ * @param points The input points.
+ * @param representative_indices If not null, receives for every input point the index of its representative in the
+ * returned vector.
+ * @return The unique points.
+ */
+template <typename T>
+inline std::vector<geometry::BasicPoint2D<T>> RemoveEqualPoints(const std::vector<geometry::BasicPoint2D<T>>& points,
+                                                                std::vector<size_t>* representative_indices) {
+    std::vector<size_t> order(points.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), euclid::util::CountComparisons([&points](size_t a, size_t b) {
+                         return util::IsLowerThenLefter(points[a], points[b]);
+                     }));
+    // Every point refers to the first occurrence of its value, which the stable sort puts first among its copies.
+    std::vector<size_t> first_occurrences(points.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        const auto& point = points[order[i]];
+        bool is_copy = i > 0 && point.coords[0] == points[order[i - 1]].coords[0] &&
+                       point.coords[1] == points[order[i - 1]].coords[1];
+        first_occurrences[order[i]] = is_copy ? first_occurrences[order[i - 1]] : order[i];
+    }
+    if (representative_indices != nullptr) {
+        representative_indices->assign(points.size(), 0);
+    }
+    std::vector<geometry::BasicPoint2D<T>> unique_points;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (first_occurrences[i] == i) {
+            // the representative index of a first occurrence is assigned before any of its copies is visited
+            if (representative_indices != nullptr) {
+                (*representative_indices)[i] = unique_points.size();
+            }
+            unique_points.push_back(points[i]);
+        } else if (representative_indices != nullptr) {
+            (*representative_indices)[i] = (*representative_indices)[first_occurrences[i]];
         }
     }
+    euclid::util::CountHullEvent(&euclid::util::HullStats::removed_coincide_points,
+                                 points.size() - unique_points.size());
     return unique_points;
 }
 
-inline std::vector<geometry::Point2D> SortExtremePoints(const std::vector<geometry::Point2D>& input_points) {
+/**
+ * @brief Removes coincident points, keeping the first occurrence of every point in input order.
+ *
+ * @param points The input points.
+ * @return The unique points.
+ */
+template <typename T>
+inline std::vector<geometry::BasicPoint2D<T>> RemoveCoincidePoints(
+    const std::vector<geometry::BasicPoint2D<T>>& points) {
+    if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+        return RemoveEqualPoints(points, nullptr);
+    } else {
+        return RemoveCoincidePointsByGrid(points, nullptr);
+    }
+}
+
+/**
+ * @brief Removes coincident points, keeping the first occurrence of every point in input order.
+ *
+ * @param points The input points.
+ * @param representative_indices Receives for every input point the index of its representative in the returned vector,
+ * so that arrays of per-point attributes can be deduplicated alongside the points.
+ * @return The unique points.
+ */
+template <typename T>
+inline std::vector<geometry::BasicPoint2D<T>> RemoveCoincidePoints(const std::vector<geometry::BasicPoint2D<T>>& points,
+                                                                   std::vector<size_t>& representative_indices) {
+    if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+        return RemoveEqualPoints(points, &representative_indices);
+    } else {
+        return RemoveCoincidePointsByGrid(points, &representative_indices);
+    }
+}
+
+/**
+ * @brief Removes the points that coincide under a predicate policy: within the tolerance for
+ * util::TolerancePredicates, exactly equal ones for exact policies.
+ *
+ * @param points The input points.
+ * @return The unique points, first occurrences in input order.
+ */
+template <typename Predicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> RemoveCoincidePointsFor(const std::vector<geometry::BasicPoint2D<T>>& points) {
+    euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kRemoveCoincidePoints);
+    if constexpr (util::kIsExactFor<Predicates, T>) {
+        return RemoveEqualPoints(points, nullptr);
+    } else {
+        return RemoveCoincidePoints(points);
+    }
+}
+
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> SortExtremePoints(const std::vector<geometry::BasicPoint2D<T>>& input_points) {
     if (input_points.size() < 3) {
         return {};
     }
 
-    std::vector<geometry::Point2D> points = input_points;
-    std::sort(points.begin(), points.end());
+    std::vector<geometry::BasicPoint2D<T>> points = input_points;
+    {
+        euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kSort);
+        if constexpr (util::kIsExactFor<Predicates, T>) {
+            std::sort(points.begin(), points.end(), euclid::util::CountComparisons(util::IsLowerThenLefter<T>));
+        } else {
+            std::sort(points.begin(), points.end(), euclid::util::CountComparisons(std::less<>()));
+        }
+    }
+    euclid::util::ScopedHullPhase phase(euclid::util::HullPhase::kScan);
 
-    std::vector<geometry::Point2D> convex_hull_points;
+    std::vector<geometry::BasicPoint2D<T>> convex_hull_points;
     convex_hull_points.reserve(points.size());
     convex_hull_points.push_back(points[0]);
 
@@ -61,7 +289,7 @@ inline std::vector<geometry::Point2D> SortExtremePoints(const std::vector<geomet
                     if (last_extreme_point_index == k || j == k) {
                         continue;
                     }
-                    if (!util::IsTurnLeft(points[last_extreme_point_index], points[j], points[k])) {
+                    if (!Predicates::IsTurnLeft(points[last_extreme_point_index], points[j], points[k])) {
                         has_right = true;
                         break;
                     }
@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * @file workspace.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "geometry/point_2d.h"
+#include "geometry/strided_point_span_2d.h"
+
+namespace euclid::algorithm::convex_hull {
+
+/**
+ * @brief A point with its angle around the pivot of the Graham scan.
+ */
+template <typename T>
+struct PointWithAngle {
+    geometry::BasicPoint2D<T> point;
+    double angle;
+};
+
+/**
+ * @brief Reusable scratch memory for the hull algorithms taking a workspace.
+ *
+ * The buffers only ever grow, so once a workspace has served inputs of some size, later calls with inputs up to that
+ * size do not allocate. All buffers draw from the memory resource given at construction, e.g. a
+ * std::pmr::monotonic_buffer_resource over a stack array. A workspace must not be shared between threads.
+ */
+template <typename T>
+class BasicHullWorkspace {
+public:
+    using Point = geometry::BasicPoint2D<T>;
+
+    explicit BasicHullWorkspace(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : input_points_(resource),
+          points_(resource),
+          hull_points_(resource),
+          group_points_(resource),
+          angled_points_(resource),
+          offsets_(resource),
+          indices_(resource) {}
+
+    /**
+     * @brief Allocates up front for inputs of up to size points, so that not even the first call allocates.
+     */
+    void Reserve(size_t size) {
+        input_points_.reserve(size);
+        points_.reserve(2 * size);
+        // Quickhull collects the up to 8 vertices of its octagon on top of the points.
+        hull_points_.reserve(size + 8);
+        // Chan's algorithm hulls its groups with Quickhull, whose octagon may need room past the last group.
+        group_points_.reserve(size + 8);
+        angled_points_.reserve(size);
+        // Chan's algorithm first groups the points by 16.
+        offsets_.reserve(size / 16 + 2);
+        indices_.reserve(size / 16 + 1);
+    }
+
+    /**
+     * @brief Copies strided points into the workspace, for the hull algorithms taking a span.
+     *
+     * @return The gathered points, valid until the next Gather.
+     */
+    std::span<const Point> Gather(const geometry::BasicStridedPointSpan2D<T>& points) {
+        input_points_.resize(points.Size());
+        for (size_t i = 0; i < points.Size(); ++i) {
+            input_points_[i] = points[i];
+        }
+        return input_points_;
+    }
+
+    std::pmr::vector<Point>& Points() { return points_; }
+
+    std::pmr::vector<Point>& HullPoints() { return hull_points_; }
+
+    std::pmr::vector<Point>& GroupPoints() { return group_points_; }
+
+    std::pmr::vector<PointWithAngle<T>>& AngledPoints() { return angled_points_; }
+
+    std::pmr::vector<size_t>& Offsets() { return offsets_; }
+
+    std::pmr::vector<size_t>& Indices() { return indices_; }
+
+private:
+    std::pmr::vector<Point> input_points_;
+    std::pmr::vector<Point> points_;
+    std::pmr::vector<Point> hull_points_;
+    std::pmr::vector<Point> group_points_;
+    std::pmr::vector<PointWithAngle<T>> angled_points_;
+    std::pmr::vector<size_t> offsets_;
+    std::pmr::vector<size_t> indices_;
+};
+
+using HullWorkspace = BasicHullWorkspace<double>;
+
+/**
+ * @brief Copies the hull computed in a workspace to a caller-provided span, if it fits.
+ *
+ * @return The number of hull vertices, also when they did not fit.
+ */
+template <typename T>
+size_t CopyConvexHullPoints(std::span<const geometry::BasicPoint2D<T>> hull_points,
+                            std::span<geometry::BasicPoint2D<T>> convex_hull_points) {
+    if (hull_points.size() <= convex_hull_points.size()) {
+        std::copy(hull_points.begin(), hull_points.end(), convex_hull_points.begin());
+    }
+    return hull_points.size();
+}
+
+}  // namespace euclid::algorithm::convex_hull
@@ -0,0 +1,172 @@
+#pragma once
+
+/**
+ * @file batch.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algorithm/convex_polygon/intersection.h"
+#include "algorithm/convex_polygon/minkowski_sum.h"
+#include "algorithm/util/predicates.h"
+#include "geometry/point_2d.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::convex_polygon {
+
+/**
+ * @brief Applies an operation to many pairs of convex polygons in parallel.
+ *
+ * The result of a pair has at most as many vertices as both polygons together, so every result is written at the
+ * prefix sum of these bounds and the results are moved together afterwards, as in convex_hull::GetConvexHulls.
+ *
+ * @param operation Called with the two polygons, the output and the thread index, returns the number of vertices.
+ */
+template <typename T, typename Operation, typename PointAllocator, typename OffsetAllocator>
+void ApplyToPolygonPairs(std::span<const geometry::BasicPoint2D<T>> polygon_points,
+                         std::span<const size_t> polygon_offsets, std::span<const std::pair<size_t, size_t>> pairs,
+                         std::vector<geometry::BasicPoint2D<T>, PointAllocator>& result_points,
+                         std::vector<size_t, OffsetAllocator>& result_offsets, euclid::util::ThreadPool& thread_pool,
+                         Operation&& operation) {
+    auto GetPolygon = [&](size_t polygon) {
+        return polygon_points.subspan(polygon_offsets[polygon],
+                                      polygon_offsets[polygon + 1] - polygon_offsets[polygon]);
+    };
+    const size_t num_pairs = pairs.size();
+    // The bounds are stored in place of the offsets until all results are known.
+    result_offsets.resize(num_pairs + 1);
+    result_offsets[0] = 0;
+    for (size_t pair = 0; pair < num_pairs; ++pair) {
+        result_offsets[pair + 1] =
+            result_offsets[pair] + GetPolygon(pairs[pair].first).size() + GetPolygon(pairs[pair].second).size();
+    }
+    result_points.resize(result_offsets[num_pairs]);
+
+    // At least 4 chunks per thread, so that stealing can even out polygons of different sizes.
+    const size_t num_chunks = std::min(num_pairs, 4 * thread_pool.NumThreads());
+    std::vector<size_t> sizes(num_pairs);
+    thread_pool.ParallelFor(num_chunks, [&](size_t chunk, size_t thread) {
+        const size_t last_pair = num_pairs * (chunk + 1) / num_chunks;
+        for (size_t pair = num_pairs * chunk / num_chunks; pair < last_pair; ++pair) {
+            sizes[pair] = operation(GetPolygon(pairs[pair].first), GetPolygon(pairs[pair].second),
+                                    result_points.data() + result_offsets[pair], thread);
+        }
+    });
+
+    // Moves the results together, each one to the left of or exactly where it was written.
+    size_t num_result_points = 0;
+    for (size_t pair = 0; pair < num_pairs; ++pair) {
+        const size_t source = result_offsets[pair];
+        if (source != num_result_points) {
+            std::copy(result_points.begin() + source, result_points.begin() + source + sizes[pair],
+                      result_points.begin() + num_result_points);
+        }
+        result_offsets[pair] = num_result_points;
+        num_result_points += sizes[pair];
+    }
+    result_offsets[num_pairs] = num_result_points;
+    result_points.resize(num_result_points);
+}
+
+/**
+ * @brief Computes the intersections of many pairs of convex polygons in parallel, e.g. of the hulls
+ * convex_hull::GetConvexHulls returns.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param polygon_points The vertices of all polygons, every polygon in counter-clockwise order without collinear
+ * vertices.
+ * @param polygon_offsets The first vertex of every polygon followed by the end of the last polygon, in the layout of
+ * convex_hull::GetConvexHulls.
+ * @param pairs The indices of the polygons to intersect.
+ * @param intersection_points Receives the intersections back to back, see GetIntersection.
+ * @param intersection_offsets Receives the offsets of the intersections in intersection_points, i.e. pairs.size() + 1
+ * entries starting with 0.
+ * @param thread_pool The threads to run on.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename PointAllocator,
+          typename OffsetAllocator>
+void GetIntersections(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> polygon_points,
+                      std::span<const size_t> polygon_offsets, std::span<const std::pair<size_t, size_t>> pairs,
+                      std::vector<geometry::BasicPoint2D<T>, PointAllocator>& intersection_points,
+                      std::vector<size_t, OffsetAllocator>& intersection_offsets,
+                      euclid::util::ThreadPool& thread_pool) {
+    // Padded so that the buffer sizes of different threads do not share a cache line.
+    struct alignas(64) ThreadEdges {
+        std::vector<geometry::Point2D> edges;
+    };
+    std::vector<ThreadEdges> edges(thread_pool.NumThreads());
+    ApplyToPolygonPairs<T>(polygon_points, polygon_offsets, pairs, intersection_points, intersection_offsets,
+                           thread_pool,
+                           [&](std::span<const geometry::BasicPoint2D<T>> first,
+                               std::span<const geometry::BasicPoint2D<T>> second,
+                               geometry::BasicPoint2D<T>* output_points, size_t thread) {
+                               auto& thread_edges = edges[thread].edges;
+                               thread_edges.resize(std::max(thread_edges.size(), 4 * (first.size() + second.size())));
+                               return GetIntersectionWithBuffers<Predicates, T>(first, second, thread_edges.data(),
+                                                                                output_points);
+                           });
+}
+
+/**
+ * @brief Computes the Minkowski sums of many pairs of convex polygons in parallel.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param polygon_points The vertices of all polygons, every polygon in counter-clockwise order without collinear
+ * vertices.
+ * @param polygon_offsets The first vertex of every polygon followed by the end of the last polygon, in the layout of
+ * convex_hull::GetConvexHulls.
+ * @param pairs The indices of the polygons to add.
+ * @param sum_points Receives the sums back to back, see GetMinkowskiSum.
+ * @param sum_offsets Receives the offsets of the sums in sum_points, i.e. pairs.size() + 1 entries starting with 0.
+ * @param thread_pool The threads to run on.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename PointAllocator,
+          typename OffsetAllocator>
+void GetMinkowskiSums(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> polygon_points,
+                      std::span<const size_t> polygon_offsets, std::span<const std::pair<size_t, size_t>> pairs,
+                      std::vector<geometry::BasicPoint2D<T>, PointAllocator>& sum_points,
+                      std::vector<size_t, OffsetAllocator>& sum_offsets, euclid::util::ThreadPool& thread_pool) {
+    ApplyToPolygonPairs<T>(polygon_points, polygon_offsets, pairs, sum_points, sum_offsets, thread_pool,
+                           [](std::span<const geometry::BasicPoint2D<T>> first,
+                              std::span<const geometry::BasicPoint2D<T>> second,
+                              geometry::BasicPoint2D<T>* output_points,
+                              size_t) { return GetMinkowskiSum<Predicates, T>(first, second, output_points); });
+}
+
+/**
+ * @brief Computes the Minkowski differences of many pairs of convex polygons in parallel, e.g. for the narrow phase
+ * of a collision test, which checks whether they contain the origin.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param polygon_points The vertices of all polygons, every polygon in counter-clockwise order without collinear
+ * vertices.
+ * @param polygon_offsets The first vertex of every polygon followed by the end of the last polygon, in the layout of
+ * convex_hull::GetConvexHulls.
+ * @param pairs The indices of the polygons, the second one is subtracted.
+ * @param difference_points Receives the differences back to back, see GetMinkowskiDifference.
+ * @param difference_offsets Receives the offsets of the differences in difference_points, i.e. pairs.size() + 1
+ * entries starting with 0.
+ * @param thread_pool The threads to run on.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T, typename PointAllocator,
+          typename OffsetAllocator>
+void GetMinkowskiDifferences(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> polygon_points,
+                             std::span<const size_t> polygon_offsets, std::span<const std::pair<size_t, size_t>> pairs,
+                             std::vector<geometry::BasicPoint2D<T>, PointAllocator>& difference_points,
+                             std::vector<size_t, OffsetAllocator>& difference_offsets,
+                             euclid::util::ThreadPool& thread_pool) {
+    ApplyToPolygonPairs<T>(polygon_points, polygon_offsets, pairs, difference_points, difference_offsets, thread_pool,
+                           [](std::span<const geometry::BasicPoint2D<T>> first,
+                              std::span<const geometry::BasicPoint2D<T>> second,
+                              geometry::BasicPoint2D<T>* output_points,
+                              size_t) { return GetMinkowskiDifference<Predicates, T>(first, second, output_points); });
+}
+
+}  // namespace euclid::algorithm::convex_polygon
@@ -0,0 +1,207 @@
+#pragma once
+
+/**
+ * @file intersection.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/scalar_traits.h"
+
+namespace euclid::algorithm::convex_polygon {
+
+/**
+ * @brief Computes the intersection of two convex polygons in O(n + m) into caller-provided buffers.
+ *
+ * The intersection is the intersection of the half-planes left of the edges of both polygons. The edges of each
+ * polygon are in order of angle from its lowest then leftest vertex on, so merging them gives all half-planes sorted
+ * by angle without sorting. One sweep over them keeps a deque of the half-planes bounding the intersection so far,
+ * dropping those whose corner with a neighbour lies outside the next half-plane, as in the half-plane intersection of
+ * Zhu and the sorted edge advance of O'Rourke et al. Of parallel half-planes of the same direction only the inner one
+ * is kept, opposite ones next to each other mean an empty intersection.
+ *
+ * The corners are computed in double, the half-plane tests use the predicate policy on them.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param first The vertices of the first polygon in counter-clockwise order without collinear ones, as returned by
+ * the convex hull functions.
+ * @param second The vertices of the second polygon, likewise.
+ * @param edges The scratch memory of 4 * (first.size() + second.size()) points, the endpoints of the merged edges and
+ * of those in the deque.
+ * @param intersection_points Receives the vertices of the intersection in counter-clockwise order, starting from the
+ * lowest then leftest one. first.size() + second.size() entries always suffice.
+ * @return The number of vertices of the intersection, 0 if it has no interior, i.e. is empty, a point or a segment, or
+ * if a polygon has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetIntersectionWithBuffers(std::span<const geometry::BasicPoint2D<T>> first,
+                                  std::span<const geometry::BasicPoint2D<T>> second, geometry::Point2D* edges,
+                                  geometry::BasicPoint2D<T>* intersection_points) {
+    static_assert(!euclid::util::ScalarTraits<T>::kIsExact, "the vertices of an intersection are not integer");
+    using geometry::Point2D;
+    const size_t first_size = first.size();
+    const size_t second_size = second.size();
+    if (first_size < 3 || second_size < 3) {
+        return 0;
+    }
+    auto ToPoint2D = [](const geometry::BasicPoint2D<T>& point) {
+        return Point2D{static_cast<double>(point.coords[0]), static_cast<double>(point.coords[1])};
+    };
+    auto GetDirection = [](const Point2D* edge) {
+        return Point2D{edge[1].coords[0] - edge[0].coords[0], edge[1].coords[1] - edge[0].coords[1]};
+    };
+    // Directions in [0, pi) come before those in [pi, 2 * pi), within a half the cross product decides.
+    auto IsInLowerHalf = [](const Point2D& direction) {
+        return direction.coords[1] < 0.0 || (direction.coords[1] == 0.0 && direction.coords[0] < 0.0);
+    };
+    auto IsBefore = [&](const Point2D* a, const Point2D* b) {
+        Point2D a_direction = GetDirection(a);
+        Point2D b_direction = GetDirection(b);
+        if (IsInLowerHalf(a_direction) != IsInLowerHalf(b_direction)) {
+            return IsInLowerHalf(b_direction);
+        }
+        return a_direction.coords[0] * b_direction.coords[1] - a_direction.coords[1] * b_direction.coords[0] > 0.0;
+    };
+
+    // the merged edges, edge k from edges[2 * k] to edges[2 * k + 1]
+    const size_t num_edges = first_size + second_size;
+    {
+        const size_t first_start =
+            std::min_element(first.begin(), first.end(), util::IsLowerThenLefter<T>) - first.begin();
+        const size_t second_start =
+            std::min_element(second.begin(), second.end(), util::IsLowerThenLefter<T>) - second.begin();
+        Point2D first_edge[2];
+        Point2D second_edge[2];
+        auto SetEdge = [&](Point2D* edge, std::span<const geometry::BasicPoint2D<T>> polygon, size_t index) {
+            edge[0] = ToPoint2D(polygon[index % polygon.size()]);
+            edge[1] = ToPoint2D(polygon[(index + 1) % polygon.size()]);
+        };
+        size_t i = 0;
+        size_t j = 0;
+        for (size_t k = 0; k < num_edges; ++k) {
+            if (i < first_size) {
+                SetEdge(first_edge, first, first_start + i);
+            }
+            if (j < second_size) {
+                SetEdge(second_edge, second, second_start + j);
+            }
+            const bool is_first = j == second_size || (i < first_size && !IsBefore(second_edge, first_edge));
+            std::copy(is_first ? first_edge : second_edge, (is_first ? first_edge : second_edge) + 2, edges + 2 * k);
+            (is_first ? i : j)++;
+        }
+    }
+
+    auto IsOutside = [](const Point2D* edge, const Point2D& point) {
+        return Predicates::GetOrientation(edge[0], edge[1], point) < 0;
+    };
+    // A half-plane is dropped once its corner is not strictly inside the next one. Keeping it for a corner on the line
+    // within the tolerance would leave a corner outside the other polygon after the collinear ones are removed.
+    auto IsNotInside = [](const Point2D* edge, const Point2D& point) {
+        return Predicates::GetOrientation(edge[0], edge[1], point) <= 0;
+    };
+    auto GetCorner = [&](const Point2D* a, const Point2D* b) {
+        Point2D a_direction = GetDirection(a);
+        Point2D b_direction = GetDirection(b);
+        double denominator =
+            a_direction.coords[0] * b_direction.coords[1] - a_direction.coords[1] * b_direction.coords[0];
+        double numerator = (b[0].coords[0] - a[0].coords[0]) * b_direction.coords[1] -
+                           (b[0].coords[1] - a[0].coords[1]) * b_direction.coords[0];
+        double t = numerator / denominator;
+        return Point2D{a[0].coords[0] + t * a_direction.coords[0], a[0].coords[1] + t * a_direction.coords[1]};
+    };
+    // Exactly, an absolute tolerance on the cross product of two short directions would merge lines at a large angle.
+    auto AreParallel = [&](const Point2D* a, const Point2D* b) {
+        Point2D a_direction = GetDirection(a);
+        Point2D b_direction = GetDirection(b);
+        return a_direction.coords[0] * b_direction.coords[1] == a_direction.coords[1] * b_direction.coords[0];
+    };
+
+    // The deque holds the edges [front, back), it only grows at the back.
+    Point2D* deque = edges + 2 * num_edges;
+    size_t front = 0;
+    size_t back = 0;
+    auto At = [&](size_t index) { return deque + 2 * index; };
+    for (size_t k = 0; k < num_edges; ++k) {
+        const Point2D* edge = edges + 2 * k;
+        while (back - front > 1 && IsNotInside(edge, GetCorner(At(back - 2), At(back - 1)))) {
+            back--;
+        }
+        while (back - front > 1 && IsNotInside(edge, GetCorner(At(front), At(front + 1)))) {
+            front++;
+        }
+        if (back > front && AreParallel(At(back - 1), edge)) {
+            Point2D direction = GetDirection(edge);
+            Point2D back_direction = GetDirection(At(back - 1));
+            if (direction.coords[0] * back_direction.coords[0] + direction.coords[1] * back_direction.coords[1] < 0.0) {
+                return 0;
+            }
+            if (!IsOutside(edge, At(back - 1)[0])) {
+                continue;
+            }
+            back--;
+        }
+        std::copy(edge, edge + 2, At(back));
+        back++;
+    }
+    while (back - front > 2 && IsNotInside(At(front), GetCorner(At(back - 2), At(back - 1)))) {
+        back--;
+    }
+    while (back - front > 2 && IsNotInside(At(back - 1), GetCorner(At(front), At(front + 1)))) {
+        front++;
+    }
+    if (back - front < 3) {
+        return 0;
+    }
+
+    size_t size = 0;
+    for (size_t index = front; index < back; ++index) {
+        Point2D corner = GetCorner(At(index), At(index + 1 == back ? front : index + 1));
+        intersection_points[size++] = {static_cast<T>(corner.coords[0]), static_cast<T>(corner.coords[1])};
+    }
+    // Corners of more than two half-planes come out several times and edges shorter than the tolerance leave
+    // collinear corners, both are dropped like the hull functions drop collinear points.
+    size_t num_kept = 0;
+    for (size_t index = 0; index < size; ++index) {
+        const auto& previous = num_kept == 0 ? intersection_points[size - 1] : intersection_points[num_kept - 1];
+        if (Predicates::IsTurnLeft(previous, intersection_points[index], intersection_points[(index + 1) % size])) {
+            intersection_points[num_kept++] = intersection_points[index];
+        }
+    }
+    size = num_kept;
+    if (size < 3) {
+        return 0;
+    }
+    std::rotate(intersection_points,
+                std::min_element(intersection_points, intersection_points + size, util::IsLowerThenLefter<T>),
+                intersection_points + size);
+    return size;
+}
+
+/**
+ * @brief Computes the intersection of two convex polygons in O(n + m), see GetIntersectionWithBuffers.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param first The vertices of the first polygon in counter-clockwise order without collinear ones.
+ * @param second The vertices of the second polygon, likewise.
+ * @return The vertices of the intersection in counter-clockwise order, starting from the lowest then leftest one,
+ * empty if it has no interior or a polygon has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetIntersection(const std::vector<geometry::BasicPoint2D<T>>& first,
+                                                       const std::vector<geometry::BasicPoint2D<T>>& second) {
+    std::vector<geometry::Point2D> edges(4 * (first.size() + second.size()));
+    std::vector<geometry::BasicPoint2D<T>> intersection_points(first.size() + second.size());
+    intersection_points.resize(GetIntersectionWithBuffers<Predicates, T>(first, second, edges.data(),
+                                                                          intersection_points.data()));
+    return intersection_points;
+}
+
+}  // namespace euclid::algorithm::convex_polygon
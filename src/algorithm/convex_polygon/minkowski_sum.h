@@ -0,0 +1,161 @@
+#pragma once
+
+/**
+ * @file minkowski_sum.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/scalar_traits.h"
+
+namespace euclid::algorithm::convex_polygon {
+
+/**
+ * @brief Merges the edges of two convex polygons by angle, the second one negated if IsDifference.
+ *
+ * Starting from the lowest then leftest vertices, where the edges of a counter-clockwise convex polygon start in order
+ * of angle, the next edge of the sum is the one of the two current edges turning less, decided exactly by the cross
+ * product of the edge vectors like the directions in GetIntersection. Edges of the same direction are taken together,
+ * so the sum has no collinear vertices.
+ *
+ * @return The number of vertices written to sum_points, at most first.size() + second.size().
+ */
+template <typename Predicates, bool IsDifference, typename T>
+size_t MergeEdges(std::span<const geometry::BasicPoint2D<T>> first, std::span<const geometry::BasicPoint2D<T>> second,
+                  geometry::BasicPoint2D<T>* sum_points) {
+    using Point = geometry::BasicPoint2D<T>;
+    const size_t first_size = first.size();
+    const size_t second_size = second.size();
+    if (first_size < 3 || second_size < 3) {
+        return 0;
+    }
+    const size_t first_start = std::min_element(first.begin(), first.end(), util::IsLowerThenLefter<T>) - first.begin();
+    // The lowest then leftest vertex of the negated polygon is the highest then rightest one.
+    const size_t second_start =
+        (IsDifference ? std::max_element(second.begin(), second.end(), util::IsLowerThenLefter<T>)
+                      : std::min_element(second.begin(), second.end(), util::IsLowerThenLefter<T>)) -
+        second.begin();
+    auto First = [&](size_t i) { return first[(first_start + i) % first_size]; };
+    auto Second = [&](size_t j) {
+        const Point& vertex = second[(second_start + j) % second_size];
+        return IsDifference ? Point{-vertex.coords[0], -vertex.coords[1]} : vertex;
+    };
+    auto GetEdge = [](const Point& p, const Point& q) {
+        return Point{q.coords[0] - p.coords[0], q.coords[1] - p.coords[1]};
+    };
+    // Edges in [0, pi) come before those in [pi, 2 * pi), within a half the cross product decides. Exactly, a tolerance
+    // on the cross product of two short edges would merge edges at a large angle.
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+    auto IsInLowerHalf = [](const Point& edge) {
+        return edge.coords[1] < T{0} || (edge.coords[1] == T{0} && edge.coords[0] < T{0});
+    };
+    auto CompareAngles = [&](const Point& a, const Point& b) {
+        if (IsInLowerHalf(a) != IsInLowerHalf(b)) {
+            return IsInLowerHalf(a) ? -1 : 1;
+        }
+        const Accumulator left = Accumulator{a.coords[0]} * b.coords[1];
+        const Accumulator right = Accumulator{a.coords[1]} * b.coords[0];
+        return static_cast<int>(left > right) - static_cast<int>(left < right);
+    };
+
+    size_t size = 0;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < first_size || j < second_size) {
+        const Point p = First(i);
+        const Point q = Second(j);
+        sum_points[size++] = {p.coords[0] + q.coords[0], p.coords[1] + q.coords[1]};
+        // positive if the edge of the first polygon comes first
+        int order = i == first_size    ? -1
+                    : j == second_size ? 1
+                                       : CompareAngles(GetEdge(p, First(i + 1)), GetEdge(q, Second(j + 1)));
+        if (order >= 0) {
+            i++;
+        }
+        if (order <= 0) {
+            j++;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Computes the Minkowski sum {p + q} of two convex polygons in O(n + m), by merging their edges.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates. The order of the edge
+ * vectors is decided exactly with either.
+ * @param first The vertices of the first polygon in counter-clockwise order without collinear ones, as returned by
+ * the convex hull functions.
+ * @param second The vertices of the second polygon, likewise.
+ * @param sum_points Receives the vertices of the sum in counter-clockwise order, starting from the lowest then leftest
+ * one. first.size() + second.size() entries always suffice.
+ * @return The number of vertices of the sum, 0 if a polygon has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetMinkowskiSum(std::span<const geometry::BasicPoint2D<T>> first,
+                       std::span<const geometry::BasicPoint2D<T>> second, geometry::BasicPoint2D<T>* sum_points) {
+    return MergeEdges<Predicates, false>(first, second, sum_points);
+}
+
+/**
+ * @brief Computes the Minkowski sum {p + q} of two convex polygons in O(n + m), by merging their edges.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param first The vertices of the first polygon in counter-clockwise order without collinear ones.
+ * @param second The vertices of the second polygon, likewise.
+ * @return The vertices of the sum in counter-clockwise order, starting from the lowest then leftest one, empty if a
+ * polygon has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetMinkowskiSum(const std::vector<geometry::BasicPoint2D<T>>& first,
+                                                       const std::vector<geometry::BasicPoint2D<T>>& second) {
+    std::vector<geometry::BasicPoint2D<T>> sum_points(first.size() + second.size());
+    sum_points.resize(GetMinkowskiSum<Predicates, T>(first, second, sum_points.data()));
+    return sum_points;
+}
+
+/**
+ * @brief Computes the Minkowski difference {p - q} of two convex polygons in O(n + m), the sum with the negated second
+ * polygon. It contains the origin if and only if the polygons intersect, and is the configuration space obstacle of
+ * the first polygon for the second one translated around its origin.
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param first The vertices of the first polygon in counter-clockwise order without collinear ones.
+ * @param second The vertices of the second polygon, likewise.
+ * @param difference_points Receives the vertices of the difference in counter-clockwise order, starting from the
+ * lowest then leftest one. first.size() + second.size() entries always suffice.
+ * @return The number of vertices of the difference, 0 if a polygon has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+size_t GetMinkowskiDifference(std::span<const geometry::BasicPoint2D<T>> first,
+                              std::span<const geometry::BasicPoint2D<T>> second,
+                              geometry::BasicPoint2D<T>* difference_points) {
+    return MergeEdges<Predicates, true>(first, second, difference_points);
+}
+
+/**
+ * @brief Computes the Minkowski difference {p - q} of two convex polygons in O(n + m).
+ *
+ * @tparam Predicates The predicate policy, util::TolerancePredicates or util::AdaptivePredicates.
+ * @param first The vertices of the first polygon in counter-clockwise order without collinear ones.
+ * @param second The vertices of the second polygon, likewise.
+ * @return The vertices of the difference in counter-clockwise order, starting from the lowest then leftest one, empty
+ * if a polygon has fewer than 3 vertices.
+ */
+template <typename Predicates = util::TolerancePredicates, typename T>
+std::vector<geometry::BasicPoint2D<T>> GetMinkowskiDifference(const std::vector<geometry::BasicPoint2D<T>>& first,
+                                                              const std::vector<geometry::BasicPoint2D<T>>& second) {
+    std::vector<geometry::BasicPoint2D<T>> difference_points(first.size() + second.size());
+    difference_points.resize(GetMinkowskiDifference<Predicates, T>(first, second, difference_points.data()));
+    return difference_points;
+}
+
+}  // namespace euclid::algorithm::convex_polygon
@@ -0,0 +1,228 @@
+#pragma once
+
+/**
+ * @file rotating_calipers.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algorithm/util/location.h"
+#include "geometry/point_2d.h"
+#include "geometry/rectangle_2d.h"
+#include "util/scalar_traits.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::rotating_calipers {
+
+/**
+ * @brief The measures of a convex polygon found by rotating calipers around it.
+ */
+template <typename T>
+struct BasicCaliperMeasures2D {
+    // Two vertices at the largest distance, the diameter.
+    std::pair<geometry::BasicPoint2D<T>, geometry::BasicPoint2D<T>> diameter;
+    // The smallest distance between two parallel lines enclosing the polygon.
+    double width;
+    geometry::Rectangle2D minimum_area_rectangle;
+    geometry::Rectangle2D minimum_perimeter_rectangle;
+};
+
+using CaliperMeasures2D = BasicCaliperMeasures2D<double>;
+
+/**
+ * @brief Rotates calipers around a convex polygon, in O(h).
+ *
+ * For every edge the vertices farthest along the edge, farthest from its line and farthest back along it are found by
+ * advancing three pointers, each of which goes around the polygon once. The vertex farthest from the line of an edge
+ * and the endpoints of the edge form the antipodal pairs, among which a farthest pair is found, and its distance to
+ * the line is the width in the direction of the edge. The three extreme vertices bound the enclosing rectangle with a
+ * side on the edge, and an enclosing rectangle of minimum area or perimeter has a side on an edge of the polygon.
+ *
+ * The pointers advance on cross and dot products evaluated like util::GetCrossValue and util::GetDotValue, exactly for
+ * integer coordinates. The widths and rectangles are computed in double.
+ *
+ * @param hull The vertices of a convex polygon in counter-clockwise order without collinear ones, as returned by the
+ * convex hull functions.
+ * @return The measures, none if the polygon has fewer than 3 vertices.
+ */
+template <typename T>
+std::optional<BasicCaliperMeasures2D<T>> RotateCalipers(std::span<const geometry::BasicPoint2D<T>> hull) {
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+    const size_t size = hull.size();
+    if (size < 3) {
+        return std::nullopt;
+    }
+    auto Next = [size](size_t i) { return i + 1 == size ? 0 : i + 1; };
+
+    BasicCaliperMeasures2D<T> measures;
+    measures.width = std::numeric_limits<double>::infinity();
+    Accumulator max_squared_distance{0};
+    double min_area = std::numeric_limits<double>::infinity();
+    double min_perimeter = std::numeric_limits<double>::infinity();
+    // farthest along, from and back along the edge
+    size_t right = 1;
+    size_t top = 1;
+    size_t left = 1;
+    for (size_t i = 0; i < size; ++i) {
+        const auto& p = hull[i];
+        const auto& q = hull[Next(i)];
+        while (util::GetDotValue(p, q, hull[Next(right)]) > util::GetDotValue(p, q, hull[right])) {
+            right = Next(right);
+        }
+        if (i == 0) {
+            top = right;
+        }
+        while (util::GetCrossValue(p, q, hull[Next(top)]) > util::GetCrossValue(p, q, hull[top])) {
+            top = Next(top);
+        }
+        if (i == 0) {
+            left = top;
+        }
+        while (util::GetDotValue(p, q, hull[Next(left)]) < util::GetDotValue(p, q, hull[left])) {
+            left = Next(left);
+        }
+
+        for (const auto& endpoint : {p, q}) {
+            Accumulator squared_distance = util::GetDotValue(endpoint, hull[top], hull[top]);
+            if (squared_distance > max_squared_distance) {
+                max_squared_distance = squared_distance;
+                measures.diameter = {endpoint, hull[top]};
+            }
+        }
+
+        // The rectangle spans [low, high] times the edge along it and height times the edge perpendicular to it.
+        const double squared_length = static_cast<double>(util::GetDotValue(p, q, q));
+        const double length = std::sqrt(squared_length);
+        const double low = static_cast<double>(util::GetDotValue(p, q, hull[left])) / squared_length;
+        const double high = static_cast<double>(util::GetDotValue(p, q, hull[right])) / squared_length;
+        const double height = static_cast<double>(util::GetCrossValue(p, q, hull[top])) / squared_length;
+        measures.width = std::min(measures.width, height * length);
+        const double area = (high - low) * height * squared_length;
+        const double perimeter = 2.0 * (high - low + height) * length;
+        if (area < min_area || perimeter < min_perimeter) {
+            const double p_x = static_cast<double>(p.coords[0]);
+            const double p_y = static_cast<double>(p.coords[1]);
+            const double edge_x = static_cast<double>(q.coords[0]) - p_x;
+            const double edge_y = static_cast<double>(q.coords[1]) - p_y;
+            geometry::Rectangle2D rectangle = {{
+                {p_x + low * edge_x, p_y + low * edge_y},
+                {p_x + high * edge_x, p_y + high * edge_y},
+                {p_x + high * edge_x - height * edge_y, p_y + high * edge_y + height * edge_x},
+                {p_x + low * edge_x - height * edge_y, p_y + low * edge_y + height * edge_x},
+            }};
+            if (area < min_area) {
+                min_area = area;
+                measures.minimum_area_rectangle = rectangle;
+            }
+            if (perimeter < min_perimeter) {
+                min_perimeter = perimeter;
+                measures.minimum_perimeter_rectangle = rectangle;
+            }
+        }
+    }
+    return measures;
+}
+
+/**
+ * @brief Computes the measures of a convex polygon in one pass of RotateCalipers, cheaper than the single measures
+ * one by one.
+ *
+ * @param hull The vertices of a convex polygon in counter-clockwise order without collinear ones, e.g. a
+ * std::vector or std::span of points as returned by the convex hull functions.
+ * @return The measures, none if the polygon has fewer than 3 vertices.
+ */
+template <typename Hull>
+auto GetCaliperMeasures(const Hull& hull) {
+    using T = typename std::remove_cvref_t<decltype(*std::data(hull))>::Scalar;
+    return RotateCalipers<T>({std::data(hull), std::size(hull)});
+}
+
+/**
+ * @brief Finds two vertices of a convex polygon at the largest distance, in O(h).
+ *
+ * @param hull The vertices of a convex polygon in counter-clockwise order without collinear ones.
+ * @return The farthest pair, none if the polygon has fewer than 3 vertices.
+ */
+template <typename Hull>
+auto GetDiameter(const Hull& hull) {
+    auto measures = GetCaliperMeasures(hull);
+    return measures ? std::optional(measures->diameter) : std::nullopt;
+}
+
+/**
+ * @brief Computes the smallest distance between two parallel lines enclosing a convex polygon, in O(h).
+ *
+ * @param hull The vertices of a convex polygon in counter-clockwise order without collinear ones.
+ * @return The width, none if the polygon has fewer than 3 vertices.
+ */
+template <typename Hull>
+std::optional<double> GetWidth(const Hull& hull) {
+    auto measures = GetCaliperMeasures(hull);
+    return measures ? std::optional(measures->width) : std::nullopt;
+}
+
+/**
+ * @brief Computes the enclosing rectangle of minimum area of a convex polygon, in O(h).
+ *
+ * @param hull The vertices of a convex polygon in counter-clockwise order without collinear ones.
+ * @return The rectangle, which has a side on an edge of the polygon, none if the polygon has fewer than 3 vertices.
+ */
+template <typename Hull>
+std::optional<geometry::Rectangle2D> GetMinimumAreaRectangle(const Hull& hull) {
+    auto measures = GetCaliperMeasures(hull);
+    return measures ? std::optional(measures->minimum_area_rectangle) : std::nullopt;
+}
+
+/**
+ * @brief Computes the enclosing rectangle of minimum perimeter of a convex polygon, in O(h).
+ *
+ * @param hull The vertices of a convex polygon in counter-clockwise order without collinear ones.
+ * @return The rectangle, which has a side on an edge of the polygon, none if the polygon has fewer than 3 vertices.
+ */
+template <typename Hull>
+std::optional<geometry::Rectangle2D> GetMinimumPerimeterRectangle(const Hull& hull) {
+    auto measures = GetCaliperMeasures(hull);
+    return measures ? std::optional(measures->minimum_perimeter_rectangle) : std::nullopt;
+}
+
+/**
+ * @brief Computes the measures of many convex polygons in parallel, e.g. of the hulls convex_hull::GetConvexHulls
+ * returns, so that points go to oriented bounding boxes in linear time after the sorting.
+ *
+ * @param hull_points The vertices of all polygons, every polygon in counter-clockwise order without collinear
+ * vertices.
+ * @param hull_offsets The first vertex of every polygon followed by the end of the last polygon, in the layout of
+ * convex_hull::GetConvexHulls. Empty or a single entry for no polygons.
+ * @param measures Receives the measures of every polygon, none for those with fewer than 3 vertices.
+ * @param thread_pool The threads to run on.
+ */
+template <typename T, typename Allocator>
+void GetCaliperMeasures(std::type_identity_t<std::span<const geometry::BasicPoint2D<T>>> hull_points,
+                        std::span<const size_t> hull_offsets,
+                        std::vector<std::optional<BasicCaliperMeasures2D<T>>, Allocator>& measures,
+                        euclid::util::ThreadPool& thread_pool) {
+    const size_t num_hulls = hull_offsets.size() < 2 ? 0 : hull_offsets.size() - 1;
+    measures.resize(num_hulls);
+    // At least 4 chunks per thread, so that stealing can even out hulls of different sizes.
+    const size_t num_chunks = std::min(num_hulls, 4 * thread_pool.NumThreads());
+    thread_pool.ParallelFor(num_chunks, [&](size_t chunk, size_t) {
+        const size_t last_hull = num_hulls * (chunk + 1) / num_chunks;
+        for (size_t hull = num_hulls * chunk / num_chunks; hull < last_hull; ++hull) {
+            measures[hull] = RotateCalipers<T>(
+                hull_points.subspan(hull_offsets[hull], hull_offsets[hull + 1] - hull_offsets[hull]));
+        }
+    });
+}
+
+}  // namespace euclid::algorithm::rotating_calipers
@@ -0,0 +1,165 @@
+#pragma once
+
+/**
+ * @file grid.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "algorithm/segment_intersection/sweep.h"
+#include "geometry/box_2d.h"
+#include "geometry/segment_2d.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::segment_intersection {
+
+/**
+ * @brief The number of segments per grid cell ForEachSegmentIntersectionByGrid aims at.
+ */
+inline constexpr size_t kSegmentGridCellSegments = 16;
+
+/**
+ * @brief Grid cells with at most this many segments are tested pairwise instead of swept.
+ */
+inline constexpr size_t kSegmentGridPairwiseSegments = 32;
+
+/**
+ * @brief Calls callback(i, j, thread) with i < j once for every pair of intersecting segments, by a uniform grid
+ * whose cells are handled in parallel, for sets of mostly short segments like road networks.
+ *
+ * Every segment is listed in the cells its bounding box overlaps, cells hold about kSegmentGridCellSegments segments
+ * and are at least as wide as the mean segment box. A cell tests its segments pairwise when they are few and sweeps
+ * them with BasicSegmentSweep otherwise, and it reports a pair only if it holds the lower left corner of the overlap
+ * of their boxes, which both segments are listed in, so that every pair is reported by exactly one cell. A segment is
+ * copied to every cell its box overlaps, so a few long segments are fine, but a set of long segments is best swept
+ * with ForEachSegmentIntersection.
+ *
+ * @param segments The segments, fewer than 2^32 - 1.
+ * @param thread_pool Runs the cells.
+ * @param callback Called concurrently from the threads of the pool, with the indices of the segments of every
+ * intersecting pair and the index of the calling thread, in [0, thread_pool.NumThreads()).
+ */
+template <typename T, typename Callback>
+void ForEachSegmentIntersectionByGrid(const std::vector<geometry::BasicSegment2D<T>>& segments,
+                                      euclid::util::ThreadPool& thread_pool, Callback&& callback) {
+    const size_t size = segments.size();
+    if (size < 2) {
+        return;
+    }
+    std::vector<geometry::Box2D> boxes(size);
+    geometry::Box2D bounds = {{HUGE_VAL, HUGE_VAL}, {-HUGE_VAL, -HUGE_VAL}};
+    double extent_sum = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+        auto& box = boxes[i];
+        for (size_t axis = 0; axis < 2; ++axis) {
+            const double a = static_cast<double>(segments[i].endpoints[0].coords[axis]);
+            const double b = static_cast<double>(segments[i].endpoints[1].coords[axis]);
+            box.min_corner.coords[axis] = std::min(a, b);
+            box.max_corner.coords[axis] = std::max(a, b);
+            bounds.min_corner.coords[axis] = std::min(bounds.min_corner.coords[axis], box.min_corner.coords[axis]);
+            bounds.max_corner.coords[axis] = std::max(bounds.max_corner.coords[axis], box.max_corner.coords[axis]);
+        }
+        extent_sum += std::max(box.max_corner.coords[0] - box.min_corner.coords[0],
+                               box.max_corner.coords[1] - box.min_corner.coords[1]);
+    }
+
+    // Square cells, no smaller than the mean segment and few enough for about kSegmentGridCellSegments segments
+    // each, also on a strip.
+    const double width = bounds.max_corner.coords[0] - bounds.min_corner.coords[0];
+    const double height = bounds.max_corner.coords[1] - bounds.min_corner.coords[1];
+    const double num_target_cells = static_cast<double>(std::max<size_t>(1, size / kSegmentGridCellSegments));
+    double cell_size = std::max({extent_sum / static_cast<double>(size), std::sqrt(width * height / num_target_cells),
+                                 std::max(width, height) / num_target_cells});
+    if (!(cell_size > 0.0)) {
+        cell_size = 1.0;
+    }
+    const double inverse_cell_size = 1.0 / cell_size;
+    const size_t num_columns = static_cast<size_t>(width * inverse_cell_size) + 1;
+    const size_t num_rows = static_cast<size_t>(height * inverse_cell_size) + 1;
+    auto GetCell = [&](double value, size_t axis) {
+        const double offset = (value - bounds.min_corner.coords[axis]) * inverse_cell_size;
+        return std::min((axis == 0 ? num_columns : num_rows) - 1, static_cast<size_t>(offset));
+    };
+
+    // The segments of every cell, back to back by cell.
+    const size_t num_cells = num_columns * num_rows;
+    std::vector<size_t> offsets(num_cells + 1, 0);
+    auto ForEachCell = [&](const geometry::Box2D& box, auto&& function) {
+        const size_t last_column = GetCell(box.max_corner.coords[0], 0);
+        const size_t last_row = GetCell(box.max_corner.coords[1], 1);
+        for (size_t row = GetCell(box.min_corner.coords[1], 1); row <= last_row; ++row) {
+            for (size_t column = GetCell(box.min_corner.coords[0], 0); column <= last_column; ++column) {
+                function(row * num_columns + column);
+            }
+        }
+    };
+    for (const auto& box : boxes) {
+        ForEachCell(box, [&](size_t cell) { offsets[cell + 1]++; });
+    }
+    for (size_t cell = 0; cell < num_cells; ++cell) {
+        offsets[cell + 1] += offsets[cell];
+    }
+    std::vector<uint32_t> cell_segments(offsets[num_cells]);
+    {
+        std::vector<size_t> positions(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < size; ++i) {
+            ForEachCell(boxes[i], [&](size_t cell) { cell_segments[positions[cell]++] = static_cast<uint32_t>(i); });
+        }
+    }
+
+    // Padded so that the workspaces of different threads do not share a cache line.
+    struct alignas(64) ThreadWorkspace {
+        BasicSegmentSweep<T> sweep;
+        std::vector<geometry::BasicSegment2D<T>> segments;
+    };
+    std::vector<ThreadWorkspace> workspaces(thread_pool.NumThreads());
+    thread_pool.ParallelFor(num_cells, [&](size_t cell, size_t thread) {
+        const std::span<const uint32_t> indices(cell_segments.data() + offsets[cell],
+                                                cell_segments.data() + offsets[cell + 1]);
+        if (indices.size() < 2) {
+            return;
+        }
+        auto IsReferenceCell = [&](size_t i, size_t j) {
+            const double x = std::max(boxes[i].min_corner.coords[0], boxes[j].min_corner.coords[0]);
+            const double y = std::max(boxes[i].min_corner.coords[1], boxes[j].min_corner.coords[1]);
+            return GetCell(y, 1) * num_columns + GetCell(x, 0) == cell;
+        };
+        auto Report = [&](size_t i, size_t j) { callback(std::min(i, j), std::max(i, j), thread); };
+        if (indices.size() <= kSegmentGridPairwiseSegments) {
+            for (size_t a = 0; a < indices.size(); ++a) {
+                const auto& first = boxes[indices[a]];
+                for (size_t b = a + 1; b < indices.size(); ++b) {
+                    const auto& second = boxes[indices[b]];
+                    if (first.min_corner.coords[0] <= second.max_corner.coords[0] &&
+                        second.min_corner.coords[0] <= first.max_corner.coords[0] &&
+                        first.min_corner.coords[1] <= second.max_corner.coords[1] &&
+                        second.min_corner.coords[1] <= first.max_corner.coords[1] &&
+                        IsReferenceCell(indices[a], indices[b]) &&
+                        IsSegmentIntersecting(segments[indices[a]], segments[indices[b]])) {
+                        Report(indices[a], indices[b]);
+                    }
+                }
+            }
+            return;
+        }
+        auto& workspace = workspaces[thread];
+        workspace.segments.resize(indices.size());
+        for (size_t a = 0; a < indices.size(); ++a) {
+            workspace.segments[a] = segments[indices[a]];
+        }
+        workspace.sweep.ForEachIntersection(workspace.segments, [&](size_t a, size_t b) {
+            if (IsReferenceCell(indices[a], indices[b])) {
+                Report(indices[a], indices[b]);
+            }
+        });
+    });
+}
+
+}  // namespace euclid::algorithm::segment_intersection
@@ -0,0 +1,552 @@
+#pragma once
+
+/**
+ * @file sweep.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "algorithm/util/orient_2d.h"
+#include "algorithm/util/predicates.h"
+#include "geometry/point_2d.h"
+#include "geometry/segment_2d.h"
+
+namespace euclid::algorithm::segment_intersection {
+
+/**
+ * @brief Determines if two segments share a point, exactly, with the orientations of util::AdaptivePredicates.
+ *
+ * @return true if the segments cross, touch or overlap, false otherwise.
+ */
+template <typename T>
+bool IsSegmentIntersecting(const geometry::BasicSegment2D<T>& first, const geometry::BasicSegment2D<T>& second) {
+    using Predicates = util::AdaptivePredicates;
+    const auto& [p, q] = first.endpoints;
+    const auto& [r, s] = second.endpoints;
+    const int orientation_r = Predicates::GetOrientation(p, q, r);
+    const int orientation_s = Predicates::GetOrientation(p, q, s);
+    const int orientation_p = Predicates::GetOrientation(r, s, p);
+    const int orientation_q = Predicates::GetOrientation(r, s, q);
+    if (orientation_r * orientation_s < 0 && orientation_p * orientation_q < 0) {
+        return true;
+    }
+    // A segment that ends on the other one, IsPointOnSegment also covers the segments that are points.
+    return (orientation_r == 0 && Predicates::IsPointOnSegment(r, p, q)) ||
+           (orientation_s == 0 && Predicates::IsPointOnSegment(s, p, q)) ||
+           (orientation_p == 0 && Predicates::IsPointOnSegment(p, r, s)) ||
+           (orientation_q == 0 && Predicates::IsPointOnSegment(q, r, s));
+}
+
+/**
+ * @brief Reports the intersecting pairs of a set of segments with the sweep of Bentley and Ottmann, in
+ * O((n + k) log n) time and O(n) memory for n segments and k intersecting pairs.
+ *
+ * A line sweeps the plane from left to right, slightly tilted so that it meets the points of a vertical segment from
+ * bottom to top. The segments it crosses are kept in their order along it in a skip list whose nodes are pooled in
+ * flat arrays, so that the sweep allocates nothing once its buffers have grown. Every node knows whether its segment
+ * crosses the one of the node above it, and those crossings are queued in an indexed heap holding at most one
+ * crossing per node, which keeps the memory at O(n) however large k is.
+ *
+ * The order of the segments is decided exactly by the orientations of util::AdaptivePredicates on the input points
+ * only: at an endpoint, the segments through it are found by the side of it they pass on and reordered by the
+ * direction in which they leave it; at a crossing, the two segments just swap places, and whether two neighbours
+ * cross ahead is decided by the sides of each other their right endpoints lie on. Crossings are scheduled by bounds
+ * on the x of their points computed in floating point, and a crossing whose bounds do not tell it from the next
+ * endpoint is swapped before it exactly when the two segments pass that endpoint in the wrong order, so the segments
+ * are always in their order along the sweep line at an endpoint and a reported pair always intersects. The bounds
+ * assume coordinates that convert to double exactly, which all float, double and int32_t coordinates do.
+ *
+ * Every pair is reported once: a pair crossing in the interior of both segments when the segments swap places, or
+ * when reordered at an endpoint of another segment through the crossing, any other pair at the first point the two
+ * segments share, an endpoint of one of them. Degenerate input is allowed: vertical segments, segments that are
+ * points, shared endpoints, collinear overlaps and many segments through one point.
+ *
+ * The buffers are kept between calls, so one sweep can run on many segment sets, e.g. one per thread.
+ */
+template <typename T>
+class BasicSegmentSweep {
+public:
+    using Point = geometry::BasicPoint2D<T>;
+    using Segment = geometry::BasicSegment2D<T>;
+
+    /**
+     * @brief Calls callback(i, j) with i < j once for every pair of intersecting segments, as the sweep meets them.
+     *
+     * @param segments The segments, fewer than 2^32 - 1.
+     * @param callback Called with the indices of the segments of every intersecting pair, so that no pair needs to be
+     * buffered.
+     */
+    template <typename Callback>
+    void ForEachIntersection(std::span<const Segment> segments, Callback&& callback) {
+        Reset(segments);
+        size_t next_start = 0;
+        size_t next_end = 0;
+        while (next_start < entries_.size() || next_end < ends_.size() || !heap_.empty()) {
+            const Point* p = nullptr;
+            if (next_start < entries_.size()) {
+                p = &entries_[next_start].left;
+            }
+            if (next_end < ends_.size() && (p == nullptr || IsLess(ends_[next_end], *p))) {
+                p = &ends_[next_end];
+            }
+            if (!heap_.empty() && (p == nullptr || lower_keys_[heap_[0]] <= ToKey(*p).coords[0])) {
+                if (p == nullptr || IsCrossingBefore(heap_[0], *p)) {
+                    Swap(callback);
+                } else {
+                    // Set aside until the endpoint is handled, so that the crossings after it are looked at too.
+                    const uint32_t slot = heap_[0];
+                    RemoveCrossing(slot);
+                    heap_positions_[slot] = kDeferred;
+                    deferred_.push_back(slot);
+                }
+                continue;
+            }
+            const Point point = *p;
+            const size_t first_start = next_start;
+            while (next_start < entries_.size() && IsEqual(entries_[next_start].left, point)) {
+                next_start++;
+            }
+            while (next_end < ends_.size() && IsEqual(ends_[next_end], point)) {
+                next_end++;
+            }
+            Visit(point, first_start, next_start, callback);
+            for (const uint32_t slot : deferred_) {
+                if (heap_positions_[slot] == kDeferred) {
+                    heap_positions_[slot] = kNone;
+                    SetCrossing(slot, lower_keys_[slot], upper_keys_[slot]);
+                }
+            }
+            deferred_.clear();
+        }
+    }
+
+private:
+    using Key = geometry::Point2D;
+
+    static constexpr uint32_t kNone = UINT32_MAX;
+    // the heap position of a crossing set aside until the next endpoint is handled
+    static constexpr uint32_t kDeferred = UINT32_MAX - 1;
+    static constexpr size_t kMaxLevel = 16;
+
+    // A segment with its endpoints in sweep order, copied into the nodes so that the orientations of a search do not
+    // wander through the whole input.
+    struct Entry {
+        Point left;
+        Point right;
+        uint32_t segment;
+    };
+
+    template <typename U>
+    static bool IsLess(const geometry::BasicPoint2D<U>& a, const geometry::BasicPoint2D<U>& b) {
+        return a.coords[0] < b.coords[0] || (a.coords[0] == b.coords[0] && a.coords[1] < b.coords[1]);
+    }
+
+    static bool IsEqual(const Point& a, const Point& b) {
+        return a.coords[0] == b.coords[0] && a.coords[1] == b.coords[1];
+    }
+
+    static Key ToKey(const Point& point) {
+        return {static_cast<double>(point.coords[0]), static_cast<double>(point.coords[1])};
+    }
+
+    static int GetOrientation(const Point& p, const Point& q, const Point& r) {
+        return util::AdaptivePredicates::GetOrientation(p, q, r);
+    }
+
+    /**
+     * @brief The level count of a node, 1 + the number of trailing pairs of zero bits of a hash of its index, i.e.
+     * geometric with ratio 1/4 like a coin-flipped skip list, but the same on every run.
+     */
+    static uint8_t GetHeight(uint64_t slot) {
+        uint64_t hash = slot + 0x9e3779b97f4a7c15ULL;
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+        return static_cast<uint8_t>(std::min<size_t>(kMaxLevel, 1 + std::countr_zero(hash) / 2));
+    }
+
+    uint32_t& Next(uint32_t slot, size_t level) { return links_[offsets_[slot] + level]; }
+
+    void Reset(std::span<const Segment> segments) {
+        const size_t size = segments.size();
+        entries_.resize(size);
+        ends_.clear();
+        for (size_t i = 0; i < size; ++i) {
+            const auto& [p, q] = segments[i].endpoints;
+            const bool is_reversed = IsLess(q, p);
+            entries_[i] = {is_reversed ? q : p, is_reversed ? p : q, static_cast<uint32_t>(i)};
+            // a segment that is a point is never inserted, so it does not end
+            if (!IsEqual(p, q)) {
+                ends_.push_back(entries_[i].right);
+            }
+        }
+        std::sort(entries_.begin(), entries_.end(),
+                  [](const Entry& a, const Entry& b) { return IsLess(a.left, b.left); });
+        std::sort(ends_.begin(), ends_.end(), IsLess<T>);
+
+        // One node per segment at most is in the list, plus the head, which has every level.
+        head_ = static_cast<uint32_t>(size);
+        heights_.resize(size + 1);
+        offsets_.resize(size + 2);
+        offsets_[0] = 0;
+        for (size_t slot = 0; slot <= size; ++slot) {
+            heights_[slot] = slot == size ? kMaxLevel : GetHeight(slot);
+            offsets_[slot + 1] = offsets_[slot] + heights_[slot];
+        }
+        links_.assign(offsets_[size + 1], kNone);
+        previous_.assign(size + 1, kNone);
+        nodes_.resize(size);
+        free_slots_.resize(size);
+        for (size_t i = 0; i < size; ++i) {
+            free_slots_[i] = static_cast<uint32_t>(size - 1 - i);
+        }
+        num_levels_ = 1;
+        heap_.clear();
+        heap_positions_.assign(size, kNone);
+        lower_keys_.resize(size);
+        upper_keys_.resize(size);
+        deferred_.clear();
+    }
+
+    template <typename Callback>
+    static void Report(uint32_t a, uint32_t b, Callback& callback) {
+        callback(static_cast<size_t>(std::min(a, b)), static_cast<size_t>(std::max(a, b)));
+    }
+
+    /**
+     * @brief Whether a segment through p lies below another one right after p, by the direction in which they leave
+     * it, and by index if they overlap.
+     */
+    static bool IsBelowAfter(const Point& p, const Entry& a, const Entry& b) {
+        const int orientation = GetOrientation(p, a.right, b.right);
+        return orientation != 0 ? orientation > 0 : a.segment < b.segment;
+    }
+
+    /**
+     * @brief Handles the endpoints at one point: reports the pairs meeting there and replaces the segments through it
+     * by those continuing and those starting there, in their order after it.
+     */
+    template <typename Callback>
+    void Visit(const Point& p, size_t first_start, size_t last_start, Callback& callback) {
+        starts_.assign(entries_.begin() + first_start, entries_.begin() + last_start);
+
+        // The nodes before the first segment not below p at every level, the segments through p follow.
+        uint32_t slot = head_;
+        uint32_t not_below = kNone;
+        for (size_t level = num_levels_; level-- > 0;) {
+            for (uint32_t next = Next(slot, level); next != kNone && next != not_below; next = Next(slot, level)) {
+                if (GetOrientation(nodes_[next].left, nodes_[next].right, p) <= 0) {
+                    not_below = next;
+                    break;
+                }
+                slot = next;
+            }
+            update_[level] = slot;
+        }
+        run_.clear();
+        for (uint32_t next = Next(update_[0], 0); next != kNone; next = Next(next, 0)) {
+            if (GetOrientation(nodes_[next].left, nodes_[next].right, p) != 0) {
+                break;
+            }
+            run_.push_back(nodes_[next]);
+        }
+
+        // Pairs with a segment starting at p, which is the first point they share.
+        for (size_t i = 0; i < starts_.size(); ++i) {
+            for (const Entry& entry : run_) {
+                Report(starts_[i].segment, entry.segment, callback);
+            }
+            for (size_t j = 0; j < i; ++j) {
+                Report(starts_[i].segment, starts_[j].segment, callback);
+            }
+        }
+        // Pairs with a segment ending at p, unless they overlap along a line up to p and met at an earlier start.
+        continuing_.clear();
+        for (size_t i = 0; i < run_.size(); ++i) {
+            const Entry& entry = run_[i];
+            if (!IsEqual(entry.right, p)) {
+                continuing_.push_back(entry);
+                continue;
+            }
+            for (size_t j = 0; j < run_.size(); ++j) {
+                const Entry& other = run_[j];
+                if ((j < i && IsEqual(other.right, p)) || j == i) {
+                    continue;
+                }
+                if (GetOrientation(entry.left, p, other.left) != 0) {
+                    Report(entry.segment, other.segment, callback);
+                }
+            }
+        }
+        // Continuing segments crossing at p swap places unless a crossing swap did so already, the insertion sort
+        // visits every such pair once.
+        for (size_t i = 1; i < continuing_.size(); ++i) {
+            for (size_t j = i; j > 0 && IsBelowAfter(p, continuing_[j], continuing_[j - 1]); --j) {
+                Report(continuing_[j].segment, continuing_[j - 1].segment, callback);
+                std::swap(continuing_[j], continuing_[j - 1]);
+            }
+        }
+        std::erase_if(starts_, [](const Entry& entry) { return IsEqual(entry.left, entry.right); });
+        std::sort(starts_.begin(), starts_.end(),
+                  [&](const Entry& a, const Entry& b) { return IsBelowAfter(p, a, b); });
+        merged_.resize(continuing_.size() + starts_.size());
+        std::merge(continuing_.begin(), continuing_.end(), starts_.begin(), starts_.end(), merged_.begin(),
+                   [&](const Entry& a, const Entry& b) { return IsBelowAfter(p, a, b); });
+
+        // Unlink the nodes of the segments through p, then link the new ones in their place.
+        const uint32_t below = update_[0];
+        slot = Next(below, 0);
+        for (size_t i = 0; i < run_.size(); ++i) {
+            const uint32_t next = Next(slot, 0);
+            for (size_t level = 0; level < heights_[slot]; ++level) {
+                Next(update_[level], level) = Next(slot, level);
+            }
+            RemoveCrossing(slot);
+            free_slots_.push_back(slot);
+            slot = next;
+        }
+        if (slot != kNone) {
+            previous_[slot] = below;
+        }
+        for (const Entry& entry : merged_) {
+            slot = free_slots_.back();
+            free_slots_.pop_back();
+            nodes_[slot] = entry;
+            for (; num_levels_ < heights_[slot]; ++num_levels_) {
+                update_[num_levels_] = head_;
+            }
+            previous_[slot] = update_[0];
+            for (size_t level = 0; level < heights_[slot]; ++level) {
+                Next(slot, level) = Next(update_[level], level);
+                Next(update_[level], level) = slot;
+                update_[level] = slot;
+            }
+            if (const uint32_t next = Next(slot, 0); next != kNone) {
+                previous_[next] = slot;
+            }
+        }
+
+        if (below != head_) {
+            UpdateCrossing(below);
+        }
+        for (slot = Next(below, 0); slot != kNone && slot != Next(update_[0], 0); slot = Next(slot, 0)) {
+            UpdateCrossing(slot);
+        }
+    }
+
+    /**
+     * @brief Swaps the two segments of the next crossing and reports them.
+     */
+    template <typename Callback>
+    void Swap(Callback& callback) {
+        const uint32_t lower = heap_[0];
+        RemoveCrossing(lower);
+        const uint32_t upper = Next(lower, 0);
+        Report(nodes_[lower].segment, nodes_[upper].segment, callback);
+        std::swap(nodes_[lower], nodes_[upper]);
+        if (previous_[lower] != head_) {
+            UpdateCrossing(previous_[lower]);
+        }
+        UpdateCrossing(lower);
+        UpdateCrossing(upper);
+    }
+
+    /**
+     * @brief Queues the crossing of the segment of a node with the one of the node above it, if they cross in the
+     * interior of both ahead of the sweep, i.e. if each ends on the far side of the other.
+     */
+    void UpdateCrossing(uint32_t slot) {
+        const uint32_t above = Next(slot, 0);
+        if (above != kNone) {
+            const Entry& a = nodes_[slot];
+            const Entry& b = nodes_[above];
+            if (GetOrientation(a.left, a.right, b.right) < 0 && GetOrientation(b.left, b.right, a.right) > 0) {
+                double lower = 0.0;
+                double upper = 0.0;
+                GetCrossingBounds(a, b, lower, upper);
+                SetCrossing(slot, lower, upper);
+                return;
+            }
+        }
+        RemoveCrossing(slot);
+    }
+
+    /**
+     * @brief Bounds on the x of the crossing point of two crossing segments, from the point computed in floating
+     * point and its rounding error, and in any case between the left and the right endpoints of both.
+     */
+    static void GetCrossingBounds(const Entry& a, const Entry& b, double& lower, double& upper) {
+        const Key a_left = ToKey(a.left);
+        const Key a_right = ToKey(a.right);
+        const Key b_left = ToKey(b.left);
+        const Key b_right = ToKey(b.right);
+        lower = std::max(a_left.coords[0], b_left.coords[0]);
+        upper = std::min(a_right.coords[0], b_right.coords[0]);
+        const double a_x = a_right.coords[0] - a_left.coords[0];
+        const double a_y = a_right.coords[1] - a_left.coords[1];
+        const double b_x = b_right.coords[0] - b_left.coords[0];
+        const double b_y = b_right.coords[1] - b_left.coords[1];
+        const double d_x = b_left.coords[0] - a_left.coords[0];
+        const double d_y = b_left.coords[1] - a_left.coords[1];
+        // x = a_left.x + a_x * numerator / denominator. The differences, products and sums round by eps each, so
+        // numerator and denominator are off by at most 4 eps times the sums of the magnitudes of their products.
+        const double numerator = d_x * b_y - d_y * b_x;
+        const double denominator = a_x * b_y - a_y * b_x;
+        constexpr double kEpsilon = util::expansion::kEpsilon;
+        const double numerator_error = 4.0 * kEpsilon * (std::abs(d_x * b_y) + std::abs(d_y * b_x));
+        const double denominator_error = 4.0 * kEpsilon * (std::abs(a_x * b_y) + std::abs(a_y * b_x));
+        if (!(std::abs(denominator) > 2.0 * denominator_error)) {
+            return;
+        }
+        const double t = numerator / denominator;
+        const double t_error = (numerator_error + std::abs(t) * denominator_error) /
+                                   (std::abs(denominator) - denominator_error) +
+                               kEpsilon * std::abs(t);
+        const double x = a_left.coords[0] + t * a_x;
+        // doubled, and the smallest normal double for underflow
+        const double error = 2.0 * (std::abs(a_x) * t_error + 3.0 * kEpsilon * (std::abs(t * a_x) + std::abs(x))) +
+                             std::numeric_limits<double>::min();
+        if (x - error == x - error && x + error == x + error) {
+            lower = std::max(lower, x - error);
+            upper = std::min(upper, x + error);
+        }
+    }
+
+    /**
+     * @brief Whether the crossing of a node with the node above it must be swapped before the endpoint p: if it is
+     * left of p by its bounds, or if the two segments pass p in the wrong order, which means that they crossed
+     * already, or both through p.
+     */
+    bool IsCrossingBefore(uint32_t slot, const Point& p) {
+        if (upper_keys_[slot] < ToKey(p).coords[0]) {
+            return true;
+        }
+        const Entry& a = nodes_[slot];
+        const Entry& b = nodes_[Next(slot, 0)];
+        const int orientation_a = GetOrientation(a.left, a.right, p);
+        const int orientation_b = GetOrientation(b.left, b.right, p);
+        return orientation_a < orientation_b || (orientation_a == 0 && orientation_b == 0);
+    }
+
+    void SetCrossing(uint32_t slot, double lower, double upper) {
+        lower_keys_[slot] = lower;
+        upper_keys_[slot] = upper;
+        if (heap_positions_[slot] == kNone || heap_positions_[slot] == kDeferred) {
+            heap_positions_[slot] = static_cast<uint32_t>(heap_.size());
+            heap_.push_back(slot);
+        }
+        SiftUp(heap_positions_[slot]);
+        SiftDown(heap_positions_[slot]);
+    }
+
+    void RemoveCrossing(uint32_t slot) {
+        const uint32_t position = heap_positions_[slot];
+        if (position == kNone || position == kDeferred) {
+            heap_positions_[slot] = kNone;
+            return;
+        }
+        heap_positions_[slot] = kNone;
+        const uint32_t last = heap_.back();
+        heap_.pop_back();
+        if (last != slot) {
+            heap_[position] = last;
+            heap_positions_[last] = position;
+            SiftUp(position);
+            SiftDown(heap_positions_[last]);
+        }
+    }
+
+    void SiftUp(size_t position) {
+        const uint32_t slot = heap_[position];
+        while (position > 0) {
+            const size_t parent = (position - 1) / 2;
+            if (!(lower_keys_[slot] < lower_keys_[heap_[parent]])) {
+                break;
+            }
+            heap_[position] = heap_[parent];
+            heap_positions_[heap_[position]] = static_cast<uint32_t>(position);
+            position = parent;
+        }
+        heap_[position] = slot;
+        heap_positions_[slot] = static_cast<uint32_t>(position);
+    }
+
+    void SiftDown(size_t position) {
+        const uint32_t slot = heap_[position];
+        while (true) {
+            size_t child = 2 * position + 1;
+            if (child >= heap_.size()) {
+                break;
+            }
+            if (child + 1 < heap_.size() && lower_keys_[heap_[child + 1]] < lower_keys_[heap_[child]]) {
+                child++;
+            }
+            if (!(lower_keys_[heap_[child]] < lower_keys_[slot])) {
+                break;
+            }
+            heap_[position] = heap_[child];
+            heap_positions_[heap_[position]] = static_cast<uint32_t>(position);
+            position = child;
+        }
+        heap_[position] = slot;
+        heap_positions_[slot] = static_cast<uint32_t>(position);
+    }
+
+    // the segments, the lexicographically smaller endpoint left, in sweep order of it
+    std::vector<Entry> entries_;
+    // the right endpoints in sweep order
+    std::vector<Point> ends_;
+
+    // The skip list: node i has heights_[i] links to the next nodes, at links_[offsets_[i]] on, and holds the segment
+    // nodes_[i]. The head is node n, no segment has more than one node, and the free nodes are reused
+    // last in first out, so that the nodes in use stay close together.
+    std::vector<uint8_t> heights_;
+    std::vector<uint32_t> offsets_;
+    std::vector<uint32_t> links_;
+    std::vector<uint32_t> previous_;
+    std::vector<Entry> nodes_;
+    std::vector<uint32_t> free_slots_;
+    uint32_t head_ = 0;
+    size_t num_levels_ = 1;
+    uint32_t update_[kMaxLevel] = {};
+
+    // The crossings of the nodes with the nodes above them, a min-heap of nodes by the lower bounds on the x of
+    // their crossing points, and those set aside until the next endpoint is handled.
+    std::vector<uint32_t> heap_;
+    std::vector<uint32_t> heap_positions_;
+    std::vector<double> lower_keys_;
+    std::vector<double> upper_keys_;
+    std::vector<uint32_t> deferred_;
+
+    // scratch of Visit
+    std::vector<Entry> starts_;
+    std::vector<Entry> run_;
+    std::vector<Entry> continuing_;
+    std::vector<Entry> merged_;
+};
+
+using SegmentSweep = BasicSegmentSweep<double>;
+
+/**
+ * @brief Calls callback(i, j) with i < j once for every pair of intersecting segments, see BasicSegmentSweep.
+ *
+ * @param segments The segments, fewer than 2^32 - 1.
+ * @param callback Called with the indices of the segments of every intersecting pair as they are found.
+ */
+template <typename T, typename Callback>
+void ForEachSegmentIntersection(const std::vector<geometry::BasicSegment2D<T>>& segments, Callback&& callback) {
+    BasicSegmentSweep<T> sweep;
+    sweep.ForEachIntersection(segments, callback);
+}
+
+}  // namespace euclid::algorithm::segment_intersection
@@ -0,0 +1,179 @@
+#pragma once
+
+/**
+ * @file batch.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "algorithm/spatial_index/neighbor.h"
+#include "algorithm/util/sort.h"
+#include "geometry/box_2d.h"
+#include "geometry/point_2d.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::spatial_index {
+
+/**
+ * @brief The number of queries a thread takes at a time in the batched queries.
+ */
+inline constexpr size_t kBatchQueryChunkSize = 256;
+
+/**
+ * @brief Runs query(query_index, workspace) for every query on a thread pool, with a workspace per thread.
+ *
+ * The queries run in chunks of kBatchQueryChunkSize in the Hilbert order of their locations, so that consecutive
+ * queries of a thread visit mostly the same nodes and find them in cache. On random queries this more than halves
+ * the time of the queries of a large index.
+ */
+template <typename Query>
+void RunQueries(std::span<const geometry::Point2D> locations, euclid::util::ThreadPool& thread_pool, Query&& query) {
+    const auto order = util::GetSpatialOrder(locations, util::SpaceFillingCurve::kHilbert, thread_pool);
+    // Padded so that the workspaces of different threads do not share a cache line.
+    struct alignas(64) ThreadWorkspace {
+        QueryWorkspace workspace;
+    };
+    std::vector<ThreadWorkspace> workspaces(thread_pool.NumThreads());
+    const size_t num_chunks = (order.size() + kBatchQueryChunkSize - 1) / kBatchQueryChunkSize;
+    thread_pool.ParallelFor(num_chunks, [&](size_t chunk, size_t thread) {
+        const size_t last = std::min(order.size(), (chunk + 1) * kBatchQueryChunkSize);
+        for (size_t i = chunk * kBatchQueryChunkSize; i < last; ++i) {
+            query(static_cast<size_t>(order[i]), workspaces[thread].workspace);
+        }
+    });
+}
+
+/**
+ * @brief Collects the points every query visits in parallel, back to back in the order of the queries.
+ *
+ * The queries run as in RunQueries, every chunk collects its points separately, then the points of every query are
+ * copied to the prefix sum of the numbers of points of the queries before it.
+ *
+ * @param query Called as query(query_index, visit), calls visit(index) for every point found.
+ */
+template <typename Query>
+void CollectQueries(std::span<const geometry::Point2D> locations, std::vector<size_t>& indices,
+                    std::vector<size_t>& offsets, euclid::util::ThreadPool& thread_pool, Query&& query) {
+    const size_t num_queries = locations.size();
+    const auto order = util::GetSpatialOrder(locations, util::SpaceFillingCurve::kHilbert, thread_pool);
+    const size_t num_chunks = (num_queries + kBatchQueryChunkSize - 1) / kBatchQueryChunkSize;
+    std::vector<std::vector<size_t>> chunk_indices(num_chunks);
+    // the first point of every query within its chunk
+    std::vector<size_t> chunk_offsets(num_queries);
+    offsets.assign(num_queries + 1, 0);
+    thread_pool.ParallelFor(num_chunks, [&](size_t chunk, size_t) {
+        auto& found = chunk_indices[chunk];
+        const size_t last = std::min(num_queries, (chunk + 1) * kBatchQueryChunkSize);
+        for (size_t i = chunk * kBatchQueryChunkSize; i < last; ++i) {
+            const size_t query_index = order[i];
+            chunk_offsets[query_index] = found.size();
+            query(query_index, [&found](size_t index) { found.push_back(index); });
+            offsets[query_index + 1] = found.size() - chunk_offsets[query_index];
+        }
+    });
+    for (size_t i = 0; i < num_queries; ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    indices.resize(offsets[num_queries]);
+    thread_pool.ParallelFor(num_chunks, [&](size_t chunk, size_t) {
+        const auto& found = chunk_indices[chunk];
+        const size_t last = std::min(num_queries, (chunk + 1) * kBatchQueryChunkSize);
+        for (size_t i = chunk * kBatchQueryChunkSize; i < last; ++i) {
+            const size_t query_index = order[i];
+            std::copy(found.begin() + chunk_offsets[query_index],
+                      found.begin() + chunk_offsets[query_index] + (offsets[query_index + 1] - offsets[query_index]),
+                      indices.begin() + offsets[query_index]);
+        }
+    });
+}
+
+/**
+ * @brief Finds the nearest point of many query points in parallel.
+ *
+ * @tparam SpatialIndex KdTree2D or PackedRTree2D.
+ * @param spatial_index The index of the points.
+ * @param queries The query points.
+ * @param nearest Receives the index of the nearest point of every query, kNoNeighbor if the index is empty.
+ * @param thread_pool The threads to run on.
+ */
+template <typename SpatialIndex>
+void GetNearest(const SpatialIndex& spatial_index, std::span<const geometry::Point2D> queries,
+                std::vector<size_t>& nearest, euclid::util::ThreadPool& thread_pool) {
+    nearest.resize(queries.size());
+    RunQueries(queries, thread_pool, [&](size_t i, QueryWorkspace& workspace) {
+        nearest[i] = spatial_index.Nearest(queries[i], workspace).value_or(kNoNeighbor);
+    });
+}
+
+/**
+ * @brief Finds the k nearest points of many query points in parallel.
+ *
+ * @tparam SpatialIndex KdTree2D or PackedRTree2D.
+ * @param spatial_index The index of the points.
+ * @param queries The query points.
+ * @param k The number of points per query.
+ * @param neighbors Receives min(k, spatial_index.Size()) indices per query back to back, those of every query
+ * ordered by distance, then by index.
+ * @param thread_pool The threads to run on.
+ */
+template <typename SpatialIndex>
+void GetKNearest(const SpatialIndex& spatial_index, std::span<const geometry::Point2D> queries, size_t k,
+                 std::vector<size_t>& neighbors, euclid::util::ThreadPool& thread_pool) {
+    const size_t num_neighbors = std::min(k, spatial_index.Size());
+    neighbors.resize(queries.size() * num_neighbors);
+    RunQueries(queries, thread_pool, [&](size_t i, QueryWorkspace& workspace) {
+        spatial_index.KNearest(queries[i], k, workspace);
+        for (size_t j = 0; j < num_neighbors; ++j) {
+            neighbors[i * num_neighbors + j] = workspace.neighbors[j].index;
+        }
+    });
+}
+
+/**
+ * @brief Finds the points within a distance of many query points in parallel.
+ *
+ * @tparam SpatialIndex KdTree2D or PackedRTree2D.
+ * @param spatial_index The index of the points.
+ * @param queries The query points.
+ * @param radius The distance, boundary included.
+ * @param indices Receives the indices of the points of every query back to back, in no particular order per query.
+ * @param offsets Receives the offsets of the points of every query in indices, i.e. queries.size() + 1 entries
+ * starting with 0.
+ * @param thread_pool The threads to run on.
+ */
+template <typename SpatialIndex>
+void GetInRadius(const SpatialIndex& spatial_index, std::span<const geometry::Point2D> queries, double radius,
+                 std::vector<size_t>& indices, std::vector<size_t>& offsets, euclid::util::ThreadPool& thread_pool) {
+    CollectQueries(queries, indices, offsets, thread_pool,
+                   [&](size_t i, auto&& visit) { spatial_index.ForEachInRadius(queries[i], radius, visit); });
+}
+
+/**
+ * @brief Finds the points in many boxes in parallel.
+ *
+ * @tparam SpatialIndex KdTree2D or PackedRTree2D.
+ * @param spatial_index The index of the points.
+ * @param boxes The boxes, boundaries included.
+ * @param indices Receives the indices of the points in every box back to back, in no particular order per box.
+ * @param offsets Receives the offsets of the points of every box in indices, i.e. boxes.size() + 1 entries starting
+ * with 0.
+ * @param thread_pool The threads to run on.
+ */
+template <typename SpatialIndex>
+void GetInRange(const SpatialIndex& spatial_index, std::span<const geometry::Box2D> boxes,
+                std::vector<size_t>& indices, std::vector<size_t>& offsets, euclid::util::ThreadPool& thread_pool) {
+    std::vector<geometry::Point2D> centers(boxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        centers[i] = {(boxes[i].min_corner.coords[0] + boxes[i].max_corner.coords[0]) / 2,
+                      (boxes[i].min_corner.coords[1] + boxes[i].max_corner.coords[1]) / 2};
+    }
+    CollectQueries(centers, indices, offsets, thread_pool,
+                   [&](size_t i, auto&& visit) { spatial_index.ForEachInRange(boxes[i], visit); });
+}
+
+}  // namespace euclid::algorithm::spatial_index
@@ -0,0 +1,385 @@
+#pragma once
+
+/**
+ * @file kd_tree.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "algorithm/spatial_index/neighbor.h"
+#include "geometry/box_2d.h"
+#include "geometry/point_2d.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::spatial_index {
+
+/**
+ * @brief The largest number of points in a leaf of KdTree2D, scanned linearly.
+ */
+inline constexpr size_t kKdTreeLeafPoints = 8;
+
+/**
+ * @brief A static k-d tree over a point set for nearest neighbour, radius and range queries.
+ *
+ * The tree is implicit in one array of the points without any pointers: the node of the points [begin, end) is split
+ * at its median point mid = begin + (end - begin) / 2 along the axis of the larger extent of its points, its children
+ * are [begin, mid) and [mid + 1, end). Only the axis of every node is stored, at its median. Ranges of at most
+ * kKdTreeLeafPoints points are leaves. The medians are placed with std::nth_element, O(n log n) in total.
+ *
+ * Queries walk the tree with an explicit stack, the nearer child first, and skip a child whose region is farther than
+ * the best distance so far. The regions of the nodes tile the plane, so on points along curves they reach far from
+ * their points and PackedRTree2D, whose nodes are tight boxes, prunes better. Every query returns the same points as
+ * a linear scan computing the squared distances in double, nearest neighbours ordered by distance, then by index.
+ */
+class KdTree2D {
+public:
+    KdTree2D() = default;
+
+    /**
+     * @brief Builds the tree in O(n log n).
+     *
+     * @param points The points, fewer than 2^32.
+     */
+    explicit KdTree2D(std::span<const geometry::Point2D> points) {
+        std::vector<Entry> entries = GetEntries(points);
+        axes_.resize(points.size());
+        Build(entries, 0, entries.size());
+        SetPoints(entries);
+    }
+
+    /**
+     * @brief Builds the tree on several threads, the same tree as the sequential constructor. The top levels are split
+     * sequentially until there are 4 subtrees per thread, which are then built concurrently.
+     *
+     * @param points The points, fewer than 2^32.
+     * @param thread_pool The threads to run on.
+     */
+    KdTree2D(std::span<const geometry::Point2D> points, euclid::util::ThreadPool& thread_pool) {
+        std::vector<Entry> entries = GetEntries(points);
+        axes_.resize(points.size());
+        const size_t min_subtree_points =
+            std::max(kKdTreeLeafPoints + 1, entries.size() / (4 * thread_pool.NumThreads()));
+        std::vector<std::pair<size_t, size_t>> subtrees;
+        SplitTop(entries, 0, entries.size(), min_subtree_points, subtrees);
+        thread_pool.ParallelFor(subtrees.size(), [&](size_t subtree, size_t) {
+            Build(entries, subtrees[subtree].first, subtrees[subtree].second);
+        });
+        SetPoints(entries);
+    }
+
+    size_t Size() const { return points_.size(); }
+
+    bool Empty() const { return points_.empty(); }
+
+    /**
+     * @brief Finds the point nearest to a query point, of equally near ones that of the least index.
+     *
+     * @param query The query point.
+     * @return The index of the point in the input, std::nullopt if the tree is empty.
+     */
+    std::optional<size_t> Nearest(const geometry::Point2D& query) const {
+        if (points_.empty()) {
+            return std::nullopt;
+        }
+        Neighbor nearest{std::numeric_limits<double>::infinity(), kNoNeighbor};
+        VisitNear(
+            query, [&]() { return nearest.squared_distance; },
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    nearest = std::min(nearest, Neighbor{GetSquaredDistance(query, points_[i]), indices_[i]});
+                }
+            });
+        return nearest.index;
+    }
+
+    /**
+     * @brief Nearest with the interface of the batched queries, the workspace is not needed.
+     */
+    std::optional<size_t> Nearest(const geometry::Point2D& query, QueryWorkspace&) const { return Nearest(query); }
+
+    /**
+     * @brief Finds the k points nearest to a query point into a workspace, without allocating once it has grown.
+     *
+     * @param query The query point.
+     * @param k The number of points.
+     * @param workspace Receives the min(k, Size()) nearest points in its neighbors, ordered by distance, then by index.
+     */
+    void KNearest(const geometry::Point2D& query, size_t k, QueryWorkspace& workspace) const {
+        auto& neighbors = workspace.neighbors;
+        neighbors.clear();
+        if (k == 0) {
+            return;
+        }
+        VisitNear(
+            query, [&]() { return GetNeighborBound(neighbors, k); },
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    AddNeighbor(neighbors, k, {GetSquaredDistance(query, points_[i]), indices_[i]});
+                }
+            });
+        std::sort_heap(neighbors.begin(), neighbors.end());
+    }
+
+    /**
+     * @brief Finds the k points nearest to a query point.
+     *
+     * @param query The query point.
+     * @param k The number of points.
+     * @return The indices of the min(k, Size()) nearest points, ordered by distance, then by index.
+     */
+    std::vector<size_t> KNearest(const geometry::Point2D& query, size_t k) const {
+        QueryWorkspace workspace;
+        KNearest(query, k, workspace);
+        std::vector<size_t> indices(workspace.neighbors.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = workspace.neighbors[i].index;
+        }
+        return indices;
+    }
+
+    /**
+     * @brief Calls visit(index) for every point within a distance of a query point, boundary included, in no
+     * particular order.
+     *
+     * @param query The query point.
+     * @param radius The distance, none if negative.
+     * @param visit Called with the index of every point in the input.
+     */
+    template <typename Visit>
+    void ForEachInRadius(const geometry::Point2D& query, double radius, Visit&& visit) const {
+        if (points_.empty() || radius < 0.0) {
+            return;
+        }
+        const double squared_radius = radius * radius;
+        VisitNear(
+            query, [squared_radius]() { return squared_radius; },
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (GetSquaredDistance(query, points_[i]) <= squared_radius) {
+                        visit(static_cast<size_t>(indices_[i]));
+                    }
+                }
+            });
+    }
+
+    /**
+     * @brief Finds the points within a distance of a query point, boundary included.
+     *
+     * @return The indices of the points in no particular order.
+     */
+    std::vector<size_t> Radius(const geometry::Point2D& query, double radius) const {
+        std::vector<size_t> indices;
+        ForEachInRadius(query, radius, [&indices](size_t index) { indices.push_back(index); });
+        return indices;
+    }
+
+    /**
+     * @brief Calls visit(index) for every point in a box, boundary included, in no particular order.
+     *
+     * @param box The box.
+     * @param visit Called with the index of every point in the input.
+     */
+    template <typename Visit>
+    void ForEachInRange(const geometry::Box2D& box, Visit&& visit) const {
+        if (points_.empty()) {
+            return;
+        }
+        Node stack[kMaxDepth];
+        size_t stack_size = 0;
+        stack[stack_size++] = {0, static_cast<uint32_t>(points_.size())};
+        while (stack_size > 0) {
+            const Node node = stack[--stack_size];
+            size_t begin = node.begin;
+            size_t end = node.end;
+            while (end - begin > kKdTreeLeafPoints) {
+                const size_t mid = begin + (end - begin) / 2;
+                const size_t axis = axes_[mid];
+                const double split = points_[mid].coords[axis];
+                const bool is_left = box.min_corner.coords[axis] <= split;
+                const bool is_right = box.max_corner.coords[axis] >= split;
+                if (is_left && is_right) {
+                    if (IsInBox(points_[mid], box)) {
+                        visit(static_cast<size_t>(indices_[mid]));
+                    }
+                    stack[stack_size++] = {static_cast<uint32_t>(mid + 1), static_cast<uint32_t>(end)};
+                }
+                if (is_left) {
+                    end = mid;
+                } else if (is_right) {
+                    begin = mid + 1;
+                } else {
+                    // a box with a NaN corner
+                    end = begin;
+                }
+            }
+            for (size_t i = begin; i < end; ++i) {
+                if (IsInBox(points_[i], box)) {
+                    visit(static_cast<size_t>(indices_[i]));
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Finds the points in a box, boundary included.
+     *
+     * @return The indices of the points in no particular order.
+     */
+    std::vector<size_t> Range(const geometry::Box2D& box) const {
+        std::vector<size_t> indices;
+        ForEachInRange(box, [&indices](size_t index) { indices.push_back(index); });
+        return indices;
+    }
+
+private:
+    // a point and its index in the input while building
+    struct Entry {
+        geometry::Point2D point;
+        size_t index;
+    };
+
+    // a subtree to visit
+    struct Node {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    // a subtree to visit by a nearest neighbour query, the offsets of the query from the region of its points per
+    // axis and the squared distance to the region, a lower bound of the distance to its points
+    struct NearNode {
+        uint32_t begin;
+        uint32_t end;
+        double offsets[2];
+        double squared_distance;
+    };
+
+    // more than the depth of a tree of 2^32 points, every level has one node on the stack at most
+    static constexpr size_t kMaxDepth = 64;
+
+    /**
+     * @brief Visits the leaves nearer to a query point than get_bound(), the nearer child of every node first.
+     *
+     * The bound of a far child replaces the offset of the query along the split axis by that from the split line and
+     * keeps the other, i.e. it is the distance to the region of the child (Arya and Mount), which prunes far more
+     * than the distance to the split line alone. Rounding is monotone, so the bound never exceeds the rounded
+     * distance to any point of the child.
+     *
+     * @param get_bound Returns the squared distance beyond which no points are needed, it may shrink in the visits.
+     * @param visit_leaf Called with the range [begin, end) of the points of every leaf visited, and of the median of
+     * every node visited.
+     */
+    template <typename GetBound, typename VisitLeaf>
+    void VisitNear(const geometry::Point2D& query, GetBound&& get_bound, VisitLeaf&& visit_leaf) const {
+        NearNode stack[kMaxDepth];
+        size_t stack_size = 0;
+        stack[stack_size++] = {0, static_cast<uint32_t>(points_.size()), {0.0, 0.0}, 0.0};
+        while (stack_size > 0) {
+            const NearNode node = stack[--stack_size];
+            if (node.squared_distance > get_bound()) {
+                continue;
+            }
+            size_t begin = node.begin;
+            size_t end = node.end;
+            while (end - begin > kKdTreeLeafPoints) {
+                const size_t mid = begin + (end - begin) / 2;
+                const size_t axis = axes_[mid];
+                visit_leaf(mid, mid + 1);
+                // The points of the far child lie beyond the split line.
+                const double difference = query.coords[axis] - points_[mid].coords[axis];
+                NearNode far = {0, 0, {node.offsets[0], node.offsets[1]}, 0.0};
+                far.offsets[axis] = difference;
+                far.squared_distance = far.offsets[0] * far.offsets[0] + far.offsets[1] * far.offsets[1];
+                if (difference < 0.0) {
+                    far.begin = static_cast<uint32_t>(mid + 1);
+                    far.end = static_cast<uint32_t>(end);
+                    end = mid;
+                } else {
+                    far.begin = static_cast<uint32_t>(begin);
+                    far.end = static_cast<uint32_t>(mid);
+                    begin = mid + 1;
+                }
+                if (far.squared_distance <= get_bound()) {
+                    stack[stack_size++] = far;
+                }
+            }
+            visit_leaf(begin, end);
+        }
+    }
+
+    static std::vector<Entry> GetEntries(std::span<const geometry::Point2D> points) {
+        std::vector<Entry> entries(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            entries[i] = {points[i], i};
+        }
+        return entries;
+    }
+
+    void SetPoints(const std::vector<Entry>& entries) {
+        points_.resize(entries.size());
+        indices_.resize(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            points_[i] = entries[i].point;
+            indices_[i] = static_cast<uint32_t>(entries[i].index);
+        }
+    }
+
+    /**
+     * @brief Places the median of a node along the axis of the larger extent of its points.
+     *
+     * @return The position of the median.
+     */
+    size_t Split(std::vector<Entry>& entries, size_t begin, size_t end) {
+        double min_x = entries[begin].point.coords[0];
+        double max_x = min_x;
+        double min_y = entries[begin].point.coords[1];
+        double max_y = min_y;
+        for (size_t i = begin + 1; i < end; ++i) {
+            min_x = std::min(min_x, entries[i].point.coords[0]);
+            max_x = std::max(max_x, entries[i].point.coords[0]);
+            min_y = std::min(min_y, entries[i].point.coords[1]);
+            max_y = std::max(max_y, entries[i].point.coords[1]);
+        }
+        const size_t axis = max_y - min_y > max_x - min_x ? 1 : 0;
+        const size_t mid = begin + (end - begin) / 2;
+        auto IsLess = [axis](const Entry& a, const Entry& b) { return a.point.coords[axis] < b.point.coords[axis]; };
+        std::nth_element(entries.begin() + begin, entries.begin() + mid, entries.begin() + end, IsLess);
+        axes_[mid] = static_cast<uint8_t>(axis);
+        return mid;
+    }
+
+    void Build(std::vector<Entry>& entries, size_t begin, size_t end) {
+        while (end - begin > kKdTreeLeafPoints) {
+            const size_t mid = Split(entries, begin, end);
+            Build(entries, begin, mid);
+            begin = mid + 1;
+        }
+    }
+
+    void SplitTop(std::vector<Entry>& entries, size_t begin, size_t end, size_t min_subtree_points,
+                  std::vector<std::pair<size_t, size_t>>& subtrees) {
+        if (end - begin < 2 * min_subtree_points) {
+            subtrees.emplace_back(begin, end);
+            return;
+        }
+        const size_t mid = Split(entries, begin, end);
+        SplitTop(entries, begin, mid, min_subtree_points, subtrees);
+        SplitTop(entries, mid + 1, end, min_subtree_points, subtrees);
+    }
+
+    std::vector<geometry::Point2D> points_;
+    // the index in the input of every point
+    std::vector<uint32_t> indices_;
+    // the split axis of every node at its median
+    std::vector<uint8_t> axes_;
+};
+
+}  // namespace euclid::algorithm::spatial_index
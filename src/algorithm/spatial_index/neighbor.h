@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file neighbor.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "geometry/box_2d.h"
+#include "geometry/point_2d.h"
+
+namespace euclid::algorithm::spatial_index {
+
+/**
+ * @brief The result of a nearest neighbour query on an empty index.
+ */
+inline constexpr size_t kNoNeighbor = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief A point found by a nearest neighbour query. Neighbours are ordered by distance, then by index, so that every
+ * index breaks ties between equally distant points the same way.
+ */
+struct Neighbor {
+    double squared_distance = 0.0;
+    size_t index = 0;
+
+    bool operator<(const Neighbor& other) const {
+        return squared_distance < other.squared_distance ||
+               (squared_distance == other.squared_distance && index < other.index);
+    }
+};
+
+/**
+ * @brief The scratch memory of the queries of a spatial index, kept by the batched queries per thread.
+ */
+struct QueryWorkspace {
+    // the k nearest points found so far, then the result
+    std::vector<Neighbor> neighbors;
+};
+
+inline double GetSquaredDistance(const geometry::Point2D& p, const geometry::Point2D& q) {
+    const double dx = p.coords[0] - q.coords[0];
+    const double dy = p.coords[1] - q.coords[1];
+    return dx * dx + dy * dy;
+}
+
+/**
+ * @brief The squared distance from a point to a box, 0 inside. Rounds no larger than GetSquaredDistance to any point
+ * of the box, so pruning by it never drops a point a linear scan would find.
+ */
+inline double GetSquaredDistance(const geometry::Point2D& point, double min_x, double min_y, double max_x,
+                                 double max_y) {
+    const double dx = std::max({min_x - point.coords[0], 0.0, point.coords[0] - max_x});
+    const double dy = std::max({min_y - point.coords[1], 0.0, point.coords[1] - max_y});
+    return dx * dx + dy * dy;
+}
+
+inline bool IsInBox(const geometry::Point2D& point, const geometry::Box2D& box) {
+    return box.min_corner.coords[0] <= point.coords[0] && point.coords[0] <= box.max_corner.coords[0] &&
+           box.min_corner.coords[1] <= point.coords[1] && point.coords[1] <= box.max_corner.coords[1];
+}
+
+/**
+ * @brief The squared distance a point must not exceed to be one of the k nearest, given the nearest found so far.
+ */
+inline double GetNeighborBound(const std::vector<Neighbor>& neighbors, size_t k) {
+    return neighbors.size() < k ? std::numeric_limits<double>::infinity() : neighbors.front().squared_distance;
+}
+
+/**
+ * @brief Offers a point to the k nearest found so far, a max-heap in neighbors.
+ */
+inline void AddNeighbor(std::vector<Neighbor>& neighbors, size_t k, const Neighbor& neighbor) {
+    if (neighbors.size() < k) {
+        neighbors.push_back(neighbor);
+        std::push_heap(neighbors.begin(), neighbors.end());
+    } else if (neighbor < neighbors.front()) {
+        std::pop_heap(neighbors.begin(), neighbors.end());
+        neighbors.back() = neighbor;
+        std::push_heap(neighbors.begin(), neighbors.end());
+    }
+}
+
+}  // namespace euclid::algorithm::spatial_index
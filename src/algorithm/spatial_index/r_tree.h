@@ -0,0 +1,383 @@
+#pragma once
+
+/**
+ * @file r_tree.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "algorithm/spatial_index/neighbor.h"
+#include "algorithm/util/sort.h"
+#include "geometry/box_2d.h"
+#include "geometry/point_2d.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::spatial_index {
+
+/**
+ * @brief The number of points in a leaf and of children of a node of PackedRTree2D, all nodes but the last of every
+ * level are full.
+ */
+inline constexpr size_t kRTreeNodeSize = 16;
+
+/**
+ * @brief A static R-tree over a point set, bulk loaded as a packed Hilbert R-tree (Kamel and Faloutsos).
+ *
+ * The points are sorted along the Hilbert curve through their bounding box with util::GetSpatialOrder, then every
+ * kRTreeNodeSize consecutive points form a leaf and every kRTreeNodeSize consecutive nodes of a level their parent, up
+ * to a single root. A node is only its bounding box, the boxes of every level are stored in flat arrays per coordinate
+ * and the children of node j are the nodes [j * kRTreeNodeSize, (j + 1) * kRTreeNodeSize) of the level below, so
+ * there are no pointers. The Hilbert order keeps the boxes small and their overlap low.
+ *
+ * Range and radius queries descend into every node their query overlaps. Nearest neighbour queries descend depth
+ * first into the children of every node in order of the distance to their boxes, and skip those farther than the
+ * k-th point found so far (Roussopoulos et al.). Every query returns the same points as a linear scan computing the
+ * squared distances in double, nearest neighbours ordered by distance, then by index.
+ */
+class PackedRTree2D {
+public:
+    PackedRTree2D() = default;
+
+    /**
+     * @brief Builds the tree in O(n), dominated by sorting the points.
+     *
+     * @param points The points, fewer than 2^32.
+     */
+    explicit PackedRTree2D(std::span<const geometry::Point2D> points) {
+        Build(points, util::GetSpatialOrder(points), 1, util::SequentialRunner{});
+    }
+
+    /**
+     * @brief Builds the tree on several threads, the same tree as the sequential constructor.
+     *
+     * @param points The points, fewer than 2^32.
+     * @param thread_pool The threads to run on.
+     */
+    PackedRTree2D(std::span<const geometry::Point2D> points, euclid::util::ThreadPool& thread_pool) {
+        Build(points, util::GetSpatialOrder(points, util::SpaceFillingCurve::kHilbert, thread_pool),
+              util::ThreadPoolRunner::GetNumChunks(points.size(), thread_pool), util::ThreadPoolRunner{thread_pool});
+    }
+
+    size_t Size() const { return points_.size(); }
+
+    bool Empty() const { return points_.empty(); }
+
+    /**
+     * @brief Finds the point nearest to a query point, of equally near ones that of the least index.
+     *
+     * @param query The query point.
+     * @return The index of the point in the input, std::nullopt if the tree is empty.
+     */
+    std::optional<size_t> Nearest(const geometry::Point2D& query) const {
+        if (points_.empty()) {
+            return std::nullopt;
+        }
+        Neighbor nearest{std::numeric_limits<double>::infinity(), kNoNeighbor};
+        VisitNear(
+            query, [&]() { return nearest.squared_distance; },
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    nearest = std::min(nearest, Neighbor{GetSquaredDistance(query, points_[i]), indices_[i]});
+                }
+            });
+        return nearest.index;
+    }
+
+    /**
+     * @brief Nearest with the interface of the batched queries, the workspace is not needed.
+     */
+    std::optional<size_t> Nearest(const geometry::Point2D& query, QueryWorkspace&) const { return Nearest(query); }
+
+    /**
+     * @brief Finds the k points nearest to a query point into a workspace, without allocating once it has grown.
+     *
+     * @param query The query point.
+     * @param k The number of points.
+     * @param workspace Receives the min(k, Size()) nearest points in its neighbors, ordered by distance, then by index.
+     */
+    void KNearest(const geometry::Point2D& query, size_t k, QueryWorkspace& workspace) const {
+        auto& neighbors = workspace.neighbors;
+        neighbors.clear();
+        if (k == 0 || points_.empty()) {
+            return;
+        }
+        VisitNear(
+            query, [&]() { return GetNeighborBound(neighbors, k); },
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    AddNeighbor(neighbors, k, {GetSquaredDistance(query, points_[i]), indices_[i]});
+                }
+            });
+        std::sort_heap(neighbors.begin(), neighbors.end());
+    }
+
+    /**
+     * @brief Finds the k points nearest to a query point.
+     *
+     * @param query The query point.
+     * @param k The number of points.
+     * @return The indices of the min(k, Size()) nearest points, ordered by distance, then by index.
+     */
+    std::vector<size_t> KNearest(const geometry::Point2D& query, size_t k) const {
+        QueryWorkspace workspace;
+        KNearest(query, k, workspace);
+        std::vector<size_t> indices(workspace.neighbors.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = workspace.neighbors[i].index;
+        }
+        return indices;
+    }
+
+    /**
+     * @brief Calls visit(index) for every point within a distance of a query point, boundary included, in no
+     * particular order.
+     *
+     * @param query The query point.
+     * @param radius The distance, none if negative.
+     * @param visit Called with the index of every point in the input.
+     */
+    template <typename Visit>
+    void ForEachInRadius(const geometry::Point2D& query, double radius, Visit&& visit) const {
+        if (radius < 0.0) {
+            return;
+        }
+        const double squared_radius = radius * radius;
+        VisitOverlapping([&](size_t box) { return GetBoxDistance(query, box) <= squared_radius; },
+                         [&](size_t begin, size_t end) {
+                             for (size_t i = begin; i < end; ++i) {
+                                 if (GetSquaredDistance(query, points_[i]) <= squared_radius) {
+                                     visit(static_cast<size_t>(indices_[i]));
+                                 }
+                             }
+                         });
+    }
+
+    /**
+     * @brief Finds the points within a distance of a query point, boundary included.
+     *
+     * @return The indices of the points in no particular order.
+     */
+    std::vector<size_t> Radius(const geometry::Point2D& query, double radius) const {
+        std::vector<size_t> indices;
+        ForEachInRadius(query, radius, [&indices](size_t index) { indices.push_back(index); });
+        return indices;
+    }
+
+    /**
+     * @brief Calls visit(index) for every point in a box, boundary included, in no particular order.
+     *
+     * @param box The box.
+     * @param visit Called with the index of every point in the input.
+     */
+    template <typename Visit>
+    void ForEachInRange(const geometry::Box2D& box, Visit&& visit) const {
+        VisitOverlapping(
+            [&](size_t node_box) {
+                return box.min_corner.coords[0] <= max_xs_[node_box] && min_xs_[node_box] <= box.max_corner.coords[0] &&
+                       box.min_corner.coords[1] <= max_ys_[node_box] && min_ys_[node_box] <= box.max_corner.coords[1];
+            },
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    if (IsInBox(points_[i], box)) {
+                        visit(static_cast<size_t>(indices_[i]));
+                    }
+                }
+            });
+    }
+
+    /**
+     * @brief Finds the points in a box, boundary included.
+     *
+     * @return The indices of the points in no particular order.
+     */
+    std::vector<size_t> Range(const geometry::Box2D& box) const {
+        std::vector<size_t> indices;
+        ForEachInRange(box, [&indices](size_t index) { indices.push_back(index); });
+        return indices;
+    }
+
+private:
+    // a node to visit, its level and its index in the level
+    struct Node {
+        uint32_t level;
+        uint32_t index;
+    };
+
+    // a node to visit by a nearest neighbour query and a lower bound of the distance to its points
+    struct NearNode {
+        double squared_distance;
+        uint32_t level;
+        uint32_t index;
+    };
+
+    // Every level leaves at most kRTreeNodeSize - 1 siblings on the stack, a tree of 2^32 points has 8 levels.
+    static constexpr size_t kMaxStackSize = 16 * kRTreeNodeSize;
+
+    /**
+     * @brief Sorts the points into the leaves and computes the boxes level by level.
+     */
+    template <typename Run>
+    void Build(std::span<const geometry::Point2D> points, std::vector<uint32_t> order, size_t num_chunks, Run&& run) {
+        const size_t size = points.size();
+        if (size == 0) {
+            return;
+        }
+        level_offsets_ = {0};
+        for (size_t num_nodes = (size + kRTreeNodeSize - 1) / kRTreeNodeSize;;
+             num_nodes = (num_nodes + kRTreeNodeSize - 1) / kRTreeNodeSize) {
+            level_offsets_.push_back(level_offsets_.back() + num_nodes);
+            if (num_nodes == 1) {
+                break;
+            }
+        }
+        const size_t num_boxes = level_offsets_.back();
+        min_xs_.resize(num_boxes);
+        min_ys_.resize(num_boxes);
+        max_xs_.resize(num_boxes);
+        max_ys_.resize(num_boxes);
+        points_.resize(size);
+        indices_ = std::move(order);
+
+        const size_t num_leaves = GetNumNodes(0);
+        run(num_chunks, [&](size_t chunk) {
+            const size_t last_leaf = num_leaves * (chunk + 1) / num_chunks;
+            for (size_t leaf = num_leaves * chunk / num_chunks; leaf < last_leaf; ++leaf) {
+                const size_t first = leaf * kRTreeNodeSize;
+                const size_t last = std::min(first + kRTreeNodeSize, size);
+                for (size_t i = first; i < last; ++i) {
+                    points_[i] = points[indices_[i]];
+                }
+                SetBox(leaf, points_.data() + first, points_.data() + last);
+            }
+        });
+        for (size_t level = 1; level + 1 < level_offsets_.size(); ++level) {
+            const size_t first_child_box = level_offsets_[level - 1];
+            const size_t num_children = GetNumNodes(level - 1);
+            for (size_t node = 0; node < GetNumNodes(level); ++node) {
+                const size_t box = level_offsets_[level] + node;
+                const size_t first = first_child_box + node * kRTreeNodeSize;
+                const size_t last = first_child_box + std::min((node + 1) * kRTreeNodeSize, num_children);
+                min_xs_[box] = *std::min_element(min_xs_.begin() + first, min_xs_.begin() + last);
+                min_ys_[box] = *std::min_element(min_ys_.begin() + first, min_ys_.begin() + last);
+                max_xs_[box] = *std::max_element(max_xs_.begin() + first, max_xs_.begin() + last);
+                max_ys_[box] = *std::max_element(max_ys_.begin() + first, max_ys_.begin() + last);
+            }
+        }
+    }
+
+    void SetBox(size_t box, const geometry::Point2D* first, const geometry::Point2D* last) {
+        min_xs_[box] = max_xs_[box] = first->coords[0];
+        min_ys_[box] = max_ys_[box] = first->coords[1];
+        for (const auto* point = first + 1; point != last; ++point) {
+            min_xs_[box] = std::min(min_xs_[box], point->coords[0]);
+            max_xs_[box] = std::max(max_xs_[box], point->coords[0]);
+            min_ys_[box] = std::min(min_ys_[box], point->coords[1]);
+            max_ys_[box] = std::max(max_ys_[box], point->coords[1]);
+        }
+    }
+
+    size_t GetNumNodes(size_t level) const { return level_offsets_[level + 1] - level_offsets_[level]; }
+
+    double GetBoxDistance(const geometry::Point2D& query, size_t box) const {
+        return GetSquaredDistance(query, min_xs_[box], min_ys_[box], max_xs_[box], max_ys_[box]);
+    }
+
+    /**
+     * @brief Visits the leaves nearer to a query point than get_bound(), depth first with the children of every node
+     * in the order of their distances, so that the bound shrinks early.
+     *
+     * @param get_bound Returns the squared distance beyond which no points are needed, it may shrink in the visits.
+     * @param visit_leaf Called with the range [begin, end) of the points of every leaf visited.
+     */
+    template <typename GetBound, typename VisitLeaf>
+    void VisitNear(const geometry::Point2D& query, GetBound&& get_bound, VisitLeaf&& visit_leaf) const {
+        NearNode stack[kMaxStackSize];
+        size_t stack_size = 0;
+        const auto root_level = static_cast<uint32_t>(level_offsets_.size() - 2);
+        stack[stack_size++] = {GetBoxDistance(query, level_offsets_[root_level]), root_level, 0};
+        while (stack_size > 0) {
+            const NearNode node = stack[--stack_size];
+            if (node.squared_distance > get_bound()) {
+                continue;
+            }
+            const size_t first = static_cast<size_t>(node.index) * kRTreeNodeSize;
+            if (node.level == 0) {
+                visit_leaf(first, std::min(first + kRTreeNodeSize, points_.size()));
+                continue;
+            }
+            const size_t child_level = node.level - 1;
+            const size_t last = std::min(first + kRTreeNodeSize, GetNumNodes(child_level));
+            const size_t children = stack_size;
+            const double bound = get_bound();
+            for (size_t child = first; child < last; ++child) {
+                const double squared_distance = GetBoxDistance(query, level_offsets_[child_level] + child);
+                if (squared_distance > bound) {
+                    continue;
+                }
+                // insertion sort of the children, the nearest on top
+                size_t i = stack_size++;
+                for (; i > children && stack[i - 1].squared_distance < squared_distance; --i) {
+                    stack[i] = stack[i - 1];
+                }
+                stack[i] = {squared_distance, static_cast<uint32_t>(child_level), static_cast<uint32_t>(child)};
+            }
+        }
+    }
+
+    /**
+     * @brief Visits the leaves whose boxes and those of all their ancestors are needed, depth first.
+     *
+     * @param is_needed Called with the index of a box in the box arrays.
+     * @param visit_leaf Called with the range [begin, end) of the points of every leaf visited.
+     */
+    template <typename IsNeeded, typename VisitLeaf>
+    void VisitOverlapping(IsNeeded&& is_needed, VisitLeaf&& visit_leaf) const {
+        if (points_.empty()) {
+            return;
+        }
+        Node stack[kMaxStackSize];
+        size_t stack_size = 0;
+        const auto root_level = static_cast<uint32_t>(level_offsets_.size() - 2);
+        if (is_needed(level_offsets_[root_level])) {
+            stack[stack_size++] = {root_level, 0};
+        }
+        while (stack_size > 0) {
+            const Node node = stack[--stack_size];
+            const size_t first = node.index * kRTreeNodeSize;
+            if (node.level == 0) {
+                visit_leaf(first, std::min(first + kRTreeNodeSize, points_.size()));
+                continue;
+            }
+            const size_t child_level = node.level - 1;
+            const size_t last = std::min(first + kRTreeNodeSize, GetNumNodes(child_level));
+            for (size_t child = first; child < last; ++child) {
+                if (is_needed(level_offsets_[child_level] + child)) {
+                    stack[stack_size++] = {static_cast<uint32_t>(child_level), static_cast<uint32_t>(child)};
+                }
+            }
+        }
+    }
+
+    // the points in Hilbert order
+    std::vector<geometry::Point2D> points_;
+    // the index in the input of every point
+    std::vector<uint32_t> indices_;
+    // the boxes of all nodes, level by level from the leaves up
+    std::vector<double> min_xs_;
+    std::vector<double> min_ys_;
+    std::vector<double> max_xs_;
+    std::vector<double> max_ys_;
+    // the first box of every level in the box arrays, followed by the number of boxes
+    std::vector<size_t> level_offsets_;
+};
+
+}  // namespace euclid::algorithm::spatial_index
@@ -0,0 +1,214 @@
+#pragma once
+
+/**
+ * @file triangle_grid.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "algorithm/spatial_index/batch.h"
+#include "algorithm/spatial_index/neighbor.h"
+#include "algorithm/util/batch_location.h"
+#include "algorithm/util/edge_equations.h"
+#include "geometry/box_2d.h"
+#include "geometry/point_2d.h"
+#include "geometry/triangle_2d.h"
+#include "util/thread_pool.h"
+
+namespace euclid::algorithm::spatial_index {
+
+/**
+ * @brief The result of locating a point in no triangle.
+ */
+inline constexpr size_t kNoTriangle = std::numeric_limits<size_t>::max();
+
+/**
+ * @brief The number of grid cells per triangle TriangleGrid2D aims at.
+ */
+inline constexpr size_t kTriangleGridCellsPerTriangle = 2;
+
+/**
+ * @brief A static uniform grid over a set of triangles, like a mesh, for locating the triangle of a point in time
+ * independent of the number of triangles.
+ *
+ * Every triangle is listed in the cells its bounding box overlaps, by increasing index. The cells are square, about
+ * kTriangleGridCellsPerTriangle per triangle and no smaller than half the mean triangle box, so that on a mesh a cell
+ * lists a handful of triangles. A point is tested only against the triangles of its cell, by their edge equations
+ * and, when it is too near an edge to tell, by the exact predicate. Locating is therefore exact, and a point on an
+ * edge shared by two triangles is in both. The build takes O(n + the number of listed triangles).
+ */
+class TriangleGrid2D {
+public:
+    TriangleGrid2D() = default;
+
+    /**
+     * @brief Builds the grid.
+     *
+     * @param triangles The triangles, in either orientation and fewer than 2^32. Degenerate triangles contain no
+     * point and are not listed.
+     */
+    explicit TriangleGrid2D(std::span<const geometry::Triangle2D> triangles)
+        : triangles_(triangles.begin(), triangles.end()) {
+        const size_t size = triangles.size();
+        equations_.resize(size);
+        double extent_sum = 0.0;
+        size_t num_listed = 0;
+        for (size_t i = 0; i < size; ++i) {
+            equations_[i] = util::GetTriangleEdgeEquations(triangles[i]);
+            const auto& box = equations_[i].box;
+            if (IsListed(i)) {
+                auto& min_corner = bounds_.min_corner;
+                auto& max_corner = bounds_.max_corner;
+                for (size_t axis = 0; axis < 2; ++axis) {
+                    min_corner.coords[axis] = std::min(min_corner.coords[axis], box.min_corner.coords[axis]);
+                    max_corner.coords[axis] = std::max(max_corner.coords[axis], box.max_corner.coords[axis]);
+                }
+                extent_sum += std::max(box.max_corner.coords[0] - box.min_corner.coords[0],
+                                       box.max_corner.coords[1] - box.min_corner.coords[1]);
+                num_listed++;
+            }
+        }
+        if (num_listed == 0) {
+            return;
+        }
+
+        // Square cells, no smaller than half the mean triangle and few enough for kTriangleGridCellsPerTriangle
+        // each, also on a strip.
+        const double width = bounds_.max_corner.coords[0] - bounds_.min_corner.coords[0];
+        const double height = bounds_.max_corner.coords[1] - bounds_.min_corner.coords[1];
+        const double num_target_cells = static_cast<double>(num_listed * kTriangleGridCellsPerTriangle);
+        double cell_size = std::max({0.5 * extent_sum / static_cast<double>(num_listed),
+                                     std::sqrt(width * height / num_target_cells),
+                                     std::max(width, height) / num_target_cells});
+        if (!(cell_size > 0.0)) {
+            cell_size = 1.0;
+        }
+        inverse_cell_size_ = 1.0 / cell_size;
+        num_columns_ = static_cast<size_t>(width * inverse_cell_size_) + 1;
+        num_rows_ = static_cast<size_t>(height * inverse_cell_size_) + 1;
+
+        // The triangles of every cell, back to back by cell.
+        const size_t num_cells = num_columns_ * num_rows_;
+        offsets_.assign(num_cells + 1, 0);
+        auto ForEachCell = [&](const geometry::Box2D& box, auto&& function) {
+            const size_t last_column = GetCell(box.max_corner.coords[0], 0);
+            const size_t last_row = GetCell(box.max_corner.coords[1], 1);
+            for (size_t row = GetCell(box.min_corner.coords[1], 1); row <= last_row; ++row) {
+                for (size_t column = GetCell(box.min_corner.coords[0], 0); column <= last_column; ++column) {
+                    function(row * num_columns_ + column);
+                }
+            }
+        };
+        for (size_t i = 0; i < size; ++i) {
+            if (IsListed(i)) {
+                ForEachCell(equations_[i].box, [&](size_t cell) { offsets_[cell + 1]++; });
+            }
+        }
+        for (size_t cell = 0; cell < num_cells; ++cell) {
+            offsets_[cell + 1] += offsets_[cell];
+        }
+        cell_triangles_.resize(offsets_[num_cells]);
+        std::vector<size_t> positions(offsets_.begin(), offsets_.end() - 1);
+        for (size_t i = 0; i < size; ++i) {
+            if (IsListed(i)) {
+                ForEachCell(equations_[i].box, [&](size_t cell) {
+                    cell_triangles_[positions[cell]++] = static_cast<uint32_t>(i);
+                });
+            }
+        }
+    }
+
+    size_t Size() const { return triangles_.size(); }
+
+    bool Empty() const { return triangles_.empty(); }
+
+    /**
+     * @brief Finds a triangle containing a point, boundary included.
+     *
+     * @param point The point to locate.
+     * @return The lowest index of the triangles containing the point, kNoTriangle if there is none.
+     */
+    size_t Locate(const geometry::Point2D& point) const {
+        const double x = point.coords[0];
+        const double y = point.coords[1];
+        if (!(x >= bounds_.min_corner.coords[0] && x <= bounds_.max_corner.coords[0] &&
+              y >= bounds_.min_corner.coords[1] && y <= bounds_.max_corner.coords[1])) {
+            return kNoTriangle;
+        }
+        const size_t cell = GetCell(y, 1) * num_columns_ + GetCell(x, 0);
+        for (size_t k = offsets_[cell]; k < offsets_[cell + 1]; ++k) {
+            const size_t i = cell_triangles_[k];
+            const int location = util::GetTriangleLocation(equations_[i], point);
+            if (location > 0 || (location == 0 && util::IsPointInClosedTriangle(point, triangles_[i]))) {
+                return i;
+            }
+        }
+        return kNoTriangle;
+    }
+
+    /**
+     * @brief Locates many points in parallel, in the Hilbert order of the points like the batched queries of the
+     * other indices so that consecutive points of a thread find their cells and triangles in cache.
+     *
+     * @param points The points to locate.
+     * @param triangles Receives the result of Locate for every point.
+     * @param thread_pool The threads to run on.
+     */
+    void Locate(std::span<const geometry::Point2D> points, std::vector<size_t>& triangles,
+                euclid::util::ThreadPool& thread_pool) const {
+        triangles.resize(points.size());
+        RunQueries(points, thread_pool, [&](size_t i, QueryWorkspace&) { triangles[i] = Locate(points[i]); });
+    }
+
+    /**
+     * @brief Checks whether a point is in any triangle, boundary included.
+     */
+    bool Contains(const geometry::Point2D& point) const { return Locate(point) != kNoTriangle; }
+
+    /**
+     * @brief Checks many points in parallel, like the batched Locate.
+     *
+     * @param points The points to check.
+     * @param mask Receives util::GetNumMaskWords(points.size()) words, bit i is set if points[i] is in a triangle.
+     * @param thread_pool The threads to run on.
+     */
+    void Contains(std::span<const geometry::Point2D> points, uint64_t* mask,
+                  euclid::util::ThreadPool& thread_pool) const {
+        std::vector<size_t> triangles;
+        Locate(points, triangles, thread_pool);
+        std::fill(mask, mask + util::GetNumMaskWords(points.size()), uint64_t{0});
+        for (size_t i = 0; i < points.size(); ++i) {
+            mask[i / 64] |= static_cast<uint64_t>(triangles[i] != kNoTriangle) << (i % 64);
+        }
+    }
+
+private:
+    bool IsListed(size_t i) const {
+        return equations_[i].box.min_corner.coords[0] <= equations_[i].box.max_corner.coords[0];
+    }
+
+    size_t GetCell(double value, size_t axis) const {
+        const double offset = (value - bounds_.min_corner.coords[axis]) * inverse_cell_size_;
+        return std::min((axis == 0 ? num_columns_ : num_rows_) - 1, static_cast<size_t>(offset));
+    }
+
+    std::vector<geometry::Triangle2D> triangles_;
+    std::vector<util::TriangleEdgeEquations> equations_;
+    geometry::Box2D bounds_ = {{HUGE_VAL, HUGE_VAL}, {-HUGE_VAL, -HUGE_VAL}};
+    double inverse_cell_size_ = 1.0;
+    size_t num_columns_ = 0;
+    size_t num_rows_ = 0;
+    // the first listed triangle of every cell, and one past the last
+    std::vector<size_t> offsets_;
+    std::vector<uint32_t> cell_triangles_;
+};
+
+}  // namespace euclid::algorithm::spatial_index
@@ -0,0 +1,364 @@
+#pragma once
+
+/**
+ * @file delaunay.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "algorithm/util/in_circle.h"
+#include "algorithm/util/orient_2d.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "geometry/triangle_2d.h"
+
+namespace euclid::algorithm::triangulation {
+
+/**
+ * @brief The Delaunay triangulation of a point set, built by incremental insertion after Bowyer and Watson.
+ *
+ * The triangles are stored as half-edges in flat arrays indexed by 32-bit integers: half-edges 3t, 3t + 1 and 3t + 2
+ * of triangle t run counter-clockwise, each knows its first vertex and the opposite half-edge of the neighbour. The
+ * hull edges are closed by ghost triangles with a vertex at infinity, so that inserting outside of the hull is no
+ * special case. A ghost triangle conflicts with a point left of its hull edge, a finite one with a point inside its
+ * circumcircle.
+ *
+ * The points are inserted in biased randomized insertion order (BRIO, Amenta, Choi and Rote): in rounds of doubling
+ * size, each sorted along a Hilbert curve. A point is located by walking from the triangle last created towards it,
+ * which the Hilbert order keeps short. Its conflicting triangles are replaced by the fan of triangles from the point
+ * to the boundary of their union.
+ *
+ * Orientations and incircle tests use the adaptive precision predicates util::Orient2D and util::InCircle, so the
+ * triangulation is exact for any input, also for cocircular points like those of a grid, which it triangulates in one
+ * of the valid ways. Coincident points are inserted once, the triangles refer to one of them. If all points are
+ * collinear, there are no triangles.
+ */
+class DelaunayTriangulation2D {
+public:
+    DelaunayTriangulation2D() = default;
+
+    /**
+     * @brief Triangulates a point set in O(n log n) expected time.
+     *
+     * @param points The points, fewer than 2^32 - 1.
+     */
+    explicit DelaunayTriangulation2D(std::span<const geometry::Point2D> points) {
+        const size_t size = points.size();
+        if (size < 3) {
+            return;
+        }
+        std::vector<uint32_t> order = GetInsertionOrder(points);
+        points_.resize(size);
+        input_indices_ = std::move(order);
+        for (size_t i = 0; i < size; ++i) {
+            points_[i] = points[input_indices_[i]];
+        }
+
+        // The first triangle is made of the first point, the next one apart from it and the next one off their line.
+        uint32_t second = 1;
+        while (second < size && util::AdaptivePredicates::AreCoincident(points_[second], points_[0])) {
+            second++;
+        }
+        uint32_t third = second + 1;
+        while (third < size && util::Orient2D(points_[0], points_[second], points_[third]) == 0.0) {
+            third++;
+        }
+        if (third >= size) {
+            return;
+        }
+        // 2n - 2 triangles with the ghost ones, as for n + 1 points on a sphere
+        triangles_.reserve(6 * size);
+        opposites_.reserve(6 * size);
+        stamps_.reserve(2 * size);
+        AddFirstTriangle(0, second, third);
+        for (uint32_t vertex = 1; vertex < size; ++vertex) {
+            if (vertex != second && vertex != third) {
+                Insert(vertex);
+            }
+        }
+    }
+
+    /**
+     * @brief The number of triangles, 2n - 2 - h for n distinct points, h of them on the hull.
+     */
+    size_t NumTriangles() const {
+        return triangles_.size() / 3 - num_ghosts_;
+    }
+
+    bool Empty() const { return NumTriangles() == 0; }
+
+    /**
+     * @brief The triangles as indices into the input points, each in counter-clockwise order.
+     */
+    std::vector<std::array<size_t, 3>> GetTriangleIndices() const {
+        std::vector<std::array<size_t, 3>> indices;
+        indices.reserve(NumTriangles());
+        for (size_t edge = 0; edge < triangles_.size(); edge += 3) {
+            if (triangles_[edge + 2] != kGhost) {
+                indices.push_back({input_indices_[triangles_[edge]], input_indices_[triangles_[edge + 1]],
+                                   input_indices_[triangles_[edge + 2]]});
+            }
+        }
+        return indices;
+    }
+
+    /**
+     * @brief The triangles, each with its vertices in counter-clockwise order.
+     */
+    std::vector<geometry::Triangle2D> GetTriangles() const {
+        std::vector<geometry::Triangle2D> triangles;
+        triangles.reserve(NumTriangles());
+        for (size_t edge = 0; edge < triangles_.size(); edge += 3) {
+            if (triangles_[edge + 2] != kGhost) {
+                triangles.push_back(
+                    {{points_[triangles_[edge]], points_[triangles_[edge + 1]], points_[triangles_[edge + 2]]}});
+            }
+        }
+        return triangles;
+    }
+
+private:
+    // the vertex at infinity of the ghost triangles, always the last one of a triangle
+    static constexpr uint32_t kGhost = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief A half-edge on the boundary of the conflicting triangles, with the half-edge opposite of it.
+     */
+    struct BoundaryEdge {
+        uint32_t from;
+        uint32_t to;
+        uint32_t opposite;
+    };
+
+    static uint32_t GetNext(uint32_t edge) { return edge % 3 == 2 ? edge - 2 : edge + 1; }
+
+    /**
+     * @brief The BRIO: every point joins round k, counted from the last one, with probability 2^-(k + 1), and the
+     * points are sorted by round, then by their Hilbert index in the bounding box of all points.
+     */
+    static std::vector<uint32_t> GetInsertionOrder(std::span<const geometry::Point2D> points) {
+        const size_t size = points.size();
+        util::SpatialGrid grid;
+        grid.Add(points);
+        // round, Hilbert index of a 2^13 x 2^13 grid and point index in one word, radix sorted by the first two
+        std::vector<uint64_t> keys(size);
+        util::GetSpatialKeys(points, grid, util::SpaceFillingCurve::kHilbert, 0, keys.data());
+
+        uint64_t random_state = 0;
+        auto Random = [&random_state]() {
+            uint64_t z = (random_state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        };
+        for (size_t i = 0; i < size; ++i) {
+            const uint64_t round = 63 - static_cast<uint64_t>(std::countr_zero(Random() | (1ull << 62)));
+            keys[i] = round << 58 | (keys[i] >> 38) << 32 | i;
+        }
+        std::vector<uint64_t> buffer(size);
+        util::SortByRadix(keys, buffer, 32);
+        std::vector<uint32_t> order(size);
+        for (size_t i = 0; i < size; ++i) {
+            order[i] = static_cast<uint32_t>(keys[i]);
+        }
+        return order;
+    }
+
+    /**
+     * @brief Creates the triangle a, b, c and the three ghost triangles around it.
+     */
+    void AddFirstTriangle(uint32_t a, uint32_t b, uint32_t c) {
+        if (util::Orient2D(points_[a], points_[b], points_[c]) < 0.0) {
+            std::swap(b, c);
+        }
+        triangles_ = {a, b, c, b, a, kGhost, c, b, kGhost, a, c, kGhost};
+        opposites_ = {3, 6, 9, 0, 11, 7, 1, 5, 10, 2, 8, 4};
+        num_ghosts_ = 3;
+        last_triangle_ = 0;
+    }
+
+    bool IsGhost(uint32_t triangle) const { return triangles_[3 * triangle + 2] == kGhost; }
+
+    /**
+     * @brief Whether a point lies strictly between two others it is collinear with.
+     */
+    static bool IsStrictlyBetween(const geometry::Point2D& point, const geometry::Point2D& p,
+                                  const geometry::Point2D& q) {
+        const size_t axis = p.coords[0] != q.coords[0] ? 0 : 1;
+        return std::min(p.coords[axis], q.coords[axis]) < point.coords[axis] &&
+               point.coords[axis] < std::max(p.coords[axis], q.coords[axis]);
+    }
+
+    bool IsInConflict(uint32_t triangle, const geometry::Point2D& point) const {
+        const uint32_t* vertices = triangles_.data() + 3 * triangle;
+        const auto& a = points_[vertices[0]];
+        const auto& b = points_[vertices[1]];
+        if (vertices[2] == kGhost) {
+            // the circumcircle degenerates to the open half-plane beyond the hull edge a -> b and the edge itself
+            double orientation = util::Orient2D(a, b, point);
+            return orientation > 0.0 || (orientation == 0.0 && IsStrictlyBetween(point, a, b));
+        }
+        return util::InCircle(a, b, points_[vertices[2]], point) > 0.0;
+    }
+
+    /**
+     * @brief Walks from the last created triangle to one conflicting with the point: the finite triangle containing it
+     * or the ghost triangle of a hull edge it lies beyond.
+     *
+     * @return The triangle, or kGhost if the point coincides with a vertex.
+     */
+    uint32_t Locate(const geometry::Point2D& point) const {
+        uint32_t triangle = last_triangle_;
+        if (IsGhost(triangle)) {
+            triangle = opposites_[3 * triangle] / 3;
+        }
+        // The edge the walk came through, the point is not beyond it. The edges are tried from a different one in
+        // every step, which keeps the walk from cycling among cocircular points.
+        uint32_t entry = kGhost;
+        for (uint32_t step = 0;; ++step) {
+            uint32_t next_triangle = kGhost;
+            for (uint32_t k = 0; k < 3; ++k) {
+                const uint32_t edge = 3 * triangle + (k + step) % 3;
+                if (edge != entry &&
+                    util::Orient2D(points_[triangles_[edge]], points_[triangles_[GetNext(edge)]], point) < 0.0) {
+                    entry = opposites_[edge];
+                    next_triangle = entry / 3;
+                    break;
+                }
+            }
+            if (next_triangle == kGhost) {
+                for (uint32_t edge = 3 * triangle; edge < 3 * triangle + 3; ++edge) {
+                    if (util::AdaptivePredicates::AreCoincident(points_[triangles_[edge]], point)) {
+                        return kGhost;
+                    }
+                }
+                return triangle;
+            }
+            if (IsGhost(next_triangle)) {
+                return next_triangle;
+            }
+            triangle = next_triangle;
+        }
+    }
+
+    void Insert(uint32_t vertex) {
+        const geometry::Point2D& point = points_[vertex];
+        const uint32_t first = Locate(point);
+        if (first == kGhost) {
+            return;
+        }
+
+        // Collects the conflicting triangles by a search from the located one, they form a star around the point. The
+        // stamps remember the triangles tested in this insertion: 2 * vertex + 2 in conflict, 2 * vertex + 3 not.
+        const uint64_t conflict_stamp = 2 * static_cast<uint64_t>(vertex) + 2;
+        stamps_.resize(triangles_.size() / 3, 0);
+        cavity_.clear();
+        cavity_.push_back(first);
+        stamps_[first] = conflict_stamp;
+        for (size_t i = 0; i < cavity_.size(); ++i) {
+            const uint32_t triangle = cavity_[i];
+            for (uint32_t edge = 3 * triangle; edge < 3 * triangle + 3; ++edge) {
+                const uint32_t neighbour = opposites_[edge] / 3;
+                if (stamps_[neighbour] >= conflict_stamp) {
+                    continue;
+                }
+                if (IsInConflict(neighbour, point)) {
+                    stamps_[neighbour] = conflict_stamp;
+                    cavity_.push_back(neighbour);
+                } else {
+                    stamps_[neighbour] = conflict_stamp + 1;
+                }
+            }
+        }
+        auto IsInCavity = [&](uint32_t edge) { return stamps_[edge / 3] == conflict_stamp; };
+
+        // Walks the boundary of the cavity counter-clockwise, turning around the end of each boundary edge through the
+        // cavity to the next one.
+        uint32_t start = kGhost;
+        for (size_t i = 0; i < cavity_.size() && start == kGhost; ++i) {
+            for (uint32_t edge = 3 * cavity_[i]; edge < 3 * cavity_[i] + 3; ++edge) {
+                if (!IsInCavity(opposites_[edge])) {
+                    start = edge;
+                    break;
+                }
+            }
+        }
+        boundary_.clear();
+        uint32_t edge = start;
+        do {
+            boundary_.push_back({triangles_[edge], triangles_[GetNext(edge)], opposites_[edge]});
+            edge = GetNext(edge);
+            while (IsInCavity(opposites_[edge])) {
+                edge = GetNext(opposites_[edge]);
+            }
+        } while (edge != start);
+
+        // The fan from the point has two triangles more than the cavity, the slots of the cavity are reused.
+        for (uint32_t triangle : cavity_) {
+            num_ghosts_ -= IsGhost(triangle) ? 1 : 0;
+        }
+        const size_t num_old_triangles = triangles_.size() / 3;
+        const size_t num_new_triangles = boundary_.size() - cavity_.size();
+        triangles_.resize(triangles_.size() + 3 * num_new_triangles);
+        opposites_.resize(opposites_.size() + 3 * num_new_triangles);
+        for (size_t i = 0; i < num_new_triangles; ++i) {
+            cavity_.push_back(static_cast<uint32_t>(num_old_triangles + i));
+        }
+        // The half-edge from the point to the start of the previous boundary edge, waiting for its opposite.
+        uint32_t previous_edge = kGhost;
+        uint32_t first_edge = kGhost;
+        for (size_t i = 0; i < boundary_.size(); ++i) {
+            const auto& [from, to, opposite] = boundary_[i];
+            const uint32_t triangle = cavity_[i];
+            // the triangle from, to, point, rotated to keep a ghost vertex last
+            const uint32_t rotation = from == kGhost ? 1 : (to == kGhost ? 2 : 0);
+            const uint32_t vertices[3] = {from, to, vertex};
+            uint32_t* triangle_vertices = triangles_.data() + 3 * triangle;
+            for (uint32_t k = 0; k < 3; ++k) {
+                triangle_vertices[k] = vertices[(k + rotation) % 3];
+            }
+            num_ghosts_ += rotation != 0 ? 1 : 0;
+            auto GetEdge = [&](uint32_t k) { return 3 * triangle + (k + 3 - rotation) % 3; };
+            opposites_[GetEdge(0)] = opposite;
+            opposites_[opposite] = GetEdge(0);
+            // to -> point meets point -> to of the next triangle
+            if (previous_edge != kGhost) {
+                opposites_[GetEdge(2)] = previous_edge;
+                opposites_[previous_edge] = GetEdge(2);
+            } else {
+                first_edge = GetEdge(2);
+            }
+            previous_edge = GetEdge(1);
+        }
+        opposites_[first_edge] = previous_edge;
+        opposites_[previous_edge] = first_edge;
+        last_triangle_ = cavity_.back();
+    }
+
+    // the points in insertion order and their indices in the input
+    std::vector<geometry::Point2D> points_;
+    std::vector<uint32_t> input_indices_;
+    // the first vertex of every half-edge and the opposite half-edge
+    std::vector<uint32_t> triangles_;
+    std::vector<uint32_t> opposites_;
+    size_t num_ghosts_ = 0;
+    uint32_t last_triangle_ = 0;
+    // the buffers of Insert, kept to save allocations
+    std::vector<uint64_t> stamps_;
+    std::vector<uint32_t> cavity_;
+    std::vector<BoundaryEdge> boundary_;
+};
+
+}  // namespace euclid::algorithm::triangulation
@@ -0,0 +1,364 @@
+#pragma once
+
+/**
+ * @file batch_location.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "algorithm/util/location.h"
+#include "geometry/point_2d.h"
+#include "geometry/point_set_2d.h"
+#include "geometry/triangle_2d.h"
+#include "util/compare.h"
+#include "util/simd.h"
+
+namespace euclid::algorithm::util {
+
+/**
+ * @brief Gets the number of 64-bit words of a bitmask with one bit per point.
+ *
+ * @param num_points The number of points.
+ * @return The number of words, bit i of the mask is bit i % 64 of word i / 64.
+ */
+inline size_t GetNumMaskWords(size_t num_points) { return (num_points + 63) / 64; }
+
+/**
+ * @brief Evaluates the cross product of IsTurnLeft for a fixed p, q and the points [begin, end) without vectorization.
+ *
+ * The kernels evaluate the cross product with the same operations in the same order as IsTurnLeft, so every batch
+ * predicate agrees bit for bit with its scalar counterpart. begin must be a multiple of 64, the words covering
+ * [begin, end) are overwritten and bits past end are cleared.
+ *
+ * @param left_mask If not null, receives the bits of the points left of p -> q.
+ * @param collinear_mask If not null, receives the bits of the points collinear with p and q.
+ */
+inline void ComputeTurnMasksScalar(const geometry::Point2D& p, const geometry::Point2D& q, const double* xs,
+                                   const double* ys, size_t begin, size_t end, uint64_t* left_mask,
+                                   uint64_t* collinear_mask) {
+    const double constant = p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0];
+    for (size_t word_begin = begin; word_begin < end; word_begin += 64) {
+        uint64_t left_word = 0;
+        uint64_t collinear_word = 0;
+        size_t word_end = word_begin + 64 < end ? word_begin + 64 : end;
+        for (size_t i = word_begin; i < word_end; ++i) {
+            double cross_value = constant + q.coords[0] * ys[i] - q.coords[1] * xs[i] + xs[i] * p.coords[1] -
+                                 ys[i] * p.coords[0];
+            left_word |= static_cast<uint64_t>(euclid::util::Greater(cross_value, 0.0)) << (i - word_begin);
+            collinear_word |= static_cast<uint64_t>(euclid::util::Equal(cross_value, 0.0)) << (i - word_begin);
+        }
+        if (left_mask != nullptr) {
+            left_mask[word_begin / 64] = left_word;
+        }
+        if (collinear_mask != nullptr) {
+            collinear_mask[word_begin / 64] = collinear_word;
+        }
+    }
+}
+
+/**
+ * @brief Evaluates the dot product test of IsPointOnSegment for a fixed segment pq and the points [begin, end) without
+ * vectorization, see ComputeTurnMasksScalar for the mask layout.
+ *
+ * @param between_mask Receives the bits of the points whose projection onto the line pq falls on the segment pq.
+ */
+inline void ComputeBetweenMaskScalar(const geometry::Point2D& p, const geometry::Point2D& q, const double* xs,
+                                     const double* ys, size_t begin, size_t end, uint64_t* between_mask) {
+    const double dx = q.coords[0] - p.coords[0];
+    const double dy = q.coords[1] - p.coords[1];
+    const double pq_pq_dot_value = dx * dx + dy * dy;
+    for (size_t word_begin = begin; word_begin < end; word_begin += 64) {
+        uint64_t between_word = 0;
+        size_t word_end = word_begin + 64 < end ? word_begin + 64 : end;
+        for (size_t i = word_begin; i < word_end; ++i) {
+            double pq_pr_dot_value = dx * (xs[i] - p.coords[0]) + dy * (ys[i] - p.coords[1]);
+            bool is_between = euclid::util::GreaterEqual(pq_pr_dot_value, 0.0) &&
+                              euclid::util::LessEqual(pq_pr_dot_value, pq_pq_dot_value);
+            between_word |= static_cast<uint64_t>(is_between) << (i - word_begin);
+        }
+        between_mask[word_begin / 64] = between_word;
+    }
+}
+
+#if defined(EUCLID_X86_64)
+
+/**
+ * @brief AVX2 version of ComputeTurnMasksScalar for the points [0, size).
+ */
+EUCLID_TARGET_AVX2 inline void ComputeTurnMasksAvx2(const geometry::Point2D& p, const geometry::Point2D& q,
+                                                    const double* xs, const double* ys, size_t size,
+                                                    uint64_t* left_mask, uint64_t* collinear_mask) {
+    const __m256d constant = _mm256_set1_pd(p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0]);
+    const __m256d px = _mm256_set1_pd(p.coords[0]);
+    const __m256d py = _mm256_set1_pd(p.coords[1]);
+    const __m256d qx = _mm256_set1_pd(q.coords[0]);
+    const __m256d qy = _mm256_set1_pd(q.coords[1]);
+    const __m256d eps = _mm256_set1_pd(0.0 + euclid::util::kDefaultTolerance);
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    const size_t num_full_words = size / 64;
+    for (size_t word = 0; word < num_full_words; ++word) {
+        uint64_t left_word = 0;
+        uint64_t collinear_word = 0;
+        for (size_t j = 0; j < 64; j += 4) {
+            __m256d rx = _mm256_loadu_pd(xs + word * 64 + j);
+            __m256d ry = _mm256_loadu_pd(ys + word * 64 + j);
+            __m256d cross_value = _mm256_add_pd(constant, _mm256_mul_pd(qx, ry));
+            cross_value = _mm256_sub_pd(cross_value, _mm256_mul_pd(qy, rx));
+            cross_value = _mm256_add_pd(cross_value, _mm256_mul_pd(rx, py));
+            cross_value = _mm256_sub_pd(cross_value, _mm256_mul_pd(ry, px));
+            __m256d is_left = _mm256_cmp_pd(cross_value, eps, _CMP_GT_OQ);
+            __m256d is_collinear = _mm256_cmp_pd(_mm256_andnot_pd(sign_bit, cross_value), eps, _CMP_LT_OQ);
+            left_word |= static_cast<uint64_t>(_mm256_movemask_pd(is_left)) << j;
+            collinear_word |= static_cast<uint64_t>(_mm256_movemask_pd(is_collinear)) << j;
+        }
+        if (left_mask != nullptr) {
+            left_mask[word] = left_word;
+        }
+        if (collinear_mask != nullptr) {
+            collinear_mask[word] = collinear_word;
+        }
+    }
+    ComputeTurnMasksScalar(p, q, xs, ys, num_full_words * 64, size, left_mask, collinear_mask);
+}
+
+/**
+ * @brief AVX-512 version of ComputeTurnMasksScalar for the points [0, size).
+ */
+EUCLID_TARGET_AVX512 EUCLID_NO_FP_CONTRACT inline void ComputeTurnMasksAvx512(const geometry::Point2D& p,
+                                                                              const geometry::Point2D& q,
+                                                                              const double* xs, const double* ys,
+                                                                              size_t size, uint64_t* left_mask,
+                                                                              uint64_t* collinear_mask) {
+    const __m512d constant = _mm512_set1_pd(p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0]);
+    const __m512d px = _mm512_set1_pd(p.coords[0]);
+    const __m512d py = _mm512_set1_pd(p.coords[1]);
+    const __m512d qx = _mm512_set1_pd(q.coords[0]);
+    const __m512d qy = _mm512_set1_pd(q.coords[1]);
+    const __m512d eps = _mm512_set1_pd(0.0 + euclid::util::kDefaultTolerance);
+    const size_t num_full_words = size / 64;
+    for (size_t word = 0; word < num_full_words; ++word) {
+        uint64_t left_word = 0;
+        uint64_t collinear_word = 0;
+        for (size_t j = 0; j < 64; j += 8) {
+            __m512d rx = _mm512_loadu_pd(xs + word * 64 + j);
+            __m512d ry = _mm512_loadu_pd(ys + word * 64 + j);
+            __m512d cross_value = _mm512_add_pd(constant, _mm512_mul_pd(qx, ry));
+            cross_value = _mm512_sub_pd(cross_value, _mm512_mul_pd(qy, rx));
+            cross_value = _mm512_add_pd(cross_value, _mm512_mul_pd(rx, py));
+            cross_value = _mm512_sub_pd(cross_value, _mm512_mul_pd(ry, px));
+            left_word |= static_cast<uint64_t>(_mm512_cmp_pd_mask(cross_value, eps, _CMP_GT_OQ)) << j;
+            collinear_word |= static_cast<uint64_t>(_mm512_cmp_pd_mask(_mm512_abs_pd(cross_value), eps, _CMP_LT_OQ))
+                              << j;
+        }
+        if (left_mask != nullptr) {
+            left_mask[word] = left_word;
+        }
+        if (collinear_mask != nullptr) {
+            collinear_mask[word] = collinear_word;
+        }
+    }
+    ComputeTurnMasksScalar(p, q, xs, ys, num_full_words * 64, size, left_mask, collinear_mask);
+}
+
+/**
+ * @brief AVX2 version of ComputeBetweenMaskScalar for the points [0, size).
+ */
+EUCLID_TARGET_AVX2 inline void ComputeBetweenMaskAvx2(const geometry::Point2D& p, const geometry::Point2D& q,
+                                                      const double* xs, const double* ys, size_t size,
+                                                      uint64_t* between_mask) {
+    const double dx_value = q.coords[0] - p.coords[0];
+    const double dy_value = q.coords[1] - p.coords[1];
+    const __m256d px = _mm256_set1_pd(p.coords[0]);
+    const __m256d py = _mm256_set1_pd(p.coords[1]);
+    const __m256d dx = _mm256_set1_pd(dx_value);
+    const __m256d dy = _mm256_set1_pd(dy_value);
+    const __m256d pq_pq_dot_value = _mm256_set1_pd(dx_value * dx_value + dy_value * dy_value);
+    const __m256d eps = _mm256_set1_pd(euclid::util::kDefaultTolerance);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    const size_t num_full_words = size / 64;
+    for (size_t word = 0; word < num_full_words; ++word) {
+        uint64_t between_word = 0;
+        for (size_t j = 0; j < 64; j += 4) {
+            __m256d rx = _mm256_loadu_pd(xs + word * 64 + j);
+            __m256d ry = _mm256_loadu_pd(ys + word * 64 + j);
+            __m256d dot_value = _mm256_add_pd(_mm256_mul_pd(dx, _mm256_sub_pd(rx, px)),
+                                              _mm256_mul_pd(dy, _mm256_sub_pd(ry, py)));
+            // GreaterEqual(dot, 0): dot > 0 + eps || |dot - 0| < eps
+            __m256d lower = _mm256_or_pd(
+                _mm256_cmp_pd(dot_value, _mm256_add_pd(zero, eps), _CMP_GT_OQ),
+                _mm256_cmp_pd(_mm256_andnot_pd(sign_bit, _mm256_sub_pd(dot_value, zero)), eps, _CMP_LT_OQ));
+            // LessEqual(dot, pq_pq): dot < pq_pq - eps || |dot - pq_pq| < eps
+            __m256d upper = _mm256_or_pd(
+                _mm256_cmp_pd(dot_value, _mm256_sub_pd(pq_pq_dot_value, eps), _CMP_LT_OQ),
+                _mm256_cmp_pd(_mm256_andnot_pd(sign_bit, _mm256_sub_pd(dot_value, pq_pq_dot_value)), eps,
+                              _CMP_LT_OQ));
+            between_word |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_and_pd(lower, upper))) << j;
+        }
+        between_mask[word] = between_word;
+    }
+    ComputeBetweenMaskScalar(p, q, xs, ys, num_full_words * 64, size, between_mask);
+}
+
+#endif
+
+/**
+ * @brief Evaluates the cross product of IsTurnLeft for a fixed p, q and the points [0, size), dispatching to the
+ * AVX-512, AVX2 or scalar kernel according to euclid::util::GetSimdLevel.
+ */
+inline void ComputeTurnMasks(const geometry::Point2D& p, const geometry::Point2D& q, const double* xs, const double* ys,
+                             size_t size, uint64_t* left_mask, uint64_t* collinear_mask) {
+#if defined(EUCLID_X86_64)
+    switch (euclid::util::GetSimdLevel()) {
+        case euclid::util::SimdLevel::kAvx512:
+            return ComputeTurnMasksAvx512(p, q, xs, ys, size, left_mask, collinear_mask);
+        case euclid::util::SimdLevel::kAvx2:
+            return ComputeTurnMasksAvx2(p, q, xs, ys, size, left_mask, collinear_mask);
+        default:
+            break;
+    }
+#endif
+    ComputeTurnMasksScalar(p, q, xs, ys, 0, size, left_mask, collinear_mask);
+}
+
+/**
+ * @brief Evaluates the dot product test of IsPointOnSegment for a fixed segment pq and the points [0, size),
+ * dispatching to the AVX2 or scalar kernel according to euclid::util::GetSimdLevel.
+ */
+inline void ComputeBetweenMask(const geometry::Point2D& p, const geometry::Point2D& q, const double* xs,
+                               const double* ys, size_t size, uint64_t* between_mask) {
+#if defined(EUCLID_X86_64)
+    if (euclid::util::GetSimdLevel() >= euclid::util::SimdLevel::kAvx2) {
+        return ComputeBetweenMaskAvx2(p, q, xs, ys, size, between_mask);
+    }
+#endif
+    ComputeBetweenMaskScalar(p, q, xs, ys, 0, size, between_mask);
+}
+
+/**
+ * @brief Batch form of IsTurnLeft for a fixed p, q.
+ *
+ * @param p The first point.
+ * @param q The second point.
+ * @param points The third points.
+ * @param mask Receives GetNumMaskWords(points.Size()) words, bit i is set if p, q, points[i] makes a left turn.
+ */
+inline void IsTurnLeft(const geometry::Point2D& p, const geometry::Point2D& q, const geometry::PointSet2D& points,
+                       uint64_t* mask) {
+    ComputeTurnMasks(p, q, points.X(), points.Y(), points.Size(), mask, nullptr);
+}
+
+/**
+ * @brief Batch form of ArePointsCollinear for a fixed p, q.
+ *
+ * @param p The first point.
+ * @param q The second point.
+ * @param points The third points.
+ * @param mask Receives GetNumMaskWords(points.Size()) words, bit i is set if p, q, points[i] are collinear.
+ */
+inline void ArePointsCollinear(const geometry::Point2D& p, const geometry::Point2D& q,
+                               const geometry::PointSet2D& points, uint64_t* mask) {
+    ComputeTurnMasks(p, q, points.X(), points.Y(), points.Size(), nullptr, mask);
+}
+
+/**
+ * @brief Classifies the turn p, q, points[i] for a fixed p, q and every point of a set.
+ *
+ * @param p The first point.
+ * @param q The second point.
+ * @param points The third points.
+ * @param orientations Receives points.Size() values: 1 for a left turn, 0 if collinear and -1 for a right turn.
+ */
+inline void GetOrientations(const geometry::Point2D& p, const geometry::Point2D& q, const geometry::PointSet2D& points,
+                            int8_t* orientations) {
+    // Masks for up to 64 * 64 points at a time keep the scratch space on the stack.
+    constexpr size_t kBlockWords = 64;
+    uint64_t left_mask[kBlockWords];
+    uint64_t collinear_mask[kBlockWords];
+    const size_t num_words = GetNumMaskWords(points.Size());
+    for (size_t block = 0; block < num_words; block += kBlockWords) {
+        size_t begin = block * 64;
+        size_t end = begin + kBlockWords * 64 < points.Size() ? begin + kBlockWords * 64 : points.Size();
+        ComputeTurnMasks(p, q, points.X() + begin, points.Y() + begin, end - begin, left_mask, collinear_mask);
+        for (size_t i = begin; i < end; ++i) {
+            size_t bit = i - begin;
+            auto is_left = static_cast<int8_t>((left_mask[bit / 64] >> (bit % 64)) & 1);
+            auto is_collinear = static_cast<int8_t>((collinear_mask[bit / 64] >> (bit % 64)) & 1);
+            orientations[i] = static_cast<int8_t>(2 * is_left + is_collinear - 1);
+        }
+    }
+}
+
+/**
+ * @brief Batch form of IsPointOnSegment for a fixed segment pq.
+ *
+ * @param points The points to check.
+ * @param p The first endpoint of the segment.
+ * @param q The second endpoint of the segment.
+ * @param mask Receives GetNumMaskWords(points.Size()) words, bit i is set if points[i] is on the segment.
+ */
+inline void IsPointOnSegment(const geometry::PointSet2D& points, const geometry::Point2D& p, const geometry::Point2D& q,
+                             uint64_t* mask) {
+    ComputeTurnMasks(p, q, points.X(), points.Y(), points.Size(), nullptr, mask);
+    constexpr size_t kBlockWords = 64;
+    uint64_t between_mask[kBlockWords];
+    const size_t num_words = GetNumMaskWords(points.Size());
+    for (size_t block = 0; block < num_words; block += kBlockWords) {
+        size_t begin = block * 64;
+        size_t end = begin + kBlockWords * 64 < points.Size() ? begin + kBlockWords * 64 : points.Size();
+        ComputeBetweenMask(p, q, points.X() + begin, points.Y() + begin, end - begin, between_mask);
+        for (size_t word = block; word < num_words && word < block + kBlockWords; ++word) {
+            mask[word] &= between_mask[word - block];
+        }
+    }
+}
+
+/**
+ * @brief Batch form of IsPointInTriangle for a fixed triangle.
+ *
+ * @param points The points to check.
+ * @param p The first point of the triangle.
+ * @param q The second point of the triangle.
+ * @param r The third point of the triangle.
+ * @param mask Receives GetNumMaskWords(points.Size()) words, bit i is set if points[i] is inside the triangle.
+ */
+inline void IsPointInTriangle(const geometry::PointSet2D& points, const geometry::Point2D& p,
+                              const geometry::Point2D& q, const geometry::Point2D& r, uint64_t* mask) {
+    ComputeTurnMasks(p, q, points.X(), points.Y(), points.Size(), mask, nullptr);
+    constexpr size_t kBlockWords = 64;
+    uint64_t left_mask_2[kBlockWords];
+    uint64_t left_mask_3[kBlockWords];
+    const size_t num_words = GetNumMaskWords(points.Size());
+    for (size_t block = 0; block < num_words; block += kBlockWords) {
+        size_t begin = block * 64;
+        size_t end = begin + kBlockWords * 64 < points.Size() ? begin + kBlockWords * 64 : points.Size();
+        ComputeTurnMasks(q, r, points.X() + begin, points.Y() + begin, end - begin, left_mask_2, nullptr);
+        ComputeTurnMasks(r, p, points.X() + begin, points.Y() + begin, end - begin, left_mask_3, nullptr);
+        for (size_t word = block; word < num_words && word < block + kBlockWords; ++word) {
+            uint64_t left_1 = mask[word];
+            uint64_t left_2 = left_mask_2[word - block];
+            uint64_t left_3 = left_mask_3[word - block];
+            mask[word] = ~(left_1 ^ left_2) & ~(left_2 ^ left_3);
+        }
+    }
+    if (points.Size() % 64 != 0) {
+        mask[num_words - 1] &= (uint64_t{1} << (points.Size() % 64)) - 1;
+    }
+}
+
+/**
+ * @brief Batch form of IsPointInTriangle for a fixed triangle.
+ *
+ * @param points The points to check.
+ * @param triangle The triangle to check against.
+ * @param mask Receives GetNumMaskWords(points.Size()) words, bit i is set if points[i] is inside the triangle.
+ */
+inline void IsPointInTriangle(const geometry::PointSet2D& points, const geometry::Triangle2D& triangle,
+                              uint64_t* mask) {
+    IsPointInTriangle(points, triangle.vertices[0], triangle.vertices[1], triangle.vertices[2], mask);
+}
+
+}  // namespace euclid::algorithm::util
@@ -0,0 +1,312 @@
+#pragma once
+
+/**
+ * @file edge_equations.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "algorithm/util/batch_location.h"
+#include "algorithm/util/orient_2d.h"
+#include "algorithm/util/predicates.h"
+#include "geometry/box_2d.h"
+#include "geometry/point_2d.h"
+#include "geometry/point_set_2d.h"
+#include "geometry/triangle_2d.h"
+#include "util/simd.h"
+
+namespace euclid::algorithm::util {
+
+/**
+ * @brief A triangle prepared for many containment tests: its bounding box and the lines of its edges, the point (x, y)
+ * being a[i] * x + b[i] * y + c[i] left of edge i of the counter-clockwise triangle, its distance from the line times
+ * the length of the edge.
+ *
+ * Evaluating a line takes two multiplications and two additions and its coefficients are the same for all points, so
+ * the tests vectorize over the points with the coefficients broadcast. The evaluation is off the exact cross product
+ * by at most error_bounds[i] for points in the box, so a point farther than that from all lines is decided by the
+ * lines alone and only the points nearer need the exact predicate.
+ */
+struct TriangleEdgeEquations {
+    geometry::Box2D box;
+    double a[3];
+    double b[3];
+    double c[3];
+    double error_bounds[3];
+};
+
+/**
+ * @brief Prepares a triangle for GetTriangleLocation and IsPointInClosedTriangle.
+ *
+ * @param triangle The triangle, in either orientation. A degenerate triangle gets an empty box and contains no point.
+ * @return The equations of the edges of the triangle.
+ */
+inline TriangleEdgeEquations GetTriangleEdgeEquations(const geometry::Triangle2D& triangle) {
+    TriangleEdgeEquations equations{{{HUGE_VAL, HUGE_VAL}, {-HUGE_VAL, -HUGE_VAL}}, {}, {}, {}, {}};
+    geometry::Point2D vertices[3] = {triangle.vertices[0], triangle.vertices[1], triangle.vertices[2]};
+    const int orientation = AdaptivePredicates::GetOrientation(vertices[0], vertices[1], vertices[2]);
+    if (orientation == 0) {
+        return equations;
+    }
+    if (orientation < 0) {
+        std::swap(vertices[1], vertices[2]);
+    }
+    auto& box = equations.box;
+    for (const auto& vertex : vertices) {
+        for (size_t axis = 0; axis < 2; ++axis) {
+            box.min_corner.coords[axis] = std::min(box.min_corner.coords[axis], vertex.coords[axis]);
+            box.max_corner.coords[axis] = std::max(box.max_corner.coords[axis], vertex.coords[axis]);
+        }
+    }
+    const double max_x = std::max(std::fabs(box.min_corner.coords[0]), std::fabs(box.max_corner.coords[0]));
+    const double max_y = std::max(std::fabs(box.min_corner.coords[1]), std::fabs(box.max_corner.coords[1]));
+    for (size_t i = 0; i < 3; ++i) {
+        const auto& p = vertices[i];
+        const auto& q = vertices[(i + 1) % 3];
+        equations.a[i] = p.coords[1] - q.coords[1];
+        equations.b[i] = q.coords[0] - p.coords[0];
+        equations.c[i] = p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0];
+        // About 4 eps (|a x| + |b y|) + 3 eps (|px qy| + |py qx|) from rounding the coefficients and the evaluation
+        // with or without fused multiply-adds, doubled, and the smallest normal double for underflow.
+        const double magnitude = std::fabs(equations.a[i]) * max_x + std::fabs(equations.b[i]) * max_y +
+                                 std::fabs(p.coords[0] * q.coords[1]) + std::fabs(p.coords[1] * q.coords[0]);
+        equations.error_bounds[i] = 8.0 * expansion::kEpsilon * magnitude + std::numeric_limits<double>::min();
+    }
+    return equations;
+}
+
+/**
+ * @brief Locates a point against a prepared triangle by the lines of its edges alone.
+ *
+ * @return 1 if the point is inside the triangle, -1 if it is outside and 0 if it is too near an edge to tell, for
+ * IsPointInClosedTriangle to decide exactly.
+ */
+inline int GetTriangleLocation(const TriangleEdgeEquations& equations, const geometry::Point2D& point) {
+    const double x = point.coords[0];
+    const double y = point.coords[1];
+    if (!(x >= equations.box.min_corner.coords[0] && x <= equations.box.max_corner.coords[0] &&
+          y >= equations.box.min_corner.coords[1] && y <= equations.box.max_corner.coords[1])) {
+        return -1;
+    }
+    int location = 1;
+    for (size_t i = 0; i < 3; ++i) {
+        const double value = equations.a[i] * x + equations.b[i] * y + equations.c[i];
+        if (value < -equations.error_bounds[i]) {
+            return -1;
+        }
+        if (!(value > equations.error_bounds[i])) {
+            location = 0;
+        }
+    }
+    return location;
+}
+
+/**
+ * @brief Checks exactly whether a point is inside a triangle or on its boundary.
+ *
+ * @param point The point to check.
+ * @param triangle The triangle, in either orientation. A degenerate triangle contains no point.
+ * @return True if the point is in the closed triangle.
+ */
+inline bool IsPointInClosedTriangle(const geometry::Point2D& point, const geometry::Triangle2D& triangle) {
+    const auto& p = triangle.vertices[0];
+    const auto& q = triangle.vertices[1];
+    const auto& r = triangle.vertices[2];
+    const int orientation = AdaptivePredicates::GetOrientation(p, q, r);
+    return orientation != 0 && AdaptivePredicates::GetOrientation(p, q, point) * orientation >= 0 &&
+           AdaptivePredicates::GetOrientation(q, r, point) * orientation >= 0 &&
+           AdaptivePredicates::GetOrientation(r, p, point) * orientation >= 0;
+}
+
+/**
+ * @brief Checks a point against a triangle and its prepared form, exactly and mostly by the lines of the edges.
+ */
+inline bool IsPointInClosedTriangle(const geometry::Point2D& point, const geometry::Triangle2D& triangle,
+                                    const TriangleEdgeEquations& equations) {
+    const int location = GetTriangleLocation(equations, point);
+    return location > 0 || (location == 0 && IsPointInClosedTriangle(point, triangle));
+}
+
+/**
+ * @brief GetTriangleLocation for the points [begin, end) without vectorization.
+ *
+ * begin must be a multiple of 64, the words covering [begin, end) are overwritten and bits past end are cleared.
+ *
+ * @param inside_mask Receives the bits of the points inside the triangle.
+ * @param undecided_mask Receives the bits of the points too near an edge to tell.
+ */
+inline void ComputeTriangleMasksScalar(const TriangleEdgeEquations& equations, const double* xs, const double* ys,
+                                       size_t begin, size_t end, uint64_t* inside_mask, uint64_t* undecided_mask) {
+    for (size_t word_begin = begin; word_begin < end; word_begin += 64) {
+        const size_t word_end = word_begin + 64 < end ? word_begin + 64 : end;
+        uint64_t inside_word = 0;
+        uint64_t undecided_word = 0;
+        for (size_t i = word_begin; i < word_end; ++i) {
+            const int location = GetTriangleLocation(equations, {xs[i], ys[i]});
+            inside_word |= static_cast<uint64_t>(location > 0) << (i - word_begin);
+            undecided_word |= static_cast<uint64_t>(location == 0) << (i - word_begin);
+        }
+        inside_mask[word_begin / 64] = inside_word;
+        undecided_mask[word_begin / 64] = undecided_word;
+    }
+}
+
+#if defined(EUCLID_X86_64)
+
+/**
+ * @brief AVX2 version of ComputeTriangleMasksScalar for the points [0, size), four points per instruction.
+ */
+EUCLID_TARGET_AVX2 inline void ComputeTriangleMasksAvx2(const TriangleEdgeEquations& equations, const double* xs,
+                                                        const double* ys, size_t size, uint64_t* inside_mask,
+                                                        uint64_t* undecided_mask) {
+    const __m256d min_x = _mm256_set1_pd(equations.box.min_corner.coords[0]);
+    const __m256d min_y = _mm256_set1_pd(equations.box.min_corner.coords[1]);
+    const __m256d max_x = _mm256_set1_pd(equations.box.max_corner.coords[0]);
+    const __m256d max_y = _mm256_set1_pd(equations.box.max_corner.coords[1]);
+    __m256d a[3];
+    __m256d b[3];
+    __m256d c[3];
+    __m256d bounds[3];
+    __m256d negative_bounds[3];
+    for (size_t i = 0; i < 3; ++i) {
+        a[i] = _mm256_set1_pd(equations.a[i]);
+        b[i] = _mm256_set1_pd(equations.b[i]);
+        c[i] = _mm256_set1_pd(equations.c[i]);
+        bounds[i] = _mm256_set1_pd(equations.error_bounds[i]);
+        negative_bounds[i] = _mm256_set1_pd(-equations.error_bounds[i]);
+    }
+    const size_t num_full_words = size / 64;
+    for (size_t word = 0; word < num_full_words; ++word) {
+        uint64_t inside_word = 0;
+        uint64_t undecided_word = 0;
+        for (size_t j = 0; j < 64; j += 4) {
+            const __m256d x = _mm256_loadu_pd(xs + word * 64 + j);
+            const __m256d y = _mm256_loadu_pd(ys + word * 64 + j);
+            __m256d in_box = _mm256_and_pd(_mm256_cmp_pd(x, min_x, _CMP_GE_OQ), _mm256_cmp_pd(x, max_x, _CMP_LE_OQ));
+            in_box = _mm256_and_pd(in_box, _mm256_cmp_pd(y, min_y, _CMP_GE_OQ));
+            in_box = _mm256_and_pd(in_box, _mm256_cmp_pd(y, max_y, _CMP_LE_OQ));
+            __m256d inside = in_box;
+            __m256d not_outside = in_box;
+            for (size_t i = 0; i < 3; ++i) {
+                __m256d value = _mm256_add_pd(_mm256_mul_pd(a[i], x), _mm256_mul_pd(b[i], y));
+                value = _mm256_add_pd(value, c[i]);
+                inside = _mm256_and_pd(inside, _mm256_cmp_pd(value, bounds[i], _CMP_GT_OQ));
+                not_outside = _mm256_and_pd(not_outside, _mm256_cmp_pd(value, negative_bounds[i], _CMP_NLT_UQ));
+            }
+            inside_word |= static_cast<uint64_t>(_mm256_movemask_pd(inside)) << j;
+            undecided_word |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_andnot_pd(inside, not_outside))) << j;
+        }
+        inside_mask[word] = inside_word;
+        undecided_mask[word] = undecided_word;
+    }
+    ComputeTriangleMasksScalar(equations, xs, ys, num_full_words * 64, size, inside_mask, undecided_mask);
+}
+
+/**
+ * @brief AVX-512 version of ComputeTriangleMasksScalar for the points [0, size), eight points per instruction.
+ */
+EUCLID_TARGET_AVX512 inline void ComputeTriangleMasksAvx512(const TriangleEdgeEquations& equations, const double* xs,
+                                                            const double* ys, size_t size, uint64_t* inside_mask,
+                                                            uint64_t* undecided_mask) {
+    const __m512d min_x = _mm512_set1_pd(equations.box.min_corner.coords[0]);
+    const __m512d min_y = _mm512_set1_pd(equations.box.min_corner.coords[1]);
+    const __m512d max_x = _mm512_set1_pd(equations.box.max_corner.coords[0]);
+    const __m512d max_y = _mm512_set1_pd(equations.box.max_corner.coords[1]);
+    __m512d a[3];
+    __m512d b[3];
+    __m512d c[3];
+    __m512d bounds[3];
+    __m512d negative_bounds[3];
+    for (size_t i = 0; i < 3; ++i) {
+        a[i] = _mm512_set1_pd(equations.a[i]);
+        b[i] = _mm512_set1_pd(equations.b[i]);
+        c[i] = _mm512_set1_pd(equations.c[i]);
+        bounds[i] = _mm512_set1_pd(equations.error_bounds[i]);
+        negative_bounds[i] = _mm512_set1_pd(-equations.error_bounds[i]);
+    }
+    const size_t num_full_words = size / 64;
+    for (size_t word = 0; word < num_full_words; ++word) {
+        uint64_t inside_word = 0;
+        uint64_t undecided_word = 0;
+        for (size_t j = 0; j < 64; j += 8) {
+            const __m512d x = _mm512_loadu_pd(xs + word * 64 + j);
+            const __m512d y = _mm512_loadu_pd(ys + word * 64 + j);
+            __mmask8 in_box = _mm512_cmp_pd_mask(x, min_x, _CMP_GE_OQ) & _mm512_cmp_pd_mask(x, max_x, _CMP_LE_OQ) &
+                              _mm512_cmp_pd_mask(y, min_y, _CMP_GE_OQ) & _mm512_cmp_pd_mask(y, max_y, _CMP_LE_OQ);
+            __mmask8 inside = in_box;
+            __mmask8 not_outside = in_box;
+            for (size_t i = 0; i < 3; ++i) {
+                __m512d value = _mm512_add_pd(_mm512_mul_pd(a[i], x), _mm512_mul_pd(b[i], y));
+                value = _mm512_add_pd(value, c[i]);
+                inside &= _mm512_cmp_pd_mask(value, bounds[i], _CMP_GT_OQ);
+                not_outside &= _mm512_cmp_pd_mask(value, negative_bounds[i], _CMP_NLT_UQ);
+            }
+            inside_word |= static_cast<uint64_t>(inside) << j;
+            undecided_word |= static_cast<uint64_t>(not_outside & ~inside & 0xFF) << j;
+        }
+        inside_mask[word] = inside_word;
+        undecided_mask[word] = undecided_word;
+    }
+    ComputeTriangleMasksScalar(equations, xs, ys, num_full_words * 64, size, inside_mask, undecided_mask);
+}
+
+#endif
+
+/**
+ * @brief GetTriangleLocation for the points [0, size), dispatching to the AVX-512, AVX2 or scalar kernel according
+ * to euclid::util::GetSimdLevel.
+ */
+inline void ComputeTriangleMasks(const TriangleEdgeEquations& equations, const double* xs, const double* ys,
+                                 size_t size, uint64_t* inside_mask, uint64_t* undecided_mask) {
+#if defined(EUCLID_X86_64)
+    switch (euclid::util::GetSimdLevel()) {
+        case euclid::util::SimdLevel::kAvx512:
+            return ComputeTriangleMasksAvx512(equations, xs, ys, size, inside_mask, undecided_mask);
+        case euclid::util::SimdLevel::kAvx2:
+            return ComputeTriangleMasksAvx2(equations, xs, ys, size, inside_mask, undecided_mask);
+        default:
+            break;
+    }
+#endif
+    ComputeTriangleMasksScalar(equations, xs, ys, 0, size, inside_mask, undecided_mask);
+}
+
+/**
+ * @brief Batch form of IsPointInClosedTriangle for a fixed triangle, exact like it. The points are tested by the
+ * lines of the edges several at a time and only those too near an edge by the exact predicate.
+ *
+ * @param points The points to check.
+ * @param triangle The triangle, in either orientation. A degenerate triangle contains no point.
+ * @param mask Receives GetNumMaskWords(points.Size()) words, bit i is set if points[i] is in the closed triangle.
+ */
+inline void IsPointInClosedTriangle(const geometry::PointSet2D& points, const geometry::Triangle2D& triangle,
+                                    uint64_t* mask) {
+    const TriangleEdgeEquations equations = GetTriangleEdgeEquations(triangle);
+    constexpr size_t kBlockWords = 64;
+    uint64_t undecided_mask[kBlockWords];
+    const size_t num_words = GetNumMaskWords(points.Size());
+    for (size_t block = 0; block < num_words; block += kBlockWords) {
+        size_t begin = block * 64;
+        size_t end = begin + kBlockWords * 64 < points.Size() ? begin + kBlockWords * 64 : points.Size();
+        ComputeTriangleMasks(equations, points.X() + begin, points.Y() + begin, end - begin, mask + block,
+                             undecided_mask);
+        for (size_t word = block; word < num_words && word < block + kBlockWords; ++word) {
+            for (uint64_t bits = undecided_mask[word - block]; bits != 0; bits &= bits - 1) {
+                const size_t i = word * 64 + static_cast<size_t>(std::countr_zero(bits));
+                if (IsPointInClosedTriangle({points.X()[i], points.Y()[i]}, triangle)) {
+                    mask[word] |= uint64_t{1} << (i % 64);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace euclid::algorithm::util
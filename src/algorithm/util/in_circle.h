@@ -0,0 +1,149 @@
+#pragma once
+
+/**
+ * @file in_circle.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cmath>
+#include <cstddef>
+
+#include "algorithm/util/orient_2d.h"
+#include "geometry/point_2d.h"
+
+namespace euclid::algorithm::util {
+
+/**
+ * @brief Error bound of the InCircle filter, relative to the permanent of the determinant.
+ */
+inline constexpr double kInCircleErrorBoundA = (10.0 + 96.0 * expansion::kEpsilon) * expansion::kEpsilon;
+
+/**
+ * @brief The exact InCircle determinant of the untranslated coordinates, run when the floating-point filter cannot
+ * certify the sign. Follows Shewchuk's incircleexact: the 2 x 2 minors of every pair of points are exact expansions,
+ * combined into the 3 x 3 minors and lifted by the squared coordinates.
+ */
+inline double InCircleExact(const geometry::Point2D& a, const geometry::Point2D& b, const geometry::Point2D& c,
+                            const geometry::Point2D& d) {
+    using namespace expansion;
+    // minor[4] == p_x * q_y - q_x * p_y
+    auto GetMinor = [](const geometry::Point2D& p, const geometry::Point2D& q, double* minor) {
+        double left = 0.0;
+        double left_tail = 0.0;
+        double right = 0.0;
+        double right_tail = 0.0;
+        TwoProduct(p.coords[0], q.coords[1], left, left_tail);
+        TwoProduct(q.coords[0], p.coords[1], right, right_tail);
+        TwoTwoDiff(left, left_tail, right, right_tail, minor);
+    };
+    double ab[4];
+    double bc[4];
+    double cd[4];
+    double da[4];
+    double ac[4];
+    double bd[4];
+    GetMinor(a, b, ab);
+    GetMinor(b, c, bc);
+    GetMinor(c, d, cd);
+    GetMinor(d, a, da);
+    GetMinor(a, c, ac);
+    GetMinor(b, d, bd);
+
+    // the 3 x 3 minors of three points each, e.g. bcd == bc + cd - bd
+    double temp[8];
+    double cda[12];
+    double dab[12];
+    double abc[12];
+    double bcd[12];
+    size_t temp_size = FastExpansionSumZeroElim(cd, 4, da, 4, temp);
+    const size_t cda_size = FastExpansionSumZeroElim(temp, temp_size, ac, 4, cda);
+    temp_size = FastExpansionSumZeroElim(da, 4, ab, 4, temp);
+    const size_t dab_size = FastExpansionSumZeroElim(temp, temp_size, bd, 4, dab);
+    for (size_t i = 0; i < 4; ++i) {
+        bd[i] = -bd[i];
+        ac[i] = -ac[i];
+    }
+    temp_size = FastExpansionSumZeroElim(ab, 4, bc, 4, temp);
+    const size_t abc_size = FastExpansionSumZeroElim(temp, temp_size, ac, 4, abc);
+    temp_size = FastExpansionSumZeroElim(bc, 4, cd, 4, temp);
+    const size_t bcd_size = FastExpansionSumZeroElim(temp, temp_size, bd, 4, bcd);
+
+    // lift * minor, with lift == p_x^2 + p_y^2 and the sign of the cofactor
+    auto Lift = [](const double* minor, size_t minor_size, const geometry::Point2D& p, double sign, double* lifted) {
+        double x[24];
+        double xx[48];
+        double y[24];
+        double yy[48];
+        size_t x_size = ScaleExpansionZeroElim(minor, minor_size, p.coords[0], x);
+        size_t xx_size = ScaleExpansionZeroElim(x, x_size, sign * p.coords[0], xx);
+        size_t y_size = ScaleExpansionZeroElim(minor, minor_size, p.coords[1], y);
+        size_t yy_size = ScaleExpansionZeroElim(y, y_size, sign * p.coords[1], yy);
+        return FastExpansionSumZeroElim(xx, xx_size, yy, yy_size, lifted);
+    };
+    double a_det[96];
+    double b_det[96];
+    double c_det[96];
+    double d_det[96];
+    const size_t a_size = Lift(bcd, bcd_size, a, 1.0, a_det);
+    const size_t b_size = Lift(cda, cda_size, b, -1.0, b_det);
+    const size_t c_size = Lift(dab, dab_size, c, 1.0, c_det);
+    const size_t d_size = Lift(abc, abc_size, d, -1.0, d_det);
+
+    double ab_det[192];
+    double cd_det[192];
+    double det[384];
+    const size_t ab_size = FastExpansionSumZeroElim(a_det, a_size, b_det, b_size, ab_det);
+    const size_t cd_size = FastExpansionSumZeroElim(c_det, c_size, d_det, d_size, cd_det);
+    const size_t det_size = FastExpansionSumZeroElim(ab_det, ab_size, cd_det, cd_size, det);
+    return det[det_size - 1];
+}
+
+/**
+ * @brief Evaluates whether a point lies inside the circle through three others with Shewchuk's adaptive precision
+ * predicate, the companion of Orient2D for Delaunay triangulations.
+ *
+ * The determinant of the coordinates relative to d is first computed in plain floating point and accepted if it
+ * exceeds a static error bound. Otherwise, i.e. for (nearly) cocircular points, the determinant is computed exactly
+ * with the expansion arithmetic of orient_2d.h. The intermediate stages of Shewchuk's incircleadapt are left out, so
+ * points on a common circle, e.g. of a grid, pay for the exact determinant at once. The sign is always exact as long
+ * as no intermediate result overflows or underflows.
+ *
+ * @param a The first point of the circle.
+ * @param b The second point of the circle.
+ * @param c The third point of the circle, a, b, c in counter-clockwise order.
+ * @param d The point to test.
+ * @return A value whose sign is positive if d lies inside the circle, negative if it lies outside and zero if the four
+ * points are cocircular. The sign is reversed if a, b, c are in clockwise order.
+ */
+inline double InCircle(const geometry::Point2D& a, const geometry::Point2D& b, const geometry::Point2D& c,
+                       const geometry::Point2D& d) {
+    const double ad_x = a.coords[0] - d.coords[0];
+    const double bd_x = b.coords[0] - d.coords[0];
+    const double cd_x = c.coords[0] - d.coords[0];
+    const double ad_y = a.coords[1] - d.coords[1];
+    const double bd_y = b.coords[1] - d.coords[1];
+    const double cd_y = c.coords[1] - d.coords[1];
+
+    const double bd_x_cd_y = bd_x * cd_y;
+    const double cd_x_bd_y = cd_x * bd_y;
+    const double a_lift = ad_x * ad_x + ad_y * ad_y;
+    const double cd_x_ad_y = cd_x * ad_y;
+    const double ad_x_cd_y = ad_x * cd_y;
+    const double b_lift = bd_x * bd_x + bd_y * bd_y;
+    const double ad_x_bd_y = ad_x * bd_y;
+    const double bd_x_ad_y = bd_x * ad_y;
+    const double c_lift = cd_x * cd_x + cd_y * cd_y;
+
+    const double det =
+        a_lift * (bd_x_cd_y - cd_x_bd_y) + b_lift * (cd_x_ad_y - ad_x_cd_y) + c_lift * (ad_x_bd_y - bd_x_ad_y);
+    const double permanent = (std::abs(bd_x_cd_y) + std::abs(cd_x_bd_y)) * a_lift +
+                             (std::abs(cd_x_ad_y) + std::abs(ad_x_cd_y)) * b_lift +
+                             (std::abs(ad_x_bd_y) + std::abs(bd_x_ad_y)) * c_lift;
+    if (std::abs(det) > kInCircleErrorBoundA * permanent) {
+        return det;
+    }
+    return InCircleExact(a, b, c, d);
+}
+
+}  // namespace euclid::algorithm::util
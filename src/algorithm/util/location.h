@@ -6,12 +6,111 @@
  * @date 2025-09-01
  */
 
+#include <cassert>
+#include <type_traits>
+
 #include "geometry/point_2d.h"
 #include "geometry/triangle_2d.h"
 #include "util/compare.h"
+#include "util/scalar_traits.h"
 
 namespace euclid::algorithm::util {
 
+/**
+ * @brief Whether both coordinates of a point are in the range the predicates are exact for, see
+ * util::IsExactCoordinate.
+ */
+template <typename T>
+constexpr bool IsExactPoint(const geometry::BasicPoint2D<T>& point) {
+    return euclid::util::IsExactCoordinate(point.coords[0]) && euclid::util::IsExactCoordinate(point.coords[1]);
+}
+
+/**
+ * @brief The type of the point arguments after the first one, whose coordinate type is taken from the first one only,
+ * so that they may be anything converting to its point type.
+ */
+template <typename T>
+using PointArgument = std::type_identity_t<geometry::BasicPoint2D<T>>;
+
+/**
+ * @brief The type of the triangle arguments after a point, like PointArgument.
+ */
+template <typename T>
+using TriangleArgument = std::type_identity_t<geometry::BasicTriangle2D<T>>;
+
+/**
+ * @brief Evaluates the cross product (q - p) x (r - p), i.e. twice the signed area of the triangle p, q, r.
+ *
+ * Integer coordinates are evaluated exactly in the wider accumulator type, see util::ScalarTraits. Debug builds assert
+ * that they are in range.
+ *
+ * @param p The first point.
+ * @param q The second point.
+ * @param r The third point.
+ * @return The cross product, positive if p, q, r make a left turn.
+ */
+template <typename T>
+inline typename euclid::util::ScalarTraits<T>::Accumulator GetCrossValue(const geometry::BasicPoint2D<T>& p,
+                                                                         const PointArgument<T>& q,
+                                                                         const PointArgument<T>& r) {
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+    if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+        assert(IsExactPoint(p) && IsExactPoint(q) && IsExactPoint(r));
+        return (Accumulator{q.coords[0]} - p.coords[0]) * (Accumulator{r.coords[1]} - p.coords[1]) -
+               (Accumulator{q.coords[1]} - p.coords[1]) * (Accumulator{r.coords[0]} - p.coords[0]);
+    } else {
+        Accumulator p_x = p.coords[0];
+        Accumulator p_y = p.coords[1];
+        Accumulator q_x = q.coords[0];
+        Accumulator q_y = q.coords[1];
+        Accumulator r_x = r.coords[0];
+        Accumulator r_y = r.coords[1];
+        return p_x * q_y - p_y * q_x + q_x * r_y - q_y * r_x + r_x * p_y - r_y * p_x;
+    }
+}
+
+/**
+ * @brief Evaluates the dot product (q - p) . (r - p).
+ *
+ * @param p The common point.
+ * @param q The second point.
+ * @param r The third point.
+ * @return The dot product.
+ */
+template <typename T>
+inline typename euclid::util::ScalarTraits<T>::Accumulator GetDotValue(const geometry::BasicPoint2D<T>& p,
+                                                                       const PointArgument<T>& q,
+                                                                       const PointArgument<T>& r) {
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+    assert(IsExactPoint(p) && IsExactPoint(q) && IsExactPoint(r));
+    Accumulator p_x = p.coords[0];
+    Accumulator p_y = p.coords[1];
+    return (Accumulator(q.coords[0]) - p_x) * (Accumulator(r.coords[0]) - p_x) +
+           (Accumulator(q.coords[1]) - p_y) * (Accumulator(r.coords[1]) - p_y);
+}
+
+/**
+ * @brief Classifies the sign of a cross or dot product value: exactly for exact coordinate types, with the tolerance
+ * of util::Equal otherwise.
+ *
+ * @return 1 if the value is positive, -1 if it is negative, 0 if it is (considered) zero.
+ */
+template <typename T>
+inline int GetSign(typename euclid::util::ScalarTraits<T>::Accumulator value) {
+    using Accumulator = typename euclid::util::ScalarTraits<T>::Accumulator;
+    if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+        return (value > Accumulator{0}) - (value < Accumulator{0});
+    } else {
+        if (euclid::util::Greater(value, 0.0)) {
+            return 1;
+        }
+        if (euclid::util::Less(value, 0.0)) {
+            return -1;
+        }
+        return 0;
+    }
+}
+
 /**
  * @brief Determines if three points are collinear.
  *
@@ -20,10 +119,31 @@ namespace euclid::algorithm::util {
  * @param r The third point.
  * @return true if the points are collinear, false otherwise.
  */
-inline bool ArePointsCollinear(const geometry::Point2D& p, const geometry::Point2D& q, const geometry::Point2D& r) {
-    auto cross_value = p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0] + q.coords[0] * r.coords[1] -
-                       q.coords[1] * r.coords[0] + r.coords[0] * p.coords[1] - r.coords[1] * p.coords[0];
-    return euclid::util::Equal(cross_value, 0.0);
+template <typename T>
+inline bool ArePointsCollinear(const geometry::BasicPoint2D<T>& p, const PointArgument<T>& q,
+                               const PointArgument<T>& r) {
+    auto cross_value = GetCrossValue(p, q, r);
+    if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+        return cross_value == 0;
+    } else {
+        return euclid::util::Equal(cross_value, 0.0);
+    }
+}
+
+/**
+ * @brief Determines if a collinear point lies between the endpoints of a segment.
+ */
+template <typename T>
+inline bool IsCollinearPointBetween(const geometry::BasicPoint2D<T>& point, const PointArgument<T>& p,
+                                    const PointArgument<T>& q) {
+    auto pq_pr_dot_value = GetDotValue(p, q, point);
+    auto pq_pq_dot_value = GetDotValue(p, q, q);
+    if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+        return pq_pr_dot_value >= 0 && pq_pr_dot_value <= pq_pq_dot_value;
+    } else {
+        return euclid::util::GreaterEqual(pq_pr_dot_value, 0.0) &&
+               euclid::util::LessEqual(pq_pr_dot_value, pq_pq_dot_value);
+    }
 }
 
 /**
@@ -34,22 +154,11 @@ inline bool ArePointsCollinear(const geometry::Point2D& p, const geometry::Point
  * @param q The second endpoint of the segment.
  * @return true if the point is on the segment, false otherwise.
  */
-inline bool IsPointOnSegment(const geometry::Point2D& point, const geometry::Point2D& p, const geometry::Point2D& q) {
-    auto cross_value = p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0] + q.coords[0] * point.coords[1] -
-                       q.coords[1] * point.coords[0] + point.coords[0] * p.coords[1] - point.coords[1] * p.coords[0];
-    if (euclid::util::Equal(cross_value, 0.0)) {
-        // p, q, r are collinear
-        auto pq_pr_dot_value = (q.coords[0] - p.coords[0]) * (point.coords[0] - p.coords[0]) +
-                               (q.coords[1] - p.coords[1]) * (point.coords[1] - p.coords[1]);
-        auto pq_pq_dot_value = (q.coords[0] - p.coords[0]) * (q.coords[0] - p.coords[0]) +
-                               (q.coords[1] - p.coords[1]) * (q.coords[1] - p.coords[1]);
-        if (euclid::util::GreaterEqual(pq_pr_dot_value, 0.0) &&
-            euclid::util::LessEqual(pq_pr_dot_value, pq_pq_dot_value)) {
-            // point r is on the segment pq
-            return true;
-        }
-    }
-    return false;
+template <typename T>
+inline bool IsPointOnSegment(const geometry::BasicPoint2D<T>& point, const PointArgument<T>& p,
+                             const PointArgument<T>& q) {
+    // point r is on the segment pq if p, q, r are collinear and r lies between p and q
+    return ArePointsCollinear(p, q, point) && IsCollinearPointBetween(point, p, q);
 }
 
 /**
@@ -60,10 +169,14 @@ inline bool IsPointOnSegment(const geometry::Point2D& point, const geometry::Poi
  * @param r The third point.
  * @return true if the turn from pq to qr is to the left, false otherwise.
  */
-inline bool IsTurnLeft(const geometry::Point2D& p, const geometry::Point2D& q, const geometry::Point2D& r) {
-    auto cross_value = p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0] + q.coords[0] * r.coords[1] -
-                       q.coords[1] * r.coords[0] + r.coords[0] * p.coords[1] - r.coords[1] * p.coords[0];
-    return euclid::util::Greater(cross_value, 0.0);
+template <typename T>
+inline bool IsTurnLeft(const geometry::BasicPoint2D<T>& p, const PointArgument<T>& q, const PointArgument<T>& r) {
+    auto cross_value = GetCrossValue(p, q, r);
+    if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+        return cross_value > 0;
+    } else {
+        return euclid::util::Greater(cross_value, 0.0);
+    }
 }
 
 /**
@@ -75,28 +188,19 @@ inline bool IsTurnLeft(const geometry::Point2D& p, const geometry::Point2D& q, c
  * @return true if the turn from pq to qr is to the left(r on the ray pq but not on segment pq is consider as true),
  * false otherwise.
  */
-inline bool IsTurnLeftOrOnRay(const geometry::Point2D& p, const geometry::Point2D& q, const geometry::Point2D& r) {
-    auto cross_value = p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0] + q.coords[0] * r.coords[1] -
-                       q.coords[1] * r.coords[0] + r.coords[0] * p.coords[1] - r.coords[1] * p.coords[0];
-    if (euclid::util::Equal(cross_value, 0.0)) {
+template <typename T>
+inline bool IsTurnLeftOrOnRay(const geometry::BasicPoint2D<T>& p, const PointArgument<T>& q,
+                              const PointArgument<T>& r) {
+    if (ArePointsCollinear(p, q, r)) {
         // p, q, r are collinear
-        auto pq_pr_dot_value = (q.coords[0] - p.coords[0]) * (r.coords[0] - p.coords[0]) +
-                               (q.coords[1] - p.coords[1]) * (r.coords[1] - p.coords[1]);
-        auto pq_pq_dot_value = (q.coords[0] - p.coords[0]) * (q.coords[0] - p.coords[0]) +
-                               (q.coords[1] - p.coords[1]) * (q.coords[1] - p.coords[1]);
-        if (euclid::util::GreaterEqual(pq_pr_dot_value, 0.0) &&
-            euclid::util::LessEqual(pq_pr_dot_value, pq_pq_dot_value)) {
+        if (IsCollinearPointBetween(r, p, q)) {
             // point r is on the segment pq
             return false;
         }
-        if (euclid::util::Greater(pq_pr_dot_value, 0.0)) {
-            // point r is on the ray pq
-            return true;
-        }
-        // point r is ont thr ray qp
-        return false;
+        // point r is on the ray pq if it lies on the side of p that q lies on, otherwise on the ray qp
+        return GetSign<T>(GetDotValue(p, q, r)) > 0;
     }
-    return euclid::util::Greater(cross_value, 0.0);
+    return IsTurnLeft(p, q, r);
 }
 
 /**
@@ -106,7 +210,8 @@ inline bool IsTurnLeftOrOnRay(const geometry::Point2D& p, const geometry::Point2
  * @param triangle The triangle to check against.
  * @return true if the point is inside the triangle, false otherwise.
  */
-inline bool IsPointInTriangle(const geometry::Point2D& point, const geometry::Triangle2D& triangle) {
+template <typename T>
+inline bool IsPointInTriangle(const geometry::BasicPoint2D<T>& point, const TriangleArgument<T>& triangle) {
     bool is_left_1 = IsTurnLeft(triangle.vertices[0], triangle.vertices[1], point);
     bool is_left_2 = IsTurnLeft(triangle.vertices[1], triangle.vertices[2], point);
     bool is_left_3 = IsTurnLeft(triangle.vertices[2], triangle.vertices[0], point);
@@ -122,8 +227,9 @@ inline bool IsPointInTriangle(const geometry::Point2D& point, const geometry::Tr
  * @param r The third point.
  * @return true if the point is inside the triangle, false otherwise.
  */
-inline bool IsPointInTriangle(const geometry::Point2D& point, const geometry::Point2D& p, const geometry::Point2D& q,
-                              const geometry::Point2D& r) {
+template <typename T>
+inline bool IsPointInTriangle(const geometry::BasicPoint2D<T>& point, const PointArgument<T>& p,
+                              const PointArgument<T>& q, const PointArgument<T>& r) {
     bool is_left_1 = IsTurnLeft(p, q, point);
     bool is_left_2 = IsTurnLeft(q, r, point);
     bool is_left_3 = IsTurnLeft(r, p, point);
@@ -0,0 +1,343 @@
+#pragma once
+
+/**
+ * @file orient_2d.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cmath>
+#include <cstddef>
+
+#include "geometry/point_2d.h"
+
+namespace euclid::algorithm::util {
+
+/**
+ * @brief Exact floating-point expansion arithmetic after J. R. Shewchuk, "Adaptive Precision Floating-Point Arithmetic
+ * and Fast Robust Geometric Predicates" (1997).
+ *
+ * An expansion is a sum of non-overlapping doubles ordered by increasing magnitude, its largest component
+ * approximates the sum and has its sign. The error-free transformations below return a rounded result together with
+ * its rounding error, they are exact as long as no overflow or underflow occurs.
+ */
+namespace expansion {
+
+/**
+ * @brief Half an ulp of 1.0, the relative rounding error of one operation.
+ */
+inline constexpr double kEpsilon = 0x1p-53;
+
+/**
+ * @brief 2^ceil(53 / 2) + 1, splits a double into two halves of at most 26 significant bits.
+ */
+inline constexpr double kSplitter = 0x1p27 + 1.0;
+
+/**
+ * @brief x + y == a + b with x = fl(a + b), requires |a| >= |b| or a == 0.
+ */
+inline void FastTwoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double b_virtual = x - a;
+    y = b - b_virtual;
+}
+
+/**
+ * @brief x + y == a + b with x = fl(a + b).
+ */
+inline void TwoSum(double a, double b, double& x, double& y) {
+    x = a + b;
+    double b_virtual = x - a;
+    double a_virtual = x - b_virtual;
+    double b_round = b - b_virtual;
+    double a_round = a - a_virtual;
+    y = a_round + b_round;
+}
+
+/**
+ * @brief The rounding error of x = fl(a - b), i.e. a - b - x.
+ */
+inline double TwoDiffTail(double a, double b, double x) {
+    double b_virtual = a - x;
+    double a_virtual = x + b_virtual;
+    double b_round = b_virtual - b;
+    double a_round = a - a_virtual;
+    return a_round + b_round;
+}
+
+/**
+ * @brief x + y == a - b with x = fl(a - b).
+ */
+inline void TwoDiff(double a, double b, double& x, double& y) {
+    x = a - b;
+    y = TwoDiffTail(a, b, x);
+}
+
+/**
+ * @brief hi + lo == a with both halves fitting in 26 significant bits.
+ */
+inline void Split(double a, double& hi, double& lo) {
+    double c = kSplitter * a;
+    double a_big = c - a;
+    hi = c - a_big;
+    lo = a - hi;
+}
+
+/**
+ * @brief x + y == a * b with x = fl(a * b).
+ */
+inline void TwoProduct(double a, double b, double& x, double& y) {
+    x = a * b;
+#if defined(__FMA__) || defined(__FP_FAST_FMA)
+    // The fused operation rounds once, which also keeps the compiler from contracting the split products below.
+    y = std::fma(a, b, -x);
+#else
+    double a_hi = 0.0;
+    double a_lo = 0.0;
+    double b_hi = 0.0;
+    double b_lo = 0.0;
+    Split(a, a_hi, a_lo);
+    Split(b, b_hi, b_lo);
+    double error_1 = x - a_hi * b_hi;
+    double error_2 = error_1 - a_lo * b_hi;
+    double error_3 = error_2 - a_hi * b_lo;
+    y = a_lo * b_lo - error_3;
+#endif
+}
+
+/**
+ * @brief x[0..3] == (a1 + a0) - (b1 + b0) as an expansion, for two-component expansions a and b.
+ */
+inline void TwoTwoDiff(double a1, double a0, double b1, double b0, double* x) {
+    double i = 0.0;
+    double j = 0.0;
+    double zero = 0.0;
+    TwoDiff(a0, b0, i, x[0]);
+    TwoSum(a1, i, j, zero);
+    TwoDiff(zero, b1, i, x[1]);
+    TwoSum(j, i, x[3], x[2]);
+}
+
+/**
+ * @brief Sums two expansions, dropping zero components.
+ *
+ * @param e The first expansion.
+ * @param e_size The number of components of e, at least 1.
+ * @param f The second expansion.
+ * @param f_size The number of components of f, at least 1.
+ * @param h Receives the sum, room for e_size + f_size components. Must not alias e or f.
+ * @return The number of components of h.
+ */
+inline size_t FastExpansionSumZeroElim(const double* e, size_t e_size, const double* f, size_t f_size, double* h) {
+    size_t e_index = 0;
+    size_t f_index = 0;
+    double e_now = e[0];
+    double f_now = f[0];
+    // Components are merged by increasing magnitude.
+    auto TakeE = [&]() {
+        double value = e_now;
+        e_now = ++e_index < e_size ? e[e_index] : 0.0;
+        return value;
+    };
+    auto TakeF = [&]() {
+        double value = f_now;
+        f_now = ++f_index < f_size ? f[f_index] : 0.0;
+        return value;
+    };
+    auto IsESmaller = [&]() { return (f_now > e_now) == (f_now > -e_now); };
+
+    double q = IsESmaller() ? TakeE() : TakeF();
+    double q_new = 0.0;
+    double h_h = 0.0;
+    size_t h_index = 0;
+    if (e_index < e_size && f_index < f_size) {
+        FastTwoSum(IsESmaller() ? TakeE() : TakeF(), q, q_new, h_h);
+        q = q_new;
+        if (h_h != 0.0) {
+            h[h_index++] = h_h;
+        }
+        while (e_index < e_size && f_index < f_size) {
+            TwoSum(q, IsESmaller() ? TakeE() : TakeF(), q_new, h_h);
+            q = q_new;
+            if (h_h != 0.0) {
+                h[h_index++] = h_h;
+            }
+        }
+    }
+    while (e_index < e_size) {
+        TwoSum(q, TakeE(), q_new, h_h);
+        q = q_new;
+        if (h_h != 0.0) {
+            h[h_index++] = h_h;
+        }
+    }
+    while (f_index < f_size) {
+        TwoSum(q, TakeF(), q_new, h_h);
+        q = q_new;
+        if (h_h != 0.0) {
+            h[h_index++] = h_h;
+        }
+    }
+    if (q != 0.0 || h_index == 0) {
+        h[h_index++] = q;
+    }
+    return h_index;
+}
+
+/**
+ * @brief Multiplies an expansion by a double, dropping zero components.
+ *
+ * @param e The expansion.
+ * @param e_size The number of components of e, at least 1.
+ * @param b The factor.
+ * @param h Receives the product, room for 2 * e_size components. Must not alias e.
+ * @return The number of components of h.
+ */
+inline size_t ScaleExpansionZeroElim(const double* e, size_t e_size, double b, double* h) {
+    double q = 0.0;
+    double h_h = 0.0;
+    size_t h_index = 0;
+    TwoProduct(e[0], b, q, h_h);
+    if (h_h != 0.0) {
+        h[h_index++] = h_h;
+    }
+    for (size_t e_index = 1; e_index < e_size; ++e_index) {
+        double product = 0.0;
+        double product_tail = 0.0;
+        double sum = 0.0;
+        TwoProduct(e[e_index], b, product, product_tail);
+        TwoSum(q, product_tail, sum, h_h);
+        if (h_h != 0.0) {
+            h[h_index++] = h_h;
+        }
+        FastTwoSum(product, sum, q, h_h);
+        if (h_h != 0.0) {
+            h[h_index++] = h_h;
+        }
+    }
+    if (q != 0.0 || h_index == 0) {
+        h[h_index++] = q;
+    }
+    return h_index;
+}
+
+/**
+ * @brief Approximates the value of an expansion by the rounded sum of its components.
+ */
+inline double Estimate(const double* e, size_t e_size) {
+    double value = e[0];
+    for (size_t i = 1; i < e_size; ++i) {
+        value += e[i];
+    }
+    return value;
+}
+
+}  // namespace expansion
+
+/**
+ * @brief Error bounds of the Orient2D stages, relative to |det_left| + |det_right|.
+ */
+inline constexpr double kOrient2DErrorBoundA = (3.0 + 16.0 * expansion::kEpsilon) * expansion::kEpsilon;
+inline constexpr double kOrient2DErrorBoundB = (2.0 + 12.0 * expansion::kEpsilon) * expansion::kEpsilon;
+inline constexpr double kOrient2DErrorBoundC =
+    (9.0 + 64.0 * expansion::kEpsilon) * expansion::kEpsilon * expansion::kEpsilon;
+inline constexpr double kOrient2DResultErrorBound = (3.0 + 8.0 * expansion::kEpsilon) * expansion::kEpsilon;
+
+/**
+ * @brief The adaptive stages of Orient2D, run when the floating-point filter cannot certify the sign.
+ *
+ * @param det_sum |det_left| + |det_right| of the filter.
+ */
+inline double Orient2DAdaptive(const geometry::Point2D& p, const geometry::Point2D& q, const geometry::Point2D& r,
+                               double det_sum) {
+    using namespace expansion;
+    const double pr_x = p.coords[0] - r.coords[0];
+    const double qr_x = q.coords[0] - r.coords[0];
+    const double pr_y = p.coords[1] - r.coords[1];
+    const double qr_y = q.coords[1] - r.coords[1];
+
+    // Stage B: the exact determinant of the rounded differences.
+    double det_left = 0.0;
+    double det_left_tail = 0.0;
+    double det_right = 0.0;
+    double det_right_tail = 0.0;
+    TwoProduct(pr_x, qr_y, det_left, det_left_tail);
+    TwoProduct(pr_y, qr_x, det_right, det_right_tail);
+    double b[4];
+    TwoTwoDiff(det_left, det_left_tail, det_right, det_right_tail, b);
+    double det = Estimate(b, 4);
+    double error_bound = kOrient2DErrorBoundB * det_sum;
+    if (det >= error_bound || -det >= error_bound) {
+        return det;
+    }
+
+    const double pr_x_tail = TwoDiffTail(p.coords[0], r.coords[0], pr_x);
+    const double qr_x_tail = TwoDiffTail(q.coords[0], r.coords[0], qr_x);
+    const double pr_y_tail = TwoDiffTail(p.coords[1], r.coords[1], pr_y);
+    const double qr_y_tail = TwoDiffTail(q.coords[1], r.coords[1], qr_y);
+    if (pr_x_tail == 0.0 && pr_y_tail == 0.0 && qr_x_tail == 0.0 && qr_y_tail == 0.0) {
+        // The differences were exact, so is b.
+        return det;
+    }
+
+    // Stage C: a first-order correction for the rounding errors of the differences.
+    error_bound = kOrient2DErrorBoundC * det_sum + kOrient2DResultErrorBound * std::abs(det);
+    det += (pr_x * qr_y_tail + qr_y * pr_x_tail) - (pr_y * qr_x_tail + qr_x * pr_y_tail);
+    if (det >= error_bound || -det >= error_bound) {
+        return det;
+    }
+
+    // Stage D: the exact determinant.
+    double s = 0.0;
+    double s_tail = 0.0;
+    double t = 0.0;
+    double t_tail = 0.0;
+    double u[4];
+    double c1[8];
+    double c2[12];
+    double d[16];
+    TwoProduct(pr_x_tail, qr_y, s, s_tail);
+    TwoProduct(pr_y_tail, qr_x, t, t_tail);
+    TwoTwoDiff(s, s_tail, t, t_tail, u);
+    size_t c1_size = FastExpansionSumZeroElim(b, 4, u, 4, c1);
+
+    TwoProduct(pr_x, qr_y_tail, s, s_tail);
+    TwoProduct(pr_y, qr_x_tail, t, t_tail);
+    TwoTwoDiff(s, s_tail, t, t_tail, u);
+    size_t c2_size = FastExpansionSumZeroElim(c1, c1_size, u, 4, c2);
+
+    TwoProduct(pr_x_tail, qr_y_tail, s, s_tail);
+    TwoProduct(pr_y_tail, qr_x_tail, t, t_tail);
+    TwoTwoDiff(s, s_tail, t, t_tail, u);
+    size_t d_size = FastExpansionSumZeroElim(c2, c2_size, u, 4, d);
+    return d[d_size - 1];
+}
+
+/**
+ * @brief Evaluates the orientation of three points with Shewchuk's adaptive precision predicate.
+ *
+ * The determinant is first computed in plain floating point and accepted if it exceeds a static error bound, which
+ * decides nearly every call. Only inputs that are (nearly) collinear escalate to the exact stages. The sign is always
+ * exact and does not depend on the scale of the coordinates, as long as no intermediate result overflows or
+ * underflows.
+ *
+ * @param p The first point.
+ * @param q The second point.
+ * @param r The third point.
+ * @return A value whose sign is positive if p, q, r make a left turn (counter-clockwise), negative if they make a
+ * right turn and zero if they are collinear. Its magnitude approximates twice the area of the triangle.
+ */
+inline double Orient2D(const geometry::Point2D& p, const geometry::Point2D& q, const geometry::Point2D& r) {
+    const double det_left = (p.coords[0] - r.coords[0]) * (q.coords[1] - r.coords[1]);
+    const double det_right = (p.coords[1] - r.coords[1]) * (q.coords[0] - r.coords[0]);
+    const double det = det_left - det_right;
+    // Equivalent to Shewchuk's sign tests without their branches: if det_left and det_right differ in sign (or one is
+    // zero), |det| == det_sum and the filter always accepts.
+    const double det_sum = std::abs(det_left) + std::abs(det_right);
+    if (std::abs(det) >= kOrient2DErrorBoundA * det_sum) {
+        return det;
+    }
+    return Orient2DAdaptive(p, q, r, det_sum);
+}
+
+}  // namespace euclid::algorithm::util
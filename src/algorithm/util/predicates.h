@@ -0,0 +1,190 @@
+#pragma once
+
+/**
+ * @file predicates.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include "algorithm/util/location.h"
+#include "algorithm/util/orient_2d.h"
+#include "geometry/point_2d.h"
+#include "util/compare.h"
+#include "util/instrumentation.h"
+#include "util/scalar_traits.h"
+
+namespace euclid::algorithm::util {
+
+/**
+ * @brief Predicate policy comparing the cross product against the fixed absolute tolerance of util::Equal, i.e. the
+ * free functions of location.h. Fast, but the answers change when the input is rescaled.
+ */
+struct TolerancePredicates {
+    static constexpr bool kIsExact = false;
+
+    /**
+     * @return 1 if p, q, r make a left turn, -1 if they make a right turn and 0 if they are collinear.
+     */
+    template <typename T>
+    static int GetOrientation(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                              const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::orientation_calls);
+        return GetSign<T>(GetCrossValue(p, q, r));
+    }
+
+    template <typename T>
+    static bool IsTurnLeft(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                           const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::turn_left_calls);
+        return util::IsTurnLeft(p, q, r);
+    }
+
+    template <typename T>
+    static bool ArePointsCollinear(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                                   const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::collinear_calls);
+        return util::ArePointsCollinear(p, q, r);
+    }
+
+    template <typename T>
+    static bool IsPointOnSegment(const geometry::BasicPoint2D<T>& point, const geometry::BasicPoint2D<T>& p,
+                                 const geometry::BasicPoint2D<T>& q) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::on_segment_calls);
+        return util::IsPointOnSegment(point, p, q);
+    }
+
+    template <typename T>
+    static bool IsTurnLeftOrOnRay(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                                  const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::turn_left_or_on_ray_calls);
+        return util::IsTurnLeftOrOnRay(p, q, r);
+    }
+
+    template <typename T>
+    static bool IsPointInTriangle(const geometry::BasicPoint2D<T>& point, const geometry::BasicPoint2D<T>& p,
+                                  const geometry::BasicPoint2D<T>& q, const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::point_in_triangle_calls);
+        return util::IsPointInTriangle(point, p, q, r);
+    }
+
+    template <typename T>
+    static bool AreCoincident(const geometry::BasicPoint2D<T>& a, const geometry::BasicPoint2D<T>& b) {
+        return a == b;
+    }
+};
+
+/**
+ * @brief Predicate policy deciding every orientation exactly, with the adaptive Orient2D for floating-point
+ * coordinates and the exact integer cross product otherwise, so the answers do not depend on the scale of the input.
+ * Nearly as fast as TolerancePredicates unless most inputs are (nearly) collinear.
+ */
+struct AdaptivePredicates {
+    static constexpr bool kIsExact = true;
+
+    /**
+     * @return 1 if p, q, r make a left turn, -1 if they make a right turn and 0 if they are collinear.
+     */
+    template <typename T>
+    static int GetOrientation(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                              const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::orientation_calls);
+        return Orientation(p, q, r);
+    }
+
+    template <typename T>
+    static bool IsTurnLeft(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                           const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::turn_left_calls);
+        return Orientation(p, q, r) > 0;
+    }
+
+    template <typename T>
+    static bool ArePointsCollinear(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                                   const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::collinear_calls);
+        return Orientation(p, q, r) == 0;
+    }
+
+    template <typename T>
+    static bool IsPointOnSegment(const geometry::BasicPoint2D<T>& point, const geometry::BasicPoint2D<T>& p,
+                                 const geometry::BasicPoint2D<T>& q) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::on_segment_calls);
+        return Orientation(p, q, point) == 0 && IsInBoundingBox(point, p, q);
+    }
+
+    template <typename T>
+    static bool IsTurnLeftOrOnRay(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                                  const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::turn_left_or_on_ray_calls);
+        int orientation = Orientation(p, q, r);
+        if (orientation != 0) {
+            return orientation > 0;
+        }
+        if (IsInBoundingBox(r, p, q)) {
+            // r is on the segment pq
+            return false;
+        }
+        // r is on the line pq but not on the segment, so on the ray pq if it lies beyond q along an axis pq spans
+        if (p.coords[0] != q.coords[0]) {
+            return (q.coords[0] > p.coords[0]) == (r.coords[0] > q.coords[0]);
+        }
+        if (p.coords[1] != q.coords[1]) {
+            return (q.coords[1] > p.coords[1]) == (r.coords[1] > q.coords[1]);
+        }
+        return false;
+    }
+
+    template <typename T>
+    static bool IsPointInTriangle(const geometry::BasicPoint2D<T>& point, const geometry::BasicPoint2D<T>& p,
+                                  const geometry::BasicPoint2D<T>& q, const geometry::BasicPoint2D<T>& r) {
+        euclid::util::CountHullEvent(&euclid::util::HullStats::point_in_triangle_calls);
+        bool is_left_1 = Orientation(p, q, point) > 0;
+        bool is_left_2 = Orientation(q, r, point) > 0;
+        bool is_left_3 = Orientation(r, p, point) > 0;
+        return is_left_1 == is_left_2 && is_left_2 == is_left_3;
+    }
+
+    template <typename T>
+    static bool AreCoincident(const geometry::BasicPoint2D<T>& a, const geometry::BasicPoint2D<T>& b) {
+        return a.coords[0] == b.coords[0] && a.coords[1] == b.coords[1];
+    }
+
+private:
+    /**
+     * @brief GetOrientation without counting, for the other predicates.
+     */
+    template <typename T>
+    static int Orientation(const geometry::BasicPoint2D<T>& p, const geometry::BasicPoint2D<T>& q,
+                           const geometry::BasicPoint2D<T>& r) {
+        if constexpr (euclid::util::ScalarTraits<T>::kIsExact) {
+            return GetSign<T>(GetCrossValue(p, q, r));
+        } else {
+            // float coordinates convert to double exactly
+            auto ToPoint2D = [](const geometry::BasicPoint2D<T>& point) {
+                return geometry::Point2D{static_cast<double>(point.coords[0]), static_cast<double>(point.coords[1])};
+            };
+            double det = Orient2D(ToPoint2D(p), ToPoint2D(q), ToPoint2D(r));
+            return (det > 0.0) - (det < 0.0);
+        }
+    }
+
+    /**
+     * @brief Determines if point lies in the axis-aligned bounding box of p and q, for a point collinear with them
+     * equivalent to lying on the segment pq.
+     */
+    template <typename T>
+    static bool IsInBoundingBox(const geometry::BasicPoint2D<T>& point, const geometry::BasicPoint2D<T>& p,
+                                const geometry::BasicPoint2D<T>& q) {
+        auto IsBetween = [](T value, T a, T b) { return a <= b ? a <= value && value <= b : b <= value && value <= a; };
+        return IsBetween(point.coords[0], p.coords[0], q.coords[0]) &&
+               IsBetween(point.coords[1], p.coords[1], q.coords[1]);
+    }
+};
+
+/**
+ * @brief Whether a predicate policy decides exactly for coordinates of type T, which integer coordinates always do.
+ */
+template <typename Predicates, typename T>
+inline constexpr bool kIsExactFor = Predicates::kIsExact || euclid::util::ScalarTraits<T>::kIsExact;
+
+}  // namespace euclid::algorithm::util
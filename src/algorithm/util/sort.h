@@ -6,14 +6,236 @@
  * @date 2025-09-11
  */
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
 #include <vector>
 
 #include "geometry/point_2d.h"
+#include "util/simd.h"
+#include "util/thread_pool.h"
 
 namespace euclid::algorithm::util {
 
-inline size_t GetLowestThenLeftestPointIndex(const std::vector<geometry::Point2D>& input_points) {
+/**
+ * @brief Compares two points by y-coordinate, then by x-coordinate, without tolerance.
+ *
+ * Agrees with Point2D::operator< except for points whose y-coordinates differ by less than the tolerance. Unlike
+ * Point2D::operator< it is a strict weak ordering, so sorting with it yields a consistent sweep order.
+ *
+ * @param a The first point.
+ * @param b The second point.
+ * @return true if a comes before b, false otherwise.
+ */
+template <typename T>
+inline bool IsLowerThenLefter(const geometry::BasicPoint2D<T>& a, const geometry::BasicPoint2D<T>& b) {
+    if (a.coords[1] != b.coords[1]) {
+        return a.coords[1] < b.coords[1];
+    }
+    return a.coords[0] < b.coords[0];
+}
+
+/**
+ * @brief The largest input SortBySortingNetwork handles.
+ */
+inline constexpr size_t kMaxSortingNetworkSize = 8;
+
+/**
+ * @brief Sorts at most kMaxSortingNetworkSize elements with a fixed sequence of compare-exchanges, the optimal sorting
+ * networks of Knuth, TAOCP Vol. 3, 5.3.4. There are no data-dependent loops, so tiny inputs sort faster than with
+ * std::sort.
+ *
+ * @param values The elements to sort.
+ * @param size The number of elements, at most kMaxSortingNetworkSize.
+ * @param less The strict weak ordering to sort by.
+ */
+template <typename Value, typename Compare>
+inline void SortBySortingNetwork(Value* values, size_t size, Compare less) {
+    struct Comparator {
+        uint8_t i;
+        uint8_t j;
+    };
+    static constexpr Comparator kNetwork2[] = {{0, 1}};
+    static constexpr Comparator kNetwork3[] = {{0, 2}, {0, 1}, {1, 2}};
+    static constexpr Comparator kNetwork4[] = {{0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}};
+    static constexpr Comparator kNetwork5[] = {{0, 1}, {3, 4}, {2, 4}, {2, 3}, {0, 3},
+                                               {0, 2}, {1, 4}, {1, 3}, {1, 2}};
+    static constexpr Comparator kNetwork6[] = {{1, 2}, {4, 5}, {0, 2}, {3, 5}, {0, 1}, {3, 4},
+                                               {2, 5}, {0, 3}, {1, 4}, {2, 4}, {1, 3}, {2, 3}};
+    static constexpr Comparator kNetwork7[] = {{1, 2}, {3, 4}, {5, 6}, {0, 2}, {3, 5}, {4, 6}, {0, 1}, {4, 5},
+                                               {2, 6}, {0, 4}, {1, 5}, {0, 3}, {2, 5}, {1, 3}, {2, 4}, {2, 3}};
+    static constexpr Comparator kNetwork8[] = {{0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6},
+                                               {3, 7}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {2, 4}, {3, 5},
+                                               {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}};
+    auto Run = [values, &less](const auto& network) {
+        for (const auto& comparator : network) {
+            if (less(values[comparator.j], values[comparator.i])) {
+                std::swap(values[comparator.i], values[comparator.j]);
+            }
+        }
+    };
+    switch (size) {
+        case 2:
+            Run(kNetwork2);
+            break;
+        case 3:
+            Run(kNetwork3);
+            break;
+        case 4:
+            Run(kNetwork4);
+            break;
+        case 5:
+            Run(kNetwork5);
+            break;
+        case 6:
+            Run(kNetwork6);
+            break;
+        case 7:
+            Run(kNetwork7);
+            break;
+        case 8:
+            Run(kNetwork8);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Spreads the 16 low bits of a value to the even bits of the result.
+ */
+inline uint32_t InterleaveWithZeros(uint32_t value) {
+    value = (value | (value << 8)) & 0x00FF00FFu;
+    value = (value | (value << 4)) & 0x0F0F0F0Fu;
+    value = (value | (value << 2)) & 0x33333333u;
+    value = (value | (value << 1)) & 0x55555555u;
+    return value;
+}
+
+/**
+ * @brief Gathers the even bits of a value into the 16 low bits of the result, the inverse of InterleaveWithZeros.
+ */
+inline uint32_t CompactEvenBits(uint32_t value) {
+    value &= 0x55555555u;
+    value = (value | (value >> 1)) & 0x33333333u;
+    value = (value | (value >> 2)) & 0x0F0F0F0Fu;
+    value = (value | (value >> 4)) & 0x00FF00FFu;
+    value = (value | (value >> 8)) & 0x0000FFFFu;
+    return value;
+}
+
+/**
+ * @brief The position of a cell along the Morton curve, or Z-order, through a 2^16 x 2^16 grid: the bits of x and y
+ * interleaved, x in the even bits.
+ *
+ * @param x The column of the cell, less than 2^16.
+ * @param y The row of the cell, less than 2^16.
+ * @return The position in [0, 2^32), starting at cell (0, 0).
+ */
+inline uint32_t GetMortonIndex(uint32_t x, uint32_t y) {
+    return InterleaveWithZeros(x) | (InterleaveWithZeros(y) << 1);
+}
+
+/**
+ * @brief The cell at a position along the Morton curve, the inverse of GetMortonIndex.
+ *
+ * @param index The position.
+ * @param x Receives the column of the cell.
+ * @param y Receives the row of the cell.
+ */
+inline void GetMortonCell(uint32_t index, uint32_t& x, uint32_t& y) {
+    x = CompactEvenBits(index);
+    y = CompactEvenBits(index >> 1);
+}
+
+/**
+ * @brief The bits of the position of a cell along the Hilbert curve through a 2^16 x 2^16 grid, which GetHilbertIndex
+ * interleaves.
+ *
+ * The usual loop over the levels of the curve branches on the quadrant at every level, which is unpredictable for
+ * random points. Instead the orientations of all levels are composed by a parallel prefix scan over the bits, after
+ * the branch-free formulation of F. Giesen, O(log) operations without branches.
+ *
+ * @param x The column of the cell, less than 2^16.
+ * @param y The row of the cell, less than 2^16.
+ * @param odd_bits Receives the odd bits of the position.
+ * @param even_bits Receives the even bits of the position.
+ */
+inline void GetHilbertBits(uint32_t x, uint32_t y, uint32_t& odd_bits, uint32_t& even_bits) {
+    // The orientation of every level as a pair of transforms (A, B) and their effect (C, D), composed level by level
+    // with the doubling steps of a prefix scan.
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFFu ^ a;
+    uint32_t c = 0xFFFFu ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFFu);
+    uint32_t prefix_a = a | (b >> 1);
+    uint32_t prefix_b = (a >> 1) ^ a;
+    uint32_t prefix_c = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t prefix_d = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+    for (uint32_t shift : {2u, 4u, 8u}) {
+        a = prefix_a;
+        b = prefix_b;
+        c = prefix_c;
+        d = prefix_d;
+        prefix_a = (a & (a >> shift)) ^ (b & (b >> shift));
+        prefix_b = (a & (b >> shift)) ^ (b & ((a ^ b) >> shift));
+        prefix_c ^= (a & (c >> shift)) ^ (b & (d >> shift));
+        prefix_d ^= (b & (c >> shift)) ^ ((a ^ b) & (d >> shift));
+    }
+    a = prefix_c ^ (prefix_c >> 1);
+    b = prefix_d ^ (prefix_d >> 1);
+    even_bits = x ^ y;
+    odd_bits = b | (0xFFFFu ^ (even_bits | a));
+}
+
+/**
+ * @brief The position of a cell along the Hilbert curve through a 2^16 x 2^16 grid. Cells close on the curve are close
+ * in the plane, so points sorted by it are visited with good locality. Unlike the Morton curve it never jumps between
+ * distant cells.
+ *
+ * @param x The column of the cell, less than 2^16.
+ * @param y The row of the cell, less than 2^16.
+ * @return The position in [0, 2^32), starting at cell (0, 0).
+ */
+inline uint32_t GetHilbertIndex(uint32_t x, uint32_t y) {
+    uint32_t odd_bits = 0;
+    uint32_t even_bits = 0;
+    GetHilbertBits(x, y, odd_bits, even_bits);
+    return (InterleaveWithZeros(odd_bits) << 1) | InterleaveWithZeros(even_bits);
+}
+
+#if defined(EUCLID_X86_64)
+/**
+ * @brief GetMortonIndex with the bit deposit of BMI2, see euclid::util::HasFastBmi2.
+ */
+EUCLID_TARGET_BMI2 inline uint32_t GetMortonIndexBmi2(uint32_t x, uint32_t y) {
+    return _pdep_u32(x, 0x55555555u) | _pdep_u32(y, 0xAAAAAAAAu);
+}
+
+/**
+ * @brief GetMortonCell with the bit extract of BMI2, see euclid::util::HasFastBmi2.
+ */
+EUCLID_TARGET_BMI2 inline void GetMortonCellBmi2(uint32_t index, uint32_t& x, uint32_t& y) {
+    x = _pext_u32(index, 0x55555555u);
+    y = _pext_u32(index, 0xAAAAAAAAu);
+}
+
+/**
+ * @brief GetHilbertIndex with the bit deposit of BMI2, see euclid::util::HasFastBmi2.
+ */
+EUCLID_TARGET_BMI2 inline uint32_t GetHilbertIndexBmi2(uint32_t x, uint32_t y) {
+    uint32_t odd_bits = 0;
+    uint32_t even_bits = 0;
+    GetHilbertBits(x, y, odd_bits, even_bits);
+    return _pdep_u32(odd_bits, 0xAAAAAAAAu) | _pdep_u32(even_bits, 0x55555555u);
+}
+#endif
+
+template <typename T>
+inline size_t GetLowestThenLeftestPointIndex(std::span<const geometry::BasicPoint2D<T>> input_points) {
     if (input_points.empty()) {
         return -1;
     }
@@ -28,4 +250,450 @@ inline size_t GetLowestThenLeftestPointIndex(const std::vector<geometry::Point2D
     return index;
 }
 
+template <typename T>
+inline size_t GetLowestThenLeftestPointIndex(const std::vector<geometry::BasicPoint2D<T>>& input_points) {
+    return GetLowestThenLeftestPointIndex(std::span<const geometry::BasicPoint2D<T>>(input_points));
+}
+
+/**
+ * @brief The space-filling curves points are sorted along by GetSpatialOrder.
+ */
+enum class SpaceFillingCurve { kMorton, kHilbert };
+
+/**
+ * @brief The smallest number of points per thread the parallel spatial sort and radix sort split their input into.
+ */
+inline constexpr size_t kSpatialSortChunkPoints = 1 << 16;
+
+/**
+ * @brief The bounding box of points, mapped onto a 2^16 x 2^16 grid of square cells by GetSpatialKeys.
+ */
+struct SpatialGrid {
+    double min_x = std::numeric_limits<double>::infinity();
+    double min_y = std::numeric_limits<double>::infinity();
+    double max_x = -std::numeric_limits<double>::infinity();
+    double max_y = -std::numeric_limits<double>::infinity();
+
+    /**
+     * @brief Extends the box by points with finite coordinates.
+     */
+    void Add(std::span<const geometry::Point2D> points) {
+        for (const auto& point : points) {
+            min_x = std::min(min_x, point.coords[0]);
+            max_x = std::max(max_x, point.coords[0]);
+            min_y = std::min(min_y, point.coords[1]);
+            max_y = std::max(max_y, point.coords[1]);
+        }
+    }
+
+    /**
+     * @brief Extends the box by another one, e.g. of another chunk of the points.
+     */
+    void Add(const SpatialGrid& other) {
+        min_x = std::min(min_x, other.min_x);
+        max_x = std::max(max_x, other.max_x);
+        min_y = std::min(min_y, other.min_y);
+        max_y = std::max(max_y, other.max_y);
+    }
+
+    /**
+     * @return The factor from coordinates relative to the lower left corner to cells, the same on both axes so that
+     * the cells are square, 0 if the box is empty or a point.
+     */
+    double GetScale() const {
+        const double extent = std::max(max_x - min_x, max_y - min_y);
+        return extent > 0.0 ? 65535.0 / extent : 0.0;
+    }
+};
+
+/**
+ * @brief GetSpatialKeys without runtime dispatch, portable.
+ */
+template <SpaceFillingCurve Curve>
+inline void GetSpatialKeysScalar(std::span<const geometry::Point2D> points, const SpatialGrid& grid,
+                                 uint32_t first_index, uint64_t* keys) {
+    const double scale = grid.GetScale();
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto x = static_cast<uint32_t>((points[i].coords[0] - grid.min_x) * scale);
+        const auto y = static_cast<uint32_t>((points[i].coords[1] - grid.min_y) * scale);
+        const uint32_t index = Curve == SpaceFillingCurve::kMorton ? GetMortonIndex(x, y) : GetHilbertIndex(x, y);
+        keys[i] = static_cast<uint64_t>(index) << 32 | (first_index + i);
+    }
+}
+
+#if defined(EUCLID_X86_64)
+/**
+ * @brief GetSpatialKeys with the bit deposit of BMI2.
+ */
+template <SpaceFillingCurve Curve>
+EUCLID_TARGET_BMI2 inline void GetSpatialKeysBmi2(std::span<const geometry::Point2D> points, const SpatialGrid& grid,
+                                                  uint32_t first_index, uint64_t* keys) {
+    const double scale = grid.GetScale();
+    for (size_t i = 0; i < points.size(); ++i) {
+        const auto x = static_cast<uint32_t>((points[i].coords[0] - grid.min_x) * scale);
+        const auto y = static_cast<uint32_t>((points[i].coords[1] - grid.min_y) * scale);
+        const uint32_t index =
+            Curve == SpaceFillingCurve::kMorton ? GetMortonIndexBmi2(x, y) : GetHilbertIndexBmi2(x, y);
+        keys[i] = static_cast<uint64_t>(index) << 32 | (first_index + i);
+    }
+}
+
+/**
+ * @brief InterleaveWithZeros of 8 values at once.
+ */
+EUCLID_TARGET_AVX2 inline __m256i InterleaveWithZerosAvx2(__m256i value) {
+    value = _mm256_and_si256(_mm256_or_si256(value, _mm256_slli_epi32(value, 8)), _mm256_set1_epi32(0x00FF00FF));
+    value = _mm256_and_si256(_mm256_or_si256(value, _mm256_slli_epi32(value, 4)), _mm256_set1_epi32(0x0F0F0F0F));
+    value = _mm256_and_si256(_mm256_or_si256(value, _mm256_slli_epi32(value, 2)), _mm256_set1_epi32(0x33333333));
+    value = _mm256_and_si256(_mm256_or_si256(value, _mm256_slli_epi32(value, 1)), _mm256_set1_epi32(0x55555555));
+    return value;
+}
+
+/**
+ * @brief GetMortonIndex or GetHilbertIndex of 8 cells at once, the same operations on vectors.
+ */
+template <SpaceFillingCurve Curve>
+EUCLID_TARGET_AVX2 inline __m256i GetCurveIndicesAvx2(__m256i x, __m256i y) {
+    if constexpr (Curve == SpaceFillingCurve::kMorton) {
+        return _mm256_or_si256(InterleaveWithZerosAvx2(x), _mm256_slli_epi32(InterleaveWithZerosAvx2(y), 1));
+    } else {
+        const __m256i ones = _mm256_set1_epi32(0xFFFF);
+        __m256i a = _mm256_xor_si256(x, y);
+        __m256i b = _mm256_xor_si256(ones, a);
+        __m256i c = _mm256_xor_si256(ones, _mm256_or_si256(x, y));
+        __m256i d = _mm256_andnot_si256(y, x);
+        __m256i prefix_a = _mm256_or_si256(a, _mm256_srli_epi32(b, 1));
+        __m256i prefix_b = _mm256_xor_si256(_mm256_srli_epi32(a, 1), a);
+        __m256i prefix_c = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_srli_epi32(c, 1), _mm256_and_si256(b, _mm256_srli_epi32(d, 1))), c);
+        __m256i prefix_d = _mm256_xor_si256(
+            _mm256_xor_si256(_mm256_and_si256(a, _mm256_srli_epi32(c, 1)), _mm256_srli_epi32(d, 1)), d);
+        for (int shift : {2, 4, 8}) {
+            a = prefix_a;
+            b = prefix_b;
+            c = prefix_c;
+            d = prefix_d;
+            const __m256i a_b = _mm256_xor_si256(a, b);
+            prefix_a = _mm256_xor_si256(_mm256_and_si256(a, _mm256_srli_epi32(a, shift)),
+                                        _mm256_and_si256(b, _mm256_srli_epi32(b, shift)));
+            prefix_b = _mm256_xor_si256(_mm256_and_si256(a, _mm256_srli_epi32(b, shift)),
+                                        _mm256_and_si256(b, _mm256_srli_epi32(a_b, shift)));
+            prefix_c = _mm256_xor_si256(prefix_c, _mm256_xor_si256(_mm256_and_si256(a, _mm256_srli_epi32(c, shift)),
+                                                                   _mm256_and_si256(b, _mm256_srli_epi32(d, shift))));
+            prefix_d = _mm256_xor_si256(prefix_d, _mm256_xor_si256(_mm256_and_si256(b, _mm256_srli_epi32(c, shift)),
+                                                                   _mm256_and_si256(a_b, _mm256_srli_epi32(d, shift))));
+        }
+        a = _mm256_xor_si256(prefix_c, _mm256_srli_epi32(prefix_c, 1));
+        b = _mm256_xor_si256(prefix_d, _mm256_srli_epi32(prefix_d, 1));
+        const __m256i even_bits = _mm256_xor_si256(x, y);
+        const __m256i odd_bits = _mm256_or_si256(b, _mm256_xor_si256(ones, _mm256_or_si256(even_bits, a)));
+        return _mm256_or_si256(_mm256_slli_epi32(InterleaveWithZerosAvx2(odd_bits), 1),
+                               InterleaveWithZerosAvx2(even_bits));
+    }
+}
+
+/**
+ * @brief GetSpatialKeys for 8 points at a time with AVX2, the cells rounded like the scalar kernel.
+ *
+ * @return The number of points done, a multiple of 8.
+ */
+template <SpaceFillingCurve Curve>
+EUCLID_TARGET_AVX2 inline size_t GetSpatialKeysAvx2(std::span<const geometry::Point2D> points, const SpatialGrid& grid,
+                                                    uint32_t first_index, uint64_t* keys) {
+    static_assert(sizeof(geometry::Point2D) == 2 * sizeof(double), "the kernel reads interleaved x, y doubles");
+    const double* coords = reinterpret_cast<const double*>(points.data());
+    const __m256d min = _mm256_setr_pd(grid.min_x, grid.min_y, grid.min_x, grid.min_y);
+    const __m256d scale = _mm256_set1_pd(grid.GetScale());
+    // The cells are deinterleaved within the lanes, those of points 0, 1, 4, 5 in the low lane and of 2, 3, 6, 7 in
+    // the high one, so unpacking them with the point indices puts the keys back in order.
+    const __m256i lane_indices = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+    const size_t size = points.size() / 8 * 8;
+    for (size_t i = 0; i < size; i += 8) {
+        const double* source = coords + 2 * i;
+        // x0 y0 x1 y1 | x2 y2 x3 y3 and x4 y4 x5 y5 | x6 y6 x7 y7
+        const __m256i low = _mm256_setr_m128i(
+            _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(source), min), scale)),
+            _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(source + 4), min), scale)));
+        const __m256i high = _mm256_setr_m128i(
+            _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(source + 8), min), scale)),
+            _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_sub_pd(_mm256_loadu_pd(source + 12), min), scale)));
+        const __m256i x = _mm256_castps_si256(
+            _mm256_shuffle_ps(_mm256_castsi256_ps(low), _mm256_castsi256_ps(high), _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m256i y = _mm256_castps_si256(
+            _mm256_shuffle_ps(_mm256_castsi256_ps(low), _mm256_castsi256_ps(high), _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m256i indices = GetCurveIndicesAvx2<Curve>(x, y);
+        const __m256i point_indices =
+            _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(first_index + i)), lane_indices);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(keys + i), _mm256_unpacklo_epi32(point_indices, indices));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(keys + i + 4), _mm256_unpackhi_epi32(point_indices, indices));
+    }
+    return size;
+}
+#endif
+
+/**
+ * @brief Computes the sort keys of points along a space-filling curve: the position of the cell of every point in the
+ * high half, its index in the low half. Sorting the keys by their high half, e.g. with SortByRadix, orders the points
+ * along the curve, points in the same cell by index.
+ *
+ * The positions are computed 8 at a time with AVX2 and the rest one at a time with BMI2 if fast, according to
+ * euclid::util::GetSimdLevel and euclid::util::HasFastBmi2. All kernels give the same keys.
+ *
+ * @param points The points, with finite coordinates inside the grid.
+ * @param grid The grid, e.g. over all points sorted together.
+ * @param curve The space-filling curve.
+ * @param first_index The index of the first point, all indices less than 2^32.
+ * @param keys Receives points.size() keys.
+ */
+inline void GetSpatialKeys(std::span<const geometry::Point2D> points, const SpatialGrid& grid, SpaceFillingCurve curve,
+                           uint32_t first_index, uint64_t* keys) {
+#if defined(EUCLID_X86_64)
+    if (euclid::util::GetSimdLevel() >= euclid::util::SimdLevel::kAvx2) {
+        const size_t size = curve == SpaceFillingCurve::kMorton
+                                ? GetSpatialKeysAvx2<SpaceFillingCurve::kMorton>(points, grid, first_index, keys)
+                                : GetSpatialKeysAvx2<SpaceFillingCurve::kHilbert>(points, grid, first_index, keys);
+        points = points.subspan(size);
+        first_index += static_cast<uint32_t>(size);
+        keys += size;
+    }
+    if (euclid::util::HasFastBmi2()) {
+        if (curve == SpaceFillingCurve::kMorton) {
+            GetSpatialKeysBmi2<SpaceFillingCurve::kMorton>(points, grid, first_index, keys);
+        } else {
+            GetSpatialKeysBmi2<SpaceFillingCurve::kHilbert>(points, grid, first_index, keys);
+        }
+        return;
+    }
+#endif
+    if (curve == SpaceFillingCurve::kMorton) {
+        GetSpatialKeysScalar<SpaceFillingCurve::kMorton>(points, grid, first_index, keys);
+    } else {
+        GetSpatialKeysScalar<SpaceFillingCurve::kHilbert>(points, grid, first_index, keys);
+    }
+}
+
+/**
+ * @brief Runs function(task) for every task in order, for the sequential spatial sort and radix sort.
+ */
+struct SequentialRunner {
+    template <typename Function>
+    void operator()(size_t num_tasks, Function&& function) const {
+        for (size_t task = 0; task < num_tasks; ++task) {
+            function(task);
+        }
+    }
+};
+
+/**
+ * @brief Runs function(task) for every task on a thread pool, for the parallel spatial sort and radix sort.
+ */
+struct ThreadPoolRunner {
+    euclid::util::ThreadPool& thread_pool;
+
+    /**
+     * @return The number of chunks to split size points into, one per thread but of at least kSpatialSortChunkPoints
+     * points.
+     */
+    static size_t GetNumChunks(size_t size, const euclid::util::ThreadPool& thread_pool) {
+        return std::clamp<size_t>(size / kSpatialSortChunkPoints, 1, thread_pool.NumThreads());
+    }
+
+    template <typename Function>
+    void operator()(size_t num_tasks, Function&& function) const {
+        thread_pool.ParallelFor(num_tasks, [&function](size_t task, size_t) { function(task); });
+    }
+};
+
+/**
+ * @brief The radix sort over chunks of the values, run is a SequentialRunner or a ThreadPoolRunner.
+ */
+template <typename Run>
+inline void SortByRadixInChunks(std::span<uint64_t> values, std::span<uint64_t> buffer, size_t low_bit,
+                                size_t num_chunks, Run&& run) {
+    constexpr size_t kDigitBits = 11;
+    constexpr size_t kNumDigits = size_t{1} << kDigitBits;
+    const size_t size = values.size();
+    // the number of values of every digit in every chunk, then where the chunk writes the next of them
+    std::vector<size_t> counts(num_chunks * kNumDigits);
+    uint64_t* source = values.data();
+    uint64_t* target = buffer.data();
+    auto GetBegin = [&](size_t chunk) { return size * chunk / num_chunks; };
+    for (size_t shift = low_bit; shift < 64; shift += kDigitBits) {
+        // Locals, the counts could alias what is captured by reference.
+        run(num_chunks, [&, source, shift](size_t chunk) {
+            size_t* chunk_counts = counts.data() + chunk * kNumDigits;
+            std::fill(chunk_counts, chunk_counts + kNumDigits, 0);
+            const size_t end = GetBegin(chunk + 1);
+            for (size_t i = GetBegin(chunk); i < end; ++i) {
+                chunk_counts[(source[i] >> shift) & (kNumDigits - 1)]++;
+            }
+        });
+        // A digit shared by all values, e.g. the high bits of small keys, leaves the order as it is.
+        bool is_shared = false;
+        for (size_t digit = 0; digit < kNumDigits && !is_shared; ++digit) {
+            size_t count = 0;
+            for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+                count += counts[chunk * kNumDigits + digit];
+            }
+            is_shared = count == size;
+        }
+        if (is_shared) {
+            continue;
+        }
+        size_t offset = 0;
+        for (size_t digit = 0; digit < kNumDigits; ++digit) {
+            for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+                offset += std::exchange(counts[chunk * kNumDigits + digit], offset);
+            }
+        }
+        run(num_chunks, [&, source, target, shift](size_t chunk) {
+            size_t* offsets = counts.data() + chunk * kNumDigits;
+            const size_t end = GetBegin(chunk + 1);
+            for (size_t i = GetBegin(chunk); i < end; ++i) {
+                const uint64_t value = source[i];
+                target[offsets[(value >> shift) & (kNumDigits - 1)]++] = value;
+            }
+        });
+        std::swap(source, target);
+    }
+    if (source != values.data()) {
+        run(num_chunks, [&](size_t chunk) {
+            std::copy(source + GetBegin(chunk), source + GetBegin(chunk + 1), values.data() + GetBegin(chunk));
+        });
+    }
+}
+
+/**
+ * @brief Sorts 64-bit values by their bits from low_bit on with a least significant digit radix sort. Every pass
+ * counts the values of every 11-bit digit and scatters them in order of digit, so the sort takes O(n) per pass and is
+ * stable: values equal in the sorted bits keep their order. Passes over a digit all values share are skipped.
+ *
+ * @param values The values to sort.
+ * @param buffer The scratch memory of values.size() values.
+ * @param low_bit The lowest bit sorted by, in [0, 64).
+ */
+inline void SortByRadix(std::span<uint64_t> values, std::span<uint64_t> buffer, size_t low_bit) {
+    SortByRadixInChunks(values, buffer, low_bit, 1, SequentialRunner{});
+}
+
+/**
+ * @brief Sorts 64-bit values by their bits from low_bit on like SortByRadix, on several threads. Every thread counts
+ * and scatters a contiguous chunk of the values, into the ranges the prefix sums over all chunks give it.
+ *
+ * @param values The values to sort.
+ * @param buffer The scratch memory of values.size() values.
+ * @param low_bit The lowest bit sorted by, in [0, 64).
+ * @param thread_pool The threads to run on.
+ */
+inline void SortByRadix(std::span<uint64_t> values, std::span<uint64_t> buffer, size_t low_bit,
+                        euclid::util::ThreadPool& thread_pool) {
+    SortByRadixInChunks(values, buffer, low_bit, ThreadPoolRunner::GetNumChunks(values.size(), thread_pool),
+                        ThreadPoolRunner{thread_pool});
+}
+
+/**
+ * @brief The keys of points sorted along a space-filling curve, see GetSpatialOrder.
+ */
+template <typename Run>
+inline std::vector<uint64_t> GetSortedSpatialKeys(std::span<const geometry::Point2D> points, SpaceFillingCurve curve,
+                                                  size_t num_chunks, Run&& run) {
+    const size_t size = points.size();
+    auto GetChunk = [&](size_t chunk) {
+        return points.subspan(size * chunk / num_chunks, size * (chunk + 1) / num_chunks - size * chunk / num_chunks);
+    };
+    std::vector<SpatialGrid> chunk_grids(num_chunks);
+    run(num_chunks, [&](size_t chunk) { chunk_grids[chunk].Add(GetChunk(chunk)); });
+    SpatialGrid grid;
+    for (const auto& chunk_grid : chunk_grids) {
+        grid.Add(chunk_grid);
+    }
+    std::vector<uint64_t> keys(size);
+    run(num_chunks, [&](size_t chunk) {
+        const size_t begin = size * chunk / num_chunks;
+        GetSpatialKeys(GetChunk(chunk), grid, curve, static_cast<uint32_t>(begin), keys.data() + begin);
+    });
+    std::vector<uint64_t> buffer(size);
+    SortByRadixInChunks(std::span<uint64_t>(keys), buffer, 32, num_chunks, run);
+    return keys;
+}
+
+/**
+ * @brief Gets the order of points along a space-filling curve through the bounding box of the points, in O(n).
+ *
+ * The box is divided into 2^16 x 2^16 square cells, the positions of the cells of the points along the curve are
+ * computed without branches by GetSpatialKeys, and the points are sorted by them with SortByRadix in three passes,
+ * points in the same cell by index. Consecutive points in this order are mostly close in the plane, so
+ * algorithms visiting them in it, e.g. inserting them into a triangulation, walk short distances and hit the caches.
+ * The Hilbert curve keeps locality better, the Morton curve is cheaper to compute.
+ *
+ * @param points The points, fewer than 2^32 with finite coordinates.
+ * @param curve The space-filling curve.
+ * @return The indices of the points in order along the curve.
+ */
+inline std::vector<uint32_t> GetSpatialOrder(std::span<const geometry::Point2D> points,
+                                             SpaceFillingCurve curve = SpaceFillingCurve::kHilbert) {
+    auto keys = GetSortedSpatialKeys(points, curve, 1, SequentialRunner{});
+    return std::vector<uint32_t>(keys.begin(), keys.end());
+}
+
+/**
+ * @brief Gets the order of points along a space-filling curve like GetSpatialOrder, on several threads. The result is
+ * the same.
+ *
+ * @param points The points, fewer than 2^32 with finite coordinates.
+ * @param curve The space-filling curve.
+ * @param thread_pool The threads to run on.
+ * @return The indices of the points in order along the curve.
+ */
+inline std::vector<uint32_t> GetSpatialOrder(std::span<const geometry::Point2D> points, SpaceFillingCurve curve,
+                                             euclid::util::ThreadPool& thread_pool) {
+    const size_t num_chunks = ThreadPoolRunner::GetNumChunks(points.size(), thread_pool);
+    ThreadPoolRunner run{thread_pool};
+    auto keys = GetSortedSpatialKeys(points, curve, num_chunks, run);
+    std::vector<uint32_t> order(keys.size());
+    run(num_chunks, [&](size_t chunk) {
+        for (size_t i = keys.size() * chunk / num_chunks; i < keys.size() * (chunk + 1) / num_chunks; ++i) {
+            order[i] = static_cast<uint32_t>(keys[i]);
+        }
+    });
+    return order;
+}
+
+/**
+ * @brief Reorders points along a space-filling curve, see GetSpatialOrder.
+ *
+ * @param points The points, fewer than 2^32 with finite coordinates.
+ * @param curve The space-filling curve.
+ */
+inline void SortBySpatialOrder(std::vector<geometry::Point2D>& points,
+                               SpaceFillingCurve curve = SpaceFillingCurve::kHilbert) {
+    auto keys = GetSortedSpatialKeys(points, curve, 1, SequentialRunner{});
+    std::vector<geometry::Point2D> sorted_points(points.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        sorted_points[i] = points[static_cast<uint32_t>(keys[i])];
+    }
+    points.swap(sorted_points);
+}
+
+/**
+ * @brief Reorders points along a space-filling curve like SortBySpatialOrder, on several threads.
+ *
+ * @param points The points, fewer than 2^32 with finite coordinates.
+ * @param curve The space-filling curve.
+ * @param thread_pool The threads to run on.
+ */
+inline void SortBySpatialOrder(std::vector<geometry::Point2D>& points, SpaceFillingCurve curve,
+                               euclid::util::ThreadPool& thread_pool) {
+    const size_t num_chunks = ThreadPoolRunner::GetNumChunks(points.size(), thread_pool);
+    ThreadPoolRunner run{thread_pool};
+    auto keys = GetSortedSpatialKeys(points, curve, num_chunks, run);
+    std::vector<geometry::Point2D> sorted_points(points.size());
+    run(num_chunks, [&](size_t chunk) {
+        for (size_t i = keys.size() * chunk / num_chunks; i < keys.size() * (chunk + 1) / num_chunks; ++i) {
+            sorted_points[i] = points[static_cast<uint32_t>(keys[i])];
+        }
+    });
+    points.swap(sorted_points);
+}
+
 }  // namespace euclid::algorithm::util
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @file box_2d.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include "geometry/point_2d.h"
+
+namespace euclid::geometry {
+
+/**
+ * @brief An axis-aligned box, the points with coordinates between those of its corners, both included.
+ */
+template <typename T>
+struct BasicBox2D {
+    BasicPoint2D<T> min_corner;
+    BasicPoint2D<T> max_corner;
+};
+
+using Box2D = BasicBox2D<double>;
+
+}  // namespace euclid::geometry
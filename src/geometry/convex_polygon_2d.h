@@ -0,0 +1,272 @@
+#pragma once
+
+/**
+ * @file convex_polygon_2d.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "algorithm/util/batch_location.h"
+#include "algorithm/util/predicates.h"
+#include "geometry/point_2d.h"
+#include "util/aligned_allocator.h"
+#include "util/compare.h"
+#include "util/simd.h"
+
+namespace euclid::geometry {
+
+/**
+ * @brief A convex polygon answering point containment in O(log n), e.g. built from the vertices a hull function
+ * returns.
+ *
+ * The diagonals from the first vertex split the polygon into a fan of triangles. A point inside the wedge of the first
+ * vertex lies in the triangle whose wedge contains it, found by a binary search over the diagonals, and is inside the
+ * polygon if it is left of or on the edge opposite the first vertex. Every query makes about log2(n) + 3 orientation
+ * tests instead of the n tests of checking every edge or triangle of the fan.
+ *
+ * @tparam T The coordinate type.
+ */
+template <typename T>
+class BasicConvexPolygon2D {
+public:
+    using Point = BasicPoint2D<T>;
+
+    BasicConvexPolygon2D() = default;
+
+    /**
+     * @param vertices The vertices in counter-clockwise order, as returned by the convex hull functions. Fewer than 3
+     * vertices make an empty polygon containing no point.
+     */
+    explicit BasicConvexPolygon2D(std::vector<Point> vertices) : vertices_(std::move(vertices)) {
+        if constexpr (std::is_same_v<T, double>) {
+            if (vertices_.size() >= 3) {
+                BuildWedges();
+            }
+        }
+    }
+
+    const std::vector<Point>& Vertices() const { return vertices_; }
+
+    size_t Size() const { return vertices_.size(); }
+
+    bool Empty() const { return vertices_.size() < 3; }
+
+    /**
+     * @brief Checks if a point lies inside the polygon or on its boundary, in O(log n).
+     *
+     * @tparam Predicates The predicate policy, algorithm::util::TolerancePredicates or
+     * algorithm::util::AdaptivePredicates.
+     * @param point The point to check.
+     * @return true if the point is inside the polygon or on its boundary, false otherwise or if the polygon is empty.
+     */
+    template <typename Predicates = algorithm::util::TolerancePredicates>
+    bool Contains(const Point& point) const {
+        if (Empty()) {
+            return false;
+        }
+        const Point& origin = vertices_[0];
+        if (Predicates::GetOrientation(origin, vertices_[1], point) < 0 ||
+            Predicates::GetOrientation(origin, vertices_.back(), point) > 0) {
+            return false;
+        }
+        size_t index = 1;
+        for (size_t size = vertices_.size() - 2; size > 1;) {
+            size_t half = size / 2;
+            if (Predicates::GetOrientation(origin, vertices_[index + half], point) >= 0) {
+                index += half;
+            }
+            size -= half;
+        }
+        return Predicates::GetOrientation(vertices_[index], vertices_[index + 1], point) >= 0;
+    }
+
+    /**
+     * @brief Batch form of Contains.
+     *
+     * For double coordinates and algorithm::util::TolerancePredicates the binary searches of several points run in
+     * lockstep on AVX2, evaluating the cross products with the same operations in the same order as the scalar
+     * Contains, so both agree bit for bit.
+     *
+     * @tparam Predicates The predicate policy, algorithm::util::TolerancePredicates or
+     * algorithm::util::AdaptivePredicates.
+     * @param points The points to check.
+     * @param mask Receives algorithm::util::GetNumMaskWords(points.size()) words, bit i is set if points[i] is inside
+     * the polygon or on its boundary.
+     */
+    template <typename Predicates = algorithm::util::TolerancePredicates>
+    void Contains(std::span<const Point> points, uint64_t* mask) const {
+        const size_t num_words = algorithm::util::GetNumMaskWords(points.size());
+        constexpr bool kHasWedges =
+            std::is_same_v<T, double> && std::is_same_v<Predicates, algorithm::util::TolerancePredicates>;
+        size_t begin = 0;
+#if defined(EUCLID_X86_64)
+        if constexpr (kHasWedges) {
+            if (!Empty() && util::GetSimdLevel() >= util::SimdLevel::kAvx2) {
+                begin = ContainsAvx2(points, mask);
+            }
+        }
+#endif
+        std::fill(mask + begin / 64, mask + num_words, uint64_t{0});
+        for (size_t i = begin; i < points.size(); ++i) {
+            bool is_contained;
+            if constexpr (kHasWedges) {
+                is_contained = !Empty() && ContainsByWedges(points[i]);
+            } else {
+                is_contained = Contains<Predicates>(points[i]);
+            }
+            mask[i / 64] |= static_cast<uint64_t>(is_contained) << (i % 64);
+        }
+    }
+
+private:
+    using AlignedVector = std::vector<double, util::AlignedAllocator<double, 64>>;
+
+    /**
+     * @brief Splits the coordinates into arrays and precomputes the point-independent products of the cross products
+     * of the diagonals and edges, in the operation order of algorithm::util::GetCrossValue.
+     */
+    void BuildWedges() {
+        const size_t size = vertices_.size();
+        xs_.resize(size);
+        ys_.resize(size);
+        diagonal_constants_.resize(size);
+        edge_constants_.resize(size);
+        const Point& origin = vertices_[0];
+        for (size_t i = 0; i < size; ++i) {
+            const Point& vertex = vertices_[i];
+            const Point& next = vertices_[(i + 1) % size];
+            xs_[i] = vertex.coords[0];
+            ys_[i] = vertex.coords[1];
+            diagonal_constants_[i] = origin.coords[0] * vertex.coords[1] - origin.coords[1] * vertex.coords[0];
+            edge_constants_[i] = vertex.coords[0] * next.coords[1] - vertex.coords[1] * next.coords[0];
+        }
+    }
+
+    /**
+     * @brief Contains for double coordinates and algorithm::util::TolerancePredicates on the precomputed arrays.
+     */
+    bool ContainsByWedges(const Point& point) const {
+        const double x = point.coords[0];
+        const double y = point.coords[1];
+        const double origin_x = xs_[0];
+        const double origin_y = ys_[0];
+        // GetOrientation(origin, vertices_[i], point) >= 0
+        auto IsLeftOrOnDiagonal = [&](size_t i) {
+            double cross_value = diagonal_constants_[i] + xs_[i] * y - ys_[i] * x + x * origin_y - y * origin_x;
+            return !util::Less(cross_value, 0.0);
+        };
+        const size_t last = vertices_.size() - 1;
+        double last_cross_value = diagonal_constants_[last] + xs_[last] * y - ys_[last] * x + x * origin_y -
+                                  y * origin_x;
+        if (!IsLeftOrOnDiagonal(1) || util::Greater(last_cross_value, 0.0)) {
+            return false;
+        }
+        size_t index = 1;
+        for (size_t size = last - 1; size > 1;) {
+            size_t half = size / 2;
+            index = IsLeftOrOnDiagonal(index + half) ? index + half : index;
+            size -= half;
+        }
+        double cross_value = edge_constants_[index] + xs_[index + 1] * y - ys_[index + 1] * x + x * ys_[index] -
+                             y * xs_[index];
+        return !util::Less(cross_value, 0.0);
+    }
+
+#if defined(EUCLID_X86_64)
+    /**
+     * @brief The cross product of p, q and the points r, from the constant term p.x * q.y - p.y * q.x on, in the
+     * operation order of algorithm::util::GetCrossValue.
+     */
+    EUCLID_TARGET_AVX2 static __m256d GetCrossValueAvx2(__m256d constant, __m256d qx, __m256d qy, __m256d px,
+                                                        __m256d py, __m256d rx, __m256d ry) {
+        __m256d cross_value = _mm256_add_pd(constant, _mm256_mul_pd(qx, ry));
+        cross_value = _mm256_sub_pd(cross_value, _mm256_mul_pd(qy, rx));
+        cross_value = _mm256_add_pd(cross_value, _mm256_mul_pd(rx, py));
+        return _mm256_sub_pd(cross_value, _mm256_mul_pd(ry, px));
+    }
+
+    /**
+     * @brief Vectorized ContainsByWedges for the full mask words of the points, 4 binary searches in lockstep with
+     * the vertices gathered per lane.
+     *
+     * @return The number of points checked, a multiple of 64.
+     */
+    EUCLID_TARGET_AVX2 size_t ContainsAvx2(std::span<const Point> points, uint64_t* mask) const {
+        const double* coords = reinterpret_cast<const double*>(points.data());
+        const size_t last = vertices_.size() - 1;
+        const __m256d origin_x = _mm256_set1_pd(xs_[0]);
+        const __m256d origin_y = _mm256_set1_pd(ys_[0]);
+        const __m256d first_x = _mm256_set1_pd(xs_[1]);
+        const __m256d first_y = _mm256_set1_pd(ys_[1]);
+        const __m256d first_constant = _mm256_set1_pd(diagonal_constants_[1]);
+        const __m256d last_x = _mm256_set1_pd(xs_[last]);
+        const __m256d last_y = _mm256_set1_pd(ys_[last]);
+        const __m256d last_constant = _mm256_set1_pd(diagonal_constants_[last]);
+        // Less(cross, 0): cross < 0 - eps, Greater(cross, 0): cross > 0 + eps
+        const __m256d lower = _mm256_set1_pd(0.0 - util::kDefaultTolerance);
+        const __m256d upper = _mm256_set1_pd(0.0 + util::kDefaultTolerance);
+        const __m256i one = _mm256_set1_epi64x(1);
+        const size_t num_full_words = points.size() / 64;
+        for (size_t word = 0; word < num_full_words; ++word) {
+            uint64_t contains_word = 0;
+            for (size_t j = 0; j < 64; j += 4) {
+                // x0 y0 x1 y1 | x2 y2 x3 y3 -> x0 x1 x2 x3, y0 y1 y2 y3
+                const double* source = coords + 2 * (word * 64 + j);
+                __m256d low = _mm256_loadu_pd(source);
+                __m256d high = _mm256_loadu_pd(source + 4);
+                __m256d x = _mm256_permute4x64_pd(_mm256_unpacklo_pd(low, high), 0xd8);
+                __m256d y = _mm256_permute4x64_pd(_mm256_unpackhi_pd(low, high), 0xd8);
+
+                __m256d first_cross_value =
+                    GetCrossValueAvx2(first_constant, first_x, first_y, origin_x, origin_y, x, y);
+                __m256d last_cross_value =
+                    GetCrossValueAvx2(last_constant, last_x, last_y, origin_x, origin_y, x, y);
+                __m256d in_wedge = _mm256_andnot_pd(_mm256_cmp_pd(first_cross_value, lower, _CMP_LT_OQ),
+                                                    _mm256_cmp_pd(last_cross_value, upper, _CMP_NGT_UQ));
+
+                __m256i index = one;
+                for (size_t size = last - 1; size > 1;) {
+                    size_t half = size / 2;
+                    __m256i candidate = _mm256_add_epi64(index, _mm256_set1_epi64x(static_cast<int64_t>(half)));
+                    __m256d cross_value = GetCrossValueAvx2(
+                        _mm256_i64gather_pd(diagonal_constants_.data(), candidate, 8),
+                        _mm256_i64gather_pd(xs_.data(), candidate, 8), _mm256_i64gather_pd(ys_.data(), candidate, 8),
+                        origin_x, origin_y, x, y);
+                    __m256i is_left_or_on = _mm256_castpd_si256(_mm256_cmp_pd(cross_value, lower, _CMP_NLT_UQ));
+                    index = _mm256_blendv_epi8(index, candidate, is_left_or_on);
+                    size -= half;
+                }
+                __m256i next = _mm256_add_epi64(index, one);
+                __m256d edge_cross_value = GetCrossValueAvx2(
+                    _mm256_i64gather_pd(edge_constants_.data(), index, 8), _mm256_i64gather_pd(xs_.data(), next, 8),
+                    _mm256_i64gather_pd(ys_.data(), next, 8), _mm256_i64gather_pd(xs_.data(), index, 8),
+                    _mm256_i64gather_pd(ys_.data(), index, 8), x, y);
+                __m256d contains = _mm256_and_pd(in_wedge, _mm256_cmp_pd(edge_cross_value, lower, _CMP_NLT_UQ));
+                contains_word |= static_cast<uint64_t>(_mm256_movemask_pd(contains)) << j;
+            }
+            mask[word] = contains_word;
+        }
+        return num_full_words * 64;
+    }
+#endif
+
+    std::vector<Point> vertices_;
+    // The coordinates and the constant terms of the cross products of the diagonal to and the edge from every vertex,
+    // for double coordinates only.
+    AlignedVector xs_;
+    AlignedVector ys_;
+    AlignedVector diagonal_constants_;
+    AlignedVector edge_constants_;
+};
+
+using ConvexPolygon2D = BasicConvexPolygon2D<double>;
+
+}  // namespace euclid::geometry
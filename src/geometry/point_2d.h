@@ -6,15 +6,26 @@
  * @date 2025-09-01
  */
 
+#include <cmath>
+
 #include "util/compare.h"
+#include "util/scalar_traits.h"
 
 namespace euclid::geometry {
 
-struct Point2D {
-    double coords[2] = {0.0, 0.0};
+/**
+ * @brief A point with coordinates of type T: float, double, int32_t or int64_t.
+ *
+ * Floating-point points compare with the tolerance of util::Equal, integer points compare exactly.
+ */
+template <typename T>
+struct BasicPoint2D {
+    using Scalar = T;
+
+    T coords[2] = {T{0}, T{0}};
 
     // Lexicographical comparison: first by y-coordinate, then by x-coordinate
-    bool operator<(const Point2D& other) const {
+    bool operator<(const BasicPoint2D& other) const {
         if (util::Less(coords[1], other.coords[1])) {
             return true;
         } else if (util::Equal(coords[1], other.coords[1])) {
@@ -23,12 +34,21 @@ struct Point2D {
         return false;
     }
 
-    bool operator==(const Point2D& other) const { return util::Equal(this->Distance(other), 0.0); }
+    bool operator==(const BasicPoint2D& other) const {
+        if constexpr (util::ScalarTraits<T>::kIsExact) {
+            return coords[0] == other.coords[0] && coords[1] == other.coords[1];
+        } else {
+            return util::Equal(this->Distance(other), 0.0);
+        }
+    }
 
-    double Distance(const Point2D& other) const {
-        return std::sqrt((coords[0] - other.coords[0]) * (coords[0] - other.coords[0]) +
-                         (coords[1] - other.coords[1]) * (coords[1] - other.coords[1]));
+    double Distance(const BasicPoint2D& other) const {
+        auto dx = static_cast<double>(coords[0]) - static_cast<double>(other.coords[0]);
+        auto dy = static_cast<double>(coords[1]) - static_cast<double>(other.coords[1]);
+        return std::sqrt(dx * dx + dy * dy);
     }
 };
 
-}  // namespace euclid::geometry
\ No newline at end of file
+using Point2D = BasicPoint2D<double>;
+
+}  // namespace euclid::geometry
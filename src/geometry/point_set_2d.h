@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file point_set_2d.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/point_2d.h"
+#include "util/aligned_allocator.h"
+
+namespace euclid::geometry {
+
+/**
+ * @brief Structure-of-arrays point container: all x-coordinates in one cache-line aligned array, all y-coordinates in
+ * another, so that batch predicates can load several coordinates per instruction.
+ */
+class PointSet2D {
+public:
+    static constexpr size_t kAlignment = 64;
+
+    PointSet2D() = default;
+
+    explicit PointSet2D(const std::vector<Point2D>& points) {
+        Reserve(points.size());
+        for (const auto& point : points) {
+            PushBack(point);
+        }
+    }
+
+    size_t Size() const { return xs_.size(); }
+
+    bool Empty() const { return xs_.empty(); }
+
+    void Reserve(size_t size) {
+        xs_.reserve(size);
+        ys_.reserve(size);
+    }
+
+    void Clear() {
+        xs_.clear();
+        ys_.clear();
+    }
+
+    void PushBack(const Point2D& point) {
+        xs_.push_back(point.coords[0]);
+        ys_.push_back(point.coords[1]);
+    }
+
+    Point2D operator[](size_t index) const { return {xs_[index], ys_[index]}; }
+
+    const double* X() const { return xs_.data(); }
+
+    const double* Y() const { return ys_.data(); }
+
+    double* X() { return xs_.data(); }
+
+    double* Y() { return ys_.data(); }
+
+    std::vector<Point2D> ToPoints() const {
+        std::vector<Point2D> points(Size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            points[i] = (*this)[i];
+        }
+        return points;
+    }
+
+private:
+    std::vector<double, util::AlignedAllocator<double, kAlignment>> xs_;
+    std::vector<double, util::AlignedAllocator<double, kAlignment>> ys_;
+};
+
+}  // namespace euclid::geometry
@@ -0,0 +1,23 @@
+#pragma once
+
+/**
+ * @file rectangle_2d.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include "geometry/point_2d.h"
+
+namespace euclid::geometry {
+
+/**
+ * @brief A rectangle of any orientation, its vertices in counter-clockwise order.
+ */
+template <typename T>
+struct BasicRectangle2D {
+    BasicPoint2D<T> vertices[4];
+};
+
+using Rectangle2D = BasicRectangle2D<double>;
+
+}  // namespace euclid::geometry
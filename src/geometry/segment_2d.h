@@ -0,0 +1,23 @@
+#pragma once
+
+/**
+ * @file segment_2d.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include "geometry/point_2d.h"
+
+namespace euclid::geometry {
+
+/**
+ * @brief A line segment, the points between its endpoints, both included. The endpoints may coincide.
+ */
+template <typename T>
+struct BasicSegment2D {
+    BasicPoint2D<T> endpoints[2];
+};
+
+using Segment2D = BasicSegment2D<double>;
+
+}  // namespace euclid::geometry
@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * @file strided_point_span_2d.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cstddef>
+
+#include "geometry/point_2d.h"
+
+namespace euclid::geometry {
+
+/**
+ * @brief Non-owning view of points stored as two coordinate members of caller records, e.g. the x and y fields of an
+ * array of structs, so that the points can be read without copying the records into Point2D first.
+ *
+ * The i-th point is read from x + i * stride and y + i * stride, with stride in bytes.
+ */
+template <typename T>
+class BasicStridedPointSpan2D {
+public:
+    BasicStridedPointSpan2D() = default;
+
+    /**
+     * @param x The x-coordinate of the first point.
+     * @param y The y-coordinate of the first point.
+     * @param size The number of points.
+     * @param stride The distance in bytes between the coordinates of consecutive points.
+     */
+    BasicStridedPointSpan2D(const T* x, const T* y, size_t size, size_t stride)
+        : x_(reinterpret_cast<const std::byte*>(x)),
+          y_(reinterpret_cast<const std::byte*>(y)),
+          size_(size),
+          stride_(stride) {}
+
+    /**
+     * @param records The records holding the points.
+     * @param size The number of records.
+     * @param x The member holding the x-coordinate.
+     * @param y The member holding the y-coordinate.
+     */
+    template <typename Record>
+    BasicStridedPointSpan2D(const Record* records, size_t size, T Record::*x, T Record::*y)
+        : x_(size == 0 ? nullptr : reinterpret_cast<const std::byte*>(&(records->*x))),
+          y_(size == 0 ? nullptr : reinterpret_cast<const std::byte*>(&(records->*y))),
+          size_(size),
+          stride_(sizeof(Record)) {}
+
+    size_t Size() const { return size_; }
+
+    bool Empty() const { return size_ == 0; }
+
+    BasicPoint2D<T> operator[](size_t index) const {
+        return {*reinterpret_cast<const T*>(x_ + index * stride_), *reinterpret_cast<const T*>(y_ + index * stride_)};
+    }
+
+private:
+    const std::byte* x_ = nullptr;
+    const std::byte* y_ = nullptr;
+    size_t size_ = 0;
+    size_t stride_ = 0;
+};
+
+using StridedPointSpan2D = BasicStridedPointSpan2D<double>;
+
+}  // namespace euclid::geometry
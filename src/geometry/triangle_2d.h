@@ -10,8 +10,11 @@
 
 namespace euclid::geometry {
 
-struct Triangle2D {
-    Point2D vertices[3];
+template <typename T>
+struct BasicTriangle2D {
+    BasicPoint2D<T> vertices[3];
 };
 
+using Triangle2D = BasicTriangle2D<double>;
+
 }  // namespace euclid::geometry
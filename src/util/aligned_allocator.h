@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @file aligned_allocator.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cstddef>
+#include <new>
+
+namespace euclid::util {
+
+/**
+ * @brief Allocator returning storage aligned to Alignment bytes, e.g. to a cache line for vectorized kernels.
+ */
+template <typename T, size_t Alignment>
+struct AlignedAllocator {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "invalid alignment");
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    T* allocate(size_t size) { return static_cast<T*>(::operator new(size * sizeof(T), std::align_val_t{Alignment})); }
+
+    void deallocate(T* pointer, size_t size) noexcept {
+        ::operator delete(pointer, size * sizeof(T), std::align_val_t{Alignment});
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+};
+
+}  // namespace euclid::util
@@ -8,56 +8,126 @@
 
 #include <cmath>
 
+#include "util/scalar_traits.h"
+
 namespace euclid::util {
 
 /**
- * @brief Compare two floating-point numbers for equality within a specified tolerance.
+ * @brief Default tolerance of the floating-point comparisons.
+ */
+inline constexpr double kDefaultTolerance = 1e-6;
+
+/**
+ * @brief Default tolerance of the comparisons of type T, zero for exact types.
+ */
+template <typename T>
+inline constexpr T kTolerance = ScalarTraits<T>::kIsExact ? T{0} : static_cast<T>(kDefaultTolerance);
+
+/**
+ * @brief Compare two numbers for equality within a specified tolerance. Exact types are compared exactly and the
+ * tolerance is ignored.
  *
- * @param a First floating-point number.
- * @param b Second floating-point number.
+ * @param a First number.
+ * @param b Second number.
  * @param eps Tolerance for comparison (default is 1e-6).
  * @return true if the numbers are considered equal within the tolerance, false otherwise.
  */
-inline bool Equal(double a, double b, double eps = 1e-6) { return std::abs(a - b) < eps; }
+template <typename T>
+inline bool Equal(T a, T b, T eps = kTolerance<T>) {
+    if constexpr (ScalarTraits<T>::kIsExact) {
+        return a == b;
+    } else {
+        return std::abs(a - b) < eps;
+    }
+}
 
 /**
- * @brief Compare two floating-point numbers for less-than within a specified tolerance.
+ * @brief Compare two numbers for less-than within a specified tolerance. Exact types are compared exactly and the
+ * tolerance is ignored.
  *
- * @param a First floating-point number.
- * @param b Second floating-point number.
+ * @param a First number.
+ * @param b Second number.
  * @param eps Tolerance for comparison (default is 1e-6).
  * @return true if a is less than b considering the tolerance, false otherwise.
  */
-inline bool Less(double a, double b, double eps = 1e-6) { return a < b - eps; }
+template <typename T>
+inline bool Less(T a, T b, T eps = kTolerance<T>) {
+    if constexpr (ScalarTraits<T>::kIsExact) {
+        return a < b;
+    } else {
+        return a < b - eps;
+    }
+}
 
 /**
- * @brief Compare two floating-point numbers for greater-than within a specified tolerance.
+ * @brief Compare two numbers for greater-than within a specified tolerance. Exact types are compared exactly and the
+ * tolerance is ignored.
  *
- * @param a First floating-point number.
- * @param b Second floating-point number.
+ * @param a First number.
+ * @param b Second number.
  * @param eps Tolerance for comparison (default is 1e-6).
  * @return true if a is greater than b considering the tolerance, false otherwise.
  */
-inline bool Greater(double a, double b, double eps = 1e-6) { return a > b + eps; }
+template <typename T>
+inline bool Greater(T a, T b, T eps = kTolerance<T>) {
+    if constexpr (ScalarTraits<T>::kIsExact) {
+        return a > b;
+    } else {
+        return a > b + eps;
+    }
+}
 
 /**
- * @brief Compare two floating-point numbers for less-than-or-equal within a specified tolerance.
+ * @brief Compare two numbers for less-than-or-equal within a specified tolerance.
  *
- * @param a First floating-point number.
- * @param b Second floating-point number.
+ * @param a First number.
+ * @param b Second number.
  * @param eps Tolerance for comparison (default is 1e-6).
  * @return true if a is less than or equal to b considering the tolerance, false otherwise
  */
-inline bool LessEqual(double a, double b, double eps = 1e-6) { return Less(a, b, eps) || Equal(a, b, eps); }
+template <typename T>
+inline bool LessEqual(T a, T b, T eps = kTolerance<T>) {
+    return Less(a, b, eps) || Equal(a, b, eps);
+}
 
 /**
- * @brief Compare two floating-point numbers for greater-than-or-equal within a specified tolerance.
+ * @brief Compare two numbers for greater-than-or-equal within a specified tolerance.
  *
- * @param a First floating-point number.
- * @param b Second floating-point number.
+ * @param a First number.
+ * @param b Second number.
  * @param eps Tolerance for comparison (default is 1e-6).
  * @return true if a is greater than or equal to b considering the tolerance, false otherwise.
  */
-inline bool GreaterEqual(double a, double b, double eps = 1e-6) { return Greater(a, b, eps) || Equal(a, b, eps); }
+template <typename T>
+inline bool GreaterEqual(T a, T b, T eps = kTolerance<T>) {
+    return Greater(a, b, eps) || Equal(a, b, eps);
+}
+
+/**
+ * @brief Compares two doubles for equality within a tolerance, also for arguments of mixed types, e.g. Equal(x, 0).
+ */
+inline bool Equal(double a, double b, double eps = kDefaultTolerance) { return Equal<double>(a, b, eps); }
+
+/**
+ * @brief Compares two doubles for less-than within a tolerance, also for arguments of mixed types.
+ */
+inline bool Less(double a, double b, double eps = kDefaultTolerance) { return Less<double>(a, b, eps); }
+
+/**
+ * @brief Compares two doubles for greater-than within a tolerance, also for arguments of mixed types.
+ */
+inline bool Greater(double a, double b, double eps = kDefaultTolerance) { return Greater<double>(a, b, eps); }
+
+/**
+ * @brief Compares two doubles for less-than-or-equal within a tolerance, also for arguments of mixed types.
+ */
+inline bool LessEqual(double a, double b, double eps = kDefaultTolerance) { return LessEqual<double>(a, b, eps); }
+
+/**
+ * @brief Compares two doubles for greater-than-or-equal within a tolerance, also for arguments of mixed types.
+ */
+inline bool GreaterEqual(double a, double b, double eps = kDefaultTolerance) {
+    return GreaterEqual<double>(a, b, eps);
+}
 
 }  // namespace euclid::util
@@ -0,0 +1,241 @@
+#pragma once
+
+/**
+ * @file instrumentation.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace euclid::util {
+
+/**
+ * @brief Whether the hull algorithms record HullStats, set by the EUCLID_ENABLE_INSTRUMENTATION CMake option, which
+ * defines EUCLID_INSTRUMENTATION. When false, every hook below compiles to nothing. All translation units of a program
+ * must agree on it.
+ */
+#if defined(EUCLID_INSTRUMENTATION)
+inline constexpr bool kInstrumentationEnabled = true;
+#else
+inline constexpr bool kInstrumentationEnabled = false;
+#endif
+
+/**
+ * @brief The phases of a hull computation that are timed separately.
+ */
+enum class HullPhase : size_t {
+    // Removing coincident points.
+    kRemoveCoincidePoints,
+    // Sorting the points or the hull vertices.
+    kSort,
+    // Discarding points that cannot be hull vertices, e.g. the octagon of Quickhull.
+    kFilter,
+    // Building the hull from the prepared points: chains, stack, recursion or wrapping.
+    kScan,
+    // Merging partial hulls, e.g. the chunk hulls of the parallel hull.
+    kMerge,
+    kNumPhases,
+};
+
+inline constexpr size_t kNumHullPhases = static_cast<size_t>(HullPhase::kNumPhases);
+
+/**
+ * @brief The name of a phase, for exporting.
+ */
+inline const char* GetHullPhaseName(HullPhase phase) {
+    constexpr const char* kNames[kNumHullPhases] = {"remove_coincide_points", "sort", "filter", "scan", "merge"};
+    return kNames[static_cast<size_t>(phase)];
+}
+
+/**
+ * @brief What the last hull call of a thread spent its time on.
+ *
+ * Calls of predicates, comparators and allocations count on the thread that makes them, so the batch and parallel
+ * hulls only report the share of the calling thread, the worker threads report theirs separately.
+ */
+struct HullStats {
+    // The outermost hull algorithm, e.g. "quick_hull", null before the first call.
+    const char* algorithm = nullptr;
+    uint64_t turn_left_calls = 0;
+    uint64_t turn_left_or_on_ray_calls = 0;
+    uint64_t collinear_calls = 0;
+    uint64_t on_segment_calls = 0;
+    uint64_t point_in_triangle_calls = 0;
+    uint64_t orientation_calls = 0;
+    uint64_t sort_comparisons = 0;
+    uint64_t removed_coincide_points = 0;
+    uint64_t graham_scan_pops = 0;
+    // Allocations through an InstrumentedMemoryResource, e.g. one backing a hull workspace.
+    uint64_t allocations = 0;
+    uint64_t allocated_bytes = 0;
+    std::chrono::nanoseconds phase_times[kNumHullPhases] = {};
+    std::chrono::nanoseconds total_time{0};
+
+    std::chrono::nanoseconds PhaseTime(HullPhase phase) const { return phase_times[static_cast<size_t>(phase)]; }
+};
+
+/**
+ * @brief Receives the stats of every outermost hull call, on the thread that made it.
+ */
+using HullStatsExporter = void (*)(const HullStats& stats);
+
+namespace instrumentation {
+
+inline HullStats& ThreadHullStats() {
+    thread_local HullStats stats;
+    return stats;
+}
+
+inline size_t& ThreadHullCallDepth() {
+    thread_local size_t depth = 0;
+    return depth;
+}
+
+inline std::atomic<HullStatsExporter>& Exporter() {
+    static std::atomic<HullStatsExporter> exporter{nullptr};
+    return exporter;
+}
+
+}  // namespace instrumentation
+
+/**
+ * @brief The stats of the last hull call on this thread, all zero unless kInstrumentationEnabled.
+ */
+inline const HullStats& GetHullStats() {
+    return instrumentation::ThreadHullStats();
+}
+
+inline void ResetHullStats() {
+    instrumentation::ThreadHullStats() = HullStats{};
+}
+
+/**
+ * @brief Installs a function called with the stats at the end of every outermost hull call, or removes it with
+ * nullptr. The function runs on the thread of the call, possibly on several threads at once.
+ */
+inline void SetHullStatsExporter(HullStatsExporter exporter) {
+    instrumentation::Exporter().store(exporter, std::memory_order_release);
+}
+
+/**
+ * @brief Adds to a counter of the HullStats of this thread.
+ */
+inline void CountHullEvent([[maybe_unused]] uint64_t HullStats::*counter, [[maybe_unused]] uint64_t amount = 1) {
+    if constexpr (kInstrumentationEnabled) {
+        instrumentation::ThreadHullStats().*counter += amount;
+    }
+}
+
+/**
+ * @brief Wraps a comparator so that its invocations count as HullStats::sort_comparisons. Returns the comparator
+ * itself when instrumentation is disabled.
+ */
+template <typename Compare>
+auto CountComparisons(Compare compare) {
+    if constexpr (kInstrumentationEnabled) {
+        return [compare](const auto& a, const auto& b) {
+            instrumentation::ThreadHullStats().sort_comparisons++;
+            return compare(a, b);
+        };
+    } else {
+        return compare;
+    }
+}
+
+/**
+ * @brief Marks a hull algorithm call. The outermost one on a thread resets the stats of the thread, measures
+ * HullStats::total_time and hands the stats to the exporter, nested ones, e.g. the Graham scans of Chan's algorithm,
+ * add to the stats of the outer call.
+ */
+class ScopedHullCall {
+public:
+    explicit ScopedHullCall([[maybe_unused]] const char* algorithm) {
+        if constexpr (kInstrumentationEnabled) {
+            if (instrumentation::ThreadHullCallDepth()++ == 0) {
+                ResetHullStats();
+                instrumentation::ThreadHullStats().algorithm = algorithm;
+                start_ = std::chrono::steady_clock::now();
+            }
+        }
+    }
+
+    ~ScopedHullCall() {
+        if constexpr (kInstrumentationEnabled) {
+            if (--instrumentation::ThreadHullCallDepth() == 0) {
+                auto& stats = instrumentation::ThreadHullStats();
+                stats.total_time = std::chrono::steady_clock::now() - start_;
+                if (auto exporter = instrumentation::Exporter().load(std::memory_order_acquire)) {
+                    exporter(stats);
+                }
+            }
+        }
+    }
+
+    ScopedHullCall(const ScopedHullCall&) = delete;
+    ScopedHullCall& operator=(const ScopedHullCall&) = delete;
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Adds the time until the end of the scope to a phase of the HullStats of this thread.
+ */
+class ScopedHullPhase {
+public:
+    explicit ScopedHullPhase([[maybe_unused]] HullPhase phase) {
+        if constexpr (kInstrumentationEnabled) {
+            phase_ = phase;
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedHullPhase() {
+        if constexpr (kInstrumentationEnabled) {
+            instrumentation::ThreadHullStats().phase_times[static_cast<size_t>(phase_)] +=
+                std::chrono::steady_clock::now() - start_;
+        }
+    }
+
+    ScopedHullPhase(const ScopedHullPhase&) = delete;
+    ScopedHullPhase& operator=(const ScopedHullPhase&) = delete;
+
+private:
+    HullPhase phase_ = HullPhase::kScan;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief A memory resource counting the allocations it forwards to its upstream resource as HullStats::allocations
+ * and HullStats::allocated_bytes of the allocating thread. Passed to a hull workspace, it shows how much the buffers
+ * still grow. Forwards without counting when instrumentation is disabled.
+ */
+class InstrumentedMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit InstrumentedMemoryResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : upstream_(upstream) {}
+
+    std::pmr::memory_resource* Upstream() const { return upstream_; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        CountHullEvent(&HullStats::allocations);
+        CountHullEvent(&HullStats::allocated_bytes, bytes);
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+        upstream_->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    std::pmr::memory_resource* upstream_;
+};
+
+}  // namespace euclid::util
@@ -0,0 +1,158 @@
+#pragma once
+
+/**
+ * @file mapped_file.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cstddef>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace euclid::util {
+
+/**
+ * @brief A read-only memory mapping of a whole file, for reading inputs larger than the memory sequentially.
+ *
+ * The pages are read from the file on first access and may be dropped again with Discard once consumed, so the
+ * resident memory stays bounded however large the file is. Like std::ifstream, a failure to open is reported by
+ * IsOpen. An empty file opens with a null Data.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    explicit MappedFile(const char* path) {
+#if defined(_WIN32)
+        file_ = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+                            nullptr);
+        LARGE_INTEGER size;
+        if (file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(file_, &size)) {
+            Close();
+            return;
+        }
+        size_ = static_cast<size_t>(size.QuadPart);
+        if (size_ > 0) {
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            data_ = mapping_ == nullptr ? nullptr : MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+            if (data_ == nullptr) {
+                Close();
+                return;
+            }
+        }
+        is_open_ = true;
+#elif defined(__unix__) || defined(__APPLE__)
+        int file = open(path, O_RDONLY);
+        if (file < 0) {
+            return;
+        }
+        struct stat status;
+        if (fstat(file, &status) == 0) {
+            size_ = static_cast<size_t>(status.st_size);
+            if (size_ == 0) {
+                is_open_ = true;
+            } else if (void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file, 0); data != MAP_FAILED) {
+                data_ = data;
+                is_open_ = true;
+                madvise(data_, size_, MADV_SEQUENTIAL);
+            }
+        }
+        // the mapping keeps the file alive
+        close(file);
+        if (!is_open_) {
+            size_ = 0;
+        }
+#else
+        static_cast<void>(path);
+#endif
+    }
+
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { Swap(other); }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        MappedFile(std::move(other)).Swap(*this);
+        return *this;
+    }
+
+    bool IsOpen() const { return is_open_; }
+
+    const std::byte* Data() const { return static_cast<const std::byte*>(data_); }
+
+    size_t Size() const { return size_; }
+
+    /**
+     * @brief Drops the pages from the one containing begin to the last one ending at or before end from memory, to
+     * be read from the file again if accessed. Meant for bytes already consumed; a no-op where not supported.
+     */
+    void Discard([[maybe_unused]] size_t begin, [[maybe_unused]] size_t end) const {
+#if defined(__unix__) || defined(__APPLE__)
+        const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        begin -= begin % page_size;
+        end = end < size_ ? end - end % page_size : size_;
+        if (data_ != nullptr && begin < end) {
+            madvise(static_cast<std::byte*>(data_) + begin, end - begin, MADV_DONTNEED);
+        }
+#endif
+    }
+
+private:
+    void Close() {
+#if defined(_WIN32)
+        if (data_ != nullptr) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#elif defined(__unix__) || defined(__APPLE__)
+        if (data_ != nullptr) {
+            munmap(data_, size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        is_open_ = false;
+    }
+
+    void Swap(MappedFile& other) noexcept {
+#if defined(_WIN32)
+        std::swap(file_, other.file_);
+        std::swap(mapping_, other.mapping_);
+#endif
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(is_open_, other.is_open_);
+    }
+
+#if defined(_WIN32)
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+    void* data_ = nullptr;
+    size_t size_ = 0;
+    bool is_open_ = false;
+};
+
+}  // namespace euclid::util
@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @file scalar_traits.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <cstdint>
+#include <type_traits>
+
+namespace euclid::util {
+
+/**
+ * @brief Compile-time properties of a coordinate type.
+ *
+ * Accumulator is the type cross and dot products are evaluated in. Floating-point coordinates are compared with a
+ * tolerance, integer coordinates are compared exactly and their products are evaluated in a wider integer type, so
+ * the integer predicates are exact as long as |coordinate| < kMaxExactCoordinate, which they check in debug builds.
+ */
+template <typename T>
+struct ScalarTraits;
+
+template <>
+struct ScalarTraits<float> {
+    using Accumulator = double;
+    static constexpr bool kIsExact = false;
+};
+
+template <>
+struct ScalarTraits<double> {
+    using Accumulator = double;
+    static constexpr bool kIsExact = false;
+};
+
+template <>
+struct ScalarTraits<int32_t> {
+    using Accumulator = int64_t;
+    static constexpr bool kIsExact = true;
+    // The differences of two coordinates and the products of two differences must fit in the accumulator.
+    static constexpr int32_t kMaxExactCoordinate = int32_t{1} << 30;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <>
+struct ScalarTraits<int64_t> {
+    __extension__ using Accumulator = __int128;
+    static constexpr bool kIsExact = true;
+    static constexpr int64_t kMaxExactCoordinate = int64_t{1} << 62;
+};
+#endif
+
+/**
+ * @brief Whether the predicates are exact for a coordinate, i.e. |value| < kMaxExactCoordinate, always true for
+ * floating-point coordinates.
+ */
+template <typename T>
+constexpr bool IsExactCoordinate(T value) {
+    if constexpr (ScalarTraits<T>::kIsExact) {
+        return value > -ScalarTraits<T>::kMaxExactCoordinate && value < ScalarTraits<T>::kMaxExactCoordinate;
+    } else {
+        return true;
+    }
+}
+
+}  // namespace euclid::util
@@ -0,0 +1,162 @@
+#pragma once
+
+/**
+ * @file simd.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define EUCLID_X86_64 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// Functions using instructions beyond the baseline are compiled for that target only and selected at runtime.
+#if defined(EUCLID_X86_64) && (defined(__GNUC__) || defined(__clang__))
+#define EUCLID_TARGET_AVX2 __attribute__((target("avx2")))
+#define EUCLID_TARGET_AVX512 __attribute__((target("avx512f")))
+#define EUCLID_TARGET_BMI2 __attribute__((target("bmi2")))
+#else
+#define EUCLID_TARGET_AVX2
+#define EUCLID_TARGET_AVX512
+#define EUCLID_TARGET_BMI2
+#endif
+
+// GCC fuses multiplications and additions written apart, vector intrinsics included, as soon as FMA is available.
+// Kernels that must round exactly like their scalar counterparts opt out of it.
+#if defined(__GNUC__) && !defined(__clang__)
+#define EUCLID_NO_FP_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+#define EUCLID_NO_FP_CONTRACT
+#endif
+
+namespace euclid::util {
+
+/**
+ * @brief Instruction set levels the vectorized kernels are specialized for, ordered from least to most capable.
+ */
+enum class SimdLevel { kScalar, kSse2, kAvx2, kAvx512 };
+
+/**
+ * @brief Detects the most capable instruction set supported by both the CPU and the operating system.
+ *
+ * @return The detected level, kScalar on non x86-64 targets.
+ */
+inline SimdLevel DetectSimdLevel() {
+#if defined(EUCLID_X86_64)
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::kAvx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::kAvx2;
+    }
+    return SimdLevel::kSse2;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    bool has_os_xsave = (info[2] & (1 << 27)) != 0;
+    if (!has_os_xsave) {
+        return SimdLevel::kSse2;
+    }
+    unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    if ((info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6) {
+        return SimdLevel::kAvx512;
+    }
+    if ((info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6) {
+        return SimdLevel::kAvx2;
+    }
+    return SimdLevel::kSse2;
+#else
+    return SimdLevel::kSse2;
+#endif
+#else
+    return SimdLevel::kScalar;
+#endif
+}
+
+/**
+ * @brief Upper limit for the level returned by GetSimdLevel, e.g. to exercise the fallback kernels. Atomic, as the
+ * kernels read it on the threads of a pool; set it with ScopedMaxSimdLevel.
+ *
+ * @return A reference to the limit, kAvx512 by default.
+ */
+inline std::atomic<SimdLevel>& MaxSimdLevel() {
+    static std::atomic<SimdLevel> max_level{SimdLevel::kAvx512};
+    return max_level;
+}
+
+/**
+ * @brief Lowers MaxSimdLevel for the lifetime of the object and restores the previous limit after.
+ */
+class ScopedMaxSimdLevel {
+public:
+    explicit ScopedMaxSimdLevel(SimdLevel level)
+        : previous_level_(MaxSimdLevel().exchange(level, std::memory_order_relaxed)) {}
+
+    ~ScopedMaxSimdLevel() { MaxSimdLevel().store(previous_level_, std::memory_order_relaxed); }
+
+    ScopedMaxSimdLevel(const ScopedMaxSimdLevel&) = delete;
+    ScopedMaxSimdLevel& operator=(const ScopedMaxSimdLevel&) = delete;
+
+private:
+    SimdLevel previous_level_;
+};
+
+/**
+ * @brief Gets the instruction set level the vectorized kernels dispatch to.
+ *
+ * @return The detected level, capped by MaxSimdLevel.
+ */
+inline SimdLevel GetSimdLevel() {
+    static const SimdLevel detected_level = DetectSimdLevel();
+    return std::min(detected_level, MaxSimdLevel().load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Detects whether the CPU runs the BMI2 bit deposit and extract instructions fast. AMD processors before Zen 3
+ * execute them in microcode taking hundreds of cycles, far slower than the shifts and masks they replace.
+ *
+ * @return true if pdep and pext are supported and fast, false otherwise and on non x86-64 targets.
+ */
+inline bool DetectFastBmi2() {
+#if defined(EUCLID_X86_64)
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("bmi2") && !__builtin_cpu_is("znver1") && !__builtin_cpu_is("znver2");
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const bool is_amd = info[1] == 0x68747541 && info[3] == 0x69746E65 && info[2] == 0x444D4163;
+    __cpuid(info, 1);
+    const int family = ((info[0] >> 8) & 0xF) == 0xF ? 0xF + ((info[0] >> 20) & 0xFF) : (info[0] >> 8) & 0xF;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 8)) != 0 && !(is_amd && family == 0x17);
+#else
+    return false;
+#endif
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Gets whether the bit manipulation kernels dispatch to BMI2. CPUs with AVX2 have BMI2 too, so the kernels also
+ * follow MaxSimdLevel and run the fallback below kAvx2, e.g. to test it.
+ *
+ * @return true if the CPU runs BMI2 fast and GetSimdLevel is at least kAvx2.
+ */
+inline bool HasFastBmi2() {
+    static const bool detected = DetectFastBmi2();
+    return detected && GetSimdLevel() >= SimdLevel::kAvx2;
+}
+
+}  // namespace euclid::util
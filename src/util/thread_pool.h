@@ -0,0 +1,207 @@
+#pragma once
+
+/**
+ * @file thread_pool.h
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace euclid::util {
+
+/**
+ * @brief A fixed set of worker threads running index-parallel loops with work stealing.
+ *
+ * ParallelFor hands every thread an equal contiguous range of task indices. A thread takes tasks from the front of
+ * its own range and, once that is exhausted, steals the back half of the range of another thread, so uneven tasks
+ * balance out without a shared queue. The calling thread takes part as thread 0.
+ *
+ * Calls to ParallelFor are serialized, a task must not call ParallelFor on the same pool.
+ */
+class ThreadPool {
+public:
+    /**
+     * @param num_threads The number of threads running the tasks, including the calling thread. 0 selects the number
+     * of hardware threads.
+     */
+    explicit ThreadPool(size_t num_threads = 0) {
+        if (num_threads == 0) {
+            num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+        ranges_ = std::make_unique<TaskRange[]>(num_threads);
+        num_threads_ = num_threads;
+        workers_.reserve(num_threads - 1);
+        for (size_t i = 1; i < num_threads; ++i) {
+            workers_.emplace_back([this, i]() { WorkerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            is_stopping_ = true;
+        }
+        start_condition_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @return The number of threads running the tasks, including the calling thread.
+     */
+    size_t NumThreads() const { return num_threads_; }
+
+    /**
+     * @brief Runs function(task, thread) for every task in [0, num_tasks) and waits for all of them.
+     *
+     * @param num_tasks The number of tasks, less than 2^32.
+     * @param function Called with the task index and the index of the thread running it, in [0, NumThreads()), so
+     * that per-thread scratch memory can be indexed by it. The first exception thrown by a task is rethrown once all
+     * tasks have run.
+     */
+    template <typename Function>
+    void ParallelFor(size_t num_tasks, Function&& function) {
+        if (num_tasks == 0) {
+            return;
+        }
+        if (num_threads_ == 1 || num_tasks == 1) {
+            for (size_t task = 0; task < num_tasks; ++task) {
+                function(task, 0);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+        for (size_t i = 0; i < num_threads_; ++i) {
+            ranges_[i].value.store(Pack(num_tasks * i / num_threads_, num_tasks * (i + 1) / num_threads_),
+                                   std::memory_order_relaxed);
+        }
+        auto* function_pointer = &function;
+        run_ = [](void* context, size_t task, size_t thread) {
+            (*static_cast<decltype(function_pointer)>(context))(task, thread);
+        };
+        context_ = function_pointer;
+        exception_ = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            num_running_ = num_threads_ - 1;
+            generation_++;
+        }
+        start_condition_.notify_all();
+        RunTasks(0);
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_condition_.wait(lock, [this]() { return num_running_ == 0; });
+        if (exception_) {
+            std::rethrow_exception(std::exchange(exception_, nullptr));
+        }
+    }
+
+private:
+    // Both ends of a range of task indices in one word, begin in the low half, so that they change atomically.
+    struct alignas(64) TaskRange {
+        std::atomic<uint64_t> value{0};
+    };
+
+    static uint64_t Pack(size_t begin, size_t end) { return static_cast<uint64_t>(end) << 32 | begin; }
+
+    static size_t Begin(uint64_t range) { return static_cast<size_t>(range & 0xFFFFFFFFu); }
+
+    static size_t End(uint64_t range) { return static_cast<size_t>(range >> 32); }
+
+    bool PopTask(size_t thread, size_t& task) {
+        auto& own = ranges_[thread].value;
+        uint64_t range = own.load(std::memory_order_acquire);
+        while (Begin(range) < End(range)) {
+            if (own.compare_exchange_weak(range, Pack(Begin(range) + 1, End(range)), std::memory_order_acq_rel)) {
+                task = Begin(range);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool StealTasks(size_t thread) {
+        for (size_t offset = 1; offset < num_threads_; ++offset) {
+            auto& victim = ranges_[(thread + offset) % num_threads_].value;
+            uint64_t range = victim.load(std::memory_order_acquire);
+            while (Begin(range) < End(range)) {
+                size_t middle = End(range) - (End(range) - Begin(range) + 1) / 2;
+                if (victim.compare_exchange_weak(range, Pack(Begin(range), middle), std::memory_order_acq_rel)) {
+                    // Only the owner takes from its own range, and it is empty, so a plain store is enough.
+                    ranges_[thread].value.store(Pack(middle, End(range)), std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void RunTasks(size_t thread) {
+        size_t task = 0;
+        do {
+            while (PopTask(thread, task)) {
+                try {
+                    run_(context_, task, thread);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (!exception_) {
+                        exception_ = std::current_exception();
+                    }
+                }
+            }
+        } while (StealTasks(thread));
+    }
+
+    void WorkerLoop(size_t thread) {
+        size_t generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_condition_.wait(lock, [&]() { return is_stopping_ || generation_ != generation; });
+                if (is_stopping_) {
+                    return;
+                }
+                generation = generation_;
+            }
+            RunTasks(thread);
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--num_running_ == 0) {
+                done_condition_.notify_one();
+            }
+        }
+    }
+
+    size_t num_threads_ = 1;
+    std::vector<std::thread> workers_;
+    std::unique_ptr<TaskRange[]> ranges_;
+
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable start_condition_;
+    std::condition_variable done_condition_;
+    uint64_t generation_ = 0;
+    size_t num_running_ = 0;
+    bool is_stopping_ = false;
+
+    void (*run_)(void*, size_t, size_t) = nullptr;
+    void* context_ = nullptr;
+    std::exception_ptr exception_;
+};
+
+}  // namespace euclid::util
@@ -6,14 +6,69 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory_resource>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <set>
+#include <span>
+#include <utility>
+
+#include "algorithm/convex_hull/approximate.h"
+#include "algorithm/convex_hull/batch.h"
+#include "algorithm/convex_hull/chan.h"
+#include "algorithm/convex_hull/dynamic.h"
 #include "algorithm/convex_hull/extreme_edge.h"
 #include "algorithm/convex_hull/extreme_point.h"
 #include "algorithm/convex_hull/graham_scan.h"
+#include "algorithm/convex_hull/melkman.h"
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_hull/parallel.h"
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/convex_hull/sliding_window.h"
+#include "algorithm/convex_hull/streaming.h"
+#include "algorithm/convex_hull/util.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "algorithm/util/predicates.h"
 #include "geometry/point_2d.h"
+#include "geometry/strided_point_span_2d.h"
+#include "util/thread_pool.h"
 
 using namespace euclid::geometry;
 using namespace euclid::algorithm::convex_hull;
 
+namespace {
+
+// A memory resource counting the allocations it forwards, to check that the workspace overloads do not allocate in
+// steady state.
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+    size_t NumAllocations() const { return num_allocations_; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        num_allocations_++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    size_t num_allocations_ = 0;
+};
+
+}  // namespace
+
 class ConvexHullTest : public ::testing::Test {
 protected:
     std::vector<Point2D> points1_ = {{0, 0}, {1, 0}, {1, 1}, {0, 1}, {0, 2}};
@@ -50,4 +105,960 @@ TEST_F(ConvexHullTest, GetConvexHullByGrahamScanTest) {
     EXPECT_EQ(convex_extreme_points[1], expected_points1_[1]);
     EXPECT_EQ(convex_extreme_points[2], expected_points1_[2]);
     EXPECT_EQ(convex_extreme_points[3], expected_points1_[3]);
-}
\ No newline at end of file
+}
+
+TEST_F(ConvexHullTest, GetConvexHullByMonotoneChainTest) {
+    auto convex_extreme_points = GetConvexHullByMonotoneChain(points1_);
+    EXPECT_EQ(convex_extreme_points.size(), 4);
+    EXPECT_EQ(convex_extreme_points[0], expected_points1_[0]);
+    EXPECT_EQ(convex_extreme_points[1], expected_points1_[1]);
+    EXPECT_EQ(convex_extreme_points[2], expected_points1_[2]);
+    EXPECT_EQ(convex_extreme_points[3], expected_points1_[3]);
+
+    std::vector<Point2D> buffer;
+    GetConvexHullByMonotoneChain(points1_, buffer);
+    auto capacity = buffer.capacity();
+    GetConvexHullByMonotoneChain(points1_, buffer);
+    EXPECT_EQ(buffer.capacity(), capacity);
+    EXPECT_EQ(buffer, convex_extreme_points);
+
+    std::vector<Point2D> collinear_points = {{0, 0}, {1, 1}, {2, 2}, {1, 1}};
+    EXPECT_TRUE(GetConvexHullByMonotoneChain(collinear_points).empty());
+}
+
+TEST_F(ConvexHullTest, GetConvexHullByGrahamScanCollinearTest) {
+    std::vector<Point2D> points = {{0, 0}, {1, 0}, {2, 0}, {1, 1}};
+    auto convex_extreme_points = GetConvexHullByGrahamScan(points);
+    EXPECT_EQ(convex_extreme_points.size(), 3);
+    EXPECT_EQ(convex_extreme_points[0], Point2D({0, 0}));
+    EXPECT_EQ(convex_extreme_points[1], Point2D({2, 0}));
+    EXPECT_EQ(convex_extreme_points[2], Point2D({1, 1}));
+
+    std::vector<Point2D> collinear_points = {{0, 0}, {1, 1}, {3, 3}, {2, 2}};
+    EXPECT_TRUE(GetConvexHullByGrahamScan(collinear_points).empty());
+}
+
+TEST_F(ConvexHullTest, GetConvexHullByChanTest) {
+    auto convex_extreme_points = GetConvexHullByChan(points1_);
+    EXPECT_EQ(convex_extreme_points.size(), 4);
+    EXPECT_EQ(convex_extreme_points[0], expected_points1_[0]);
+    EXPECT_EQ(convex_extreme_points[1], expected_points1_[1]);
+    EXPECT_EQ(convex_extreme_points[2], expected_points1_[2]);
+    EXPECT_EQ(convex_extreme_points[3], expected_points1_[3]);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<Point2D> disk_points(100000);
+    for (auto& point : disk_points) {
+        double radius = 1000.0 * std::sqrt(distribution(generator));
+        double angle = 2.0 * std::numbers::pi * distribution(generator);
+        point = {radius * std::cos(angle), radius * std::sin(angle)};
+    }
+    size_t num_rounds = 0;
+    auto chan_points = GetConvexHullByChan(disk_points, num_rounds);
+    EXPECT_EQ(chan_points, GetConvexHullByGrahamScan(disk_points));
+    EXPECT_EQ(num_rounds, 4);
+
+    std::vector<Point2D> circle_points(1000);
+    for (size_t i = 0; i < circle_points.size(); ++i) {
+        double angle = 2.0 * std::numbers::pi * static_cast<double>(i) / static_cast<double>(circle_points.size());
+        circle_points[i] = {1000.0 * std::cos(angle), 1000.0 * std::sin(angle)};
+    }
+    chan_points = GetConvexHullByChan(circle_points, num_rounds);
+    EXPECT_EQ(chan_points.size(), circle_points.size());
+    EXPECT_EQ(chan_points, GetConvexHullByGrahamScan(circle_points));
+    EXPECT_EQ(num_rounds, 4);
+}
+
+TEST_F(ConvexHullTest, GetConvexHullByQuickHullTest) {
+    auto convex_extreme_points = GetConvexHullByQuickHull(points1_);
+    EXPECT_EQ(convex_extreme_points.size(), 4);
+    EXPECT_EQ(convex_extreme_points[0], expected_points1_[0]);
+    EXPECT_EQ(convex_extreme_points[1], expected_points1_[1]);
+    EXPECT_EQ(convex_extreme_points[2], expected_points1_[2]);
+    EXPECT_EQ(convex_extreme_points[3], expected_points1_[3]);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+    std::vector<Point2D> square_points(50001);
+    for (auto& point : square_points) {
+        point = {distribution(generator), distribution(generator)};
+    }
+    auto expected_points = GetConvexHullByMonotoneChain(square_points);
+    for (auto level : {euclid::util::SimdLevel::kScalar, euclid::util::SimdLevel::kSse2,
+                       euclid::util::SimdLevel::kAvx2}) {
+        euclid::util::ScopedMaxSimdLevel max_simd_level(level);
+        size_t indices[kNumOctagonDirections];
+        size_t scalar_indices[kNumOctagonDirections];
+        FindOctagonExtremeIndices(square_points.data(), square_points.size(), indices);
+        FindOctagonExtremeIndicesScalar(square_points.data(), square_points.size(), scalar_indices);
+        for (size_t i = 0; i < kNumOctagonDirections; ++i) {
+            EXPECT_EQ(indices[i], scalar_indices[i]);
+        }
+        EXPECT_EQ(FindFarthestRightIndex(square_points.data(), square_points.size(), {0, 0}, {1, 1}),
+                  FindFarthestRightIndexScalar(square_points.data(), square_points.size(), {0, 0}, {1, 1}));
+        EXPECT_EQ(GetConvexHullByQuickHull(square_points), expected_points);
+    }
+
+    std::vector<Point2D> collinear_points = {{0, 0}, {2, 2}, {1, 1}, {3, 3}};
+    EXPECT_TRUE(GetConvexHullByQuickHull(collinear_points).empty());
+
+    // Points on a parabola over an x range of 2^500, where every step splits off only the last few points, recurse
+    // past kQuickHullMaxDepth.
+    using Predicates = euclid::algorithm::util::AdaptivePredicates;
+    std::vector<Point2D> parabola_points;
+    for (int i = 0; i < 2000; ++i) {
+        const double x = std::exp2(i / 4.0 - 250.0);
+        parabola_points.push_back({x, x * x});
+        parabola_points.push_back({-x, x * x});
+    }
+    EXPECT_EQ(GetConvexHullByQuickHull<Predicates>(parabola_points),
+              GetConvexHullByMonotoneChain<Predicates>(parabola_points));
+}
+
+TEST_F(ConvexHullTest, RemoveCoincidePointsTest) {
+    std::vector<Point2D> points = {{0, 0}, {1, 0}, {0, 0}, {1, 1e-7}, {2, 2}, {5e-7, -5e-7}, {2, 2}};
+    std::vector<size_t> representative_indices;
+    auto unique_points = RemoveCoincidePoints(points, representative_indices);
+    EXPECT_EQ(unique_points.size(), 3);
+    EXPECT_EQ(unique_points[0], points[0]);
+    EXPECT_EQ(unique_points[1], points[1]);
+    EXPECT_EQ(unique_points[2], points[4]);
+    EXPECT_EQ(representative_indices, std::vector<size_t>({0, 1, 0, 1, 2, 0, 2}));
+
+    // Clusters of points closer than the tolerance must map to the earliest unique point they coincide with.
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<int> cluster_distribution(0, 200);
+    std::uniform_real_distribution<double> offset_distribution(-1e-6, 1e-6);
+    std::vector<Point2D> cluster_points(5000);
+    for (auto& point : cluster_points) {
+        double center = static_cast<double>(cluster_distribution(generator));
+        point = {center + offset_distribution(generator), -center + offset_distribution(generator)};
+    }
+    unique_points = RemoveCoincidePoints(cluster_points, representative_indices);
+    std::vector<Point2D> expected_points;
+    for (size_t i = 0; i < cluster_points.size(); ++i) {
+        size_t representative = expected_points.size();
+        for (size_t j = 0; j < expected_points.size(); ++j) {
+            if (cluster_points[i] == expected_points[j]) {
+                representative = j;
+                break;
+            }
+        }
+        if (representative == expected_points.size()) {
+            expected_points.push_back(cluster_points[i]);
+        }
+        EXPECT_EQ(representative_indices[i], representative);
+    }
+    EXPECT_EQ(unique_points.size(), expected_points.size());
+
+    // Far from the origin the cells widen with the span instead of all points sharing one clamped cell.
+    for (double offset : {1e13, -1e13}) {
+        std::vector<Point2D> far_points;
+        std::vector<size_t> expected_indices;
+        for (size_t i = 0; i < 40000; ++i) {
+            size_t k = i < 20000 ? i : (i * 7919) % 20000;
+            far_points.push_back({offset + 2.0 * static_cast<double>(k), offset + static_cast<double>(k % 100)});
+            expected_indices.push_back(k);
+        }
+        unique_points = RemoveCoincidePoints(far_points, representative_indices);
+        EXPECT_EQ(unique_points.size(), 20000);
+        EXPECT_EQ(representative_indices, expected_indices);
+    }
+}
+
+TEST_F(ConvexHullTest, AdaptivePredicatesTest) {
+    using euclid::algorithm::util::AdaptivePredicates;
+    auto AreIdentical = [](const std::vector<Point2D>& a, const std::vector<Point2D>& b) {
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (a[i].coords[0] != b[i].coords[0] || a[i].coords[1] != b[i].coords[1]) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto Scale = [](std::vector<Point2D> points, double scale) {
+        for (auto& point : points) {
+            point = {point.coords[0] * scale, point.coords[1] * scale};
+        }
+        return points;
+    };
+
+    // Scaling by a power of two is exact, so exact predicates must return the scaled hull.
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<Point2D> points(40);
+    for (auto& point : points) {
+        point = {distribution(generator), distribution(generator)};
+    }
+    auto expected_points = GetConvexHullByMonotoneChain<AdaptivePredicates>(points);
+    ASSERT_GE(expected_points.size(), 3);
+    EXPECT_TRUE(AreIdentical(expected_points, GetConvexHullByMonotoneChain(points)));
+    for (double scale : {1.0, 0x1p-30, 0x1p40}) {
+        auto scaled_points = Scale(points, scale);
+        auto scaled_expected_points = Scale(expected_points, scale);
+        EXPECT_TRUE(AreIdentical(GetConvexHullByMonotoneChain<AdaptivePredicates>(scaled_points),
+                                 scaled_expected_points));
+        EXPECT_TRUE(AreIdentical(GetConvexHullByGrahamScan<AdaptivePredicates>(scaled_points), scaled_expected_points));
+        EXPECT_TRUE(AreIdentical(GetConvexHullByChan<AdaptivePredicates>(scaled_points), scaled_expected_points));
+        EXPECT_TRUE(AreIdentical(GetConvexHullByQuickHull<AdaptivePredicates>(scaled_points), scaled_expected_points));
+        EXPECT_TRUE(
+            AreIdentical(GetConvexHullByExtremeEdge<AdaptivePredicates>(scaled_points), scaled_expected_points));
+        EXPECT_TRUE(
+            AreIdentical(GetConvexHullByExtremePoint<AdaptivePredicates>(scaled_points), scaled_expected_points));
+    }
+    // The fixed tolerance sees every point of the shrunk input as collinear.
+    EXPECT_TRUE(GetConvexHullByMonotoneChain(Scale(points, 0x1p-30)).empty());
+
+    // Points rounded onto a line far from the origin, their orientations are decided by the exact stages.
+    std::vector<Point2D> near_collinear_points;
+    for (int i = 0; i < 2000; ++i) {
+        double t = distribution(generator);
+        near_collinear_points.push_back({1e9 + t * 0.1, 1e9 + t * 0.7});
+    }
+    auto near_collinear_hull = GetConvexHullByMonotoneChain<AdaptivePredicates>(near_collinear_points);
+    ASSERT_GE(near_collinear_hull.size(), 3);
+    EXPECT_TRUE(
+        AreIdentical(GetConvexHullByGrahamScan<AdaptivePredicates>(near_collinear_points), near_collinear_hull));
+    EXPECT_TRUE(AreIdentical(GetConvexHullByChan<AdaptivePredicates>(near_collinear_points), near_collinear_hull));
+    EXPECT_TRUE(AreIdentical(GetConvexHullByQuickHull<AdaptivePredicates>(near_collinear_points), near_collinear_hull));
+    for (size_t i = 0; i < near_collinear_hull.size(); ++i) {
+        const auto& p = near_collinear_hull[i];
+        const auto& q = near_collinear_hull[(i + 1) % near_collinear_hull.size()];
+        for (const auto& point : near_collinear_points) {
+            EXPECT_GE(euclid::algorithm::util::Orient2D(p, q, point), 0.0);
+        }
+    }
+}
+
+TEST_F(ConvexHullTest, ScalarTypesTest) {
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<int32_t> distribution(-1000, 1000);
+    std::vector<BasicPoint2D<int32_t>> int_points(5000);
+    for (auto& point : int_points) {
+        point = {distribution(generator), distribution(generator)};
+    }
+    // collinear points on the hull boundary and copies of hull vertices
+    for (int32_t i = -1500; i <= 1500; i += 250) {
+        int_points.push_back({i, -1500});
+        int_points.push_back({i, -1500});
+    }
+    std::vector<Point2D> double_points;
+    std::vector<BasicPoint2D<float>> float_points;
+    for (const auto& point : int_points) {
+        double_points.push_back({static_cast<double>(point.coords[0]), static_cast<double>(point.coords[1])});
+        float_points.push_back({static_cast<float>(point.coords[0]), static_cast<float>(point.coords[1])});
+    }
+
+    auto expected_points = GetConvexHullByMonotoneChain(double_points);
+    ASSERT_GE(expected_points.size(), 3);
+    auto ExpectSameHull = [&expected_points](const auto& convex_hull_points) {
+        ASSERT_EQ(convex_hull_points.size(), expected_points.size());
+        for (size_t i = 0; i < expected_points.size(); ++i) {
+            EXPECT_EQ(static_cast<double>(convex_hull_points[i].coords[0]), expected_points[i].coords[0]);
+            EXPECT_EQ(static_cast<double>(convex_hull_points[i].coords[1]), expected_points[i].coords[1]);
+        }
+    };
+    ExpectSameHull(GetConvexHullByMonotoneChain(int_points));
+    ExpectSameHull(GetConvexHullByGrahamScan(int_points));
+    ExpectSameHull(GetConvexHullByChan(int_points));
+    ExpectSameHull(GetConvexHullByQuickHull(int_points));
+    ExpectSameHull(GetConvexHullByMonotoneChain(float_points));
+    ExpectSameHull(GetConvexHullByQuickHull(float_points));
+    ExpectSameHull(GetConvexHullByQuickHull<euclid::algorithm::util::AdaptivePredicates>(float_points));
+
+    std::vector<BasicPoint2D<int32_t>> small_int_points(int_points.begin(), int_points.begin() + 30);
+    auto small_expected_points = GetConvexHullByMonotoneChain(small_int_points);
+    EXPECT_EQ(GetConvexHullByExtremeEdge(small_int_points), small_expected_points);
+    EXPECT_EQ(GetConvexHullByExtremePoint(small_int_points), small_expected_points);
+
+    std::vector<size_t> representative_indices;
+    auto unique_points = RemoveCoincidePoints(int_points, representative_indices);
+    std::set<std::pair<int32_t, int32_t>> distinct_points;
+    for (const auto& point : int_points) {
+        distinct_points.insert({point.coords[0], point.coords[1]});
+    }
+    EXPECT_EQ(unique_points.size(), distinct_points.size());
+    for (size_t i = 0; i < int_points.size(); ++i) {
+        EXPECT_EQ(unique_points[representative_indices[i]], int_points[i]);
+    }
+
+#if defined(__SIZEOF_INT128__)
+    // Coordinates far beyond the 53 bits of a double, the hull must still be exact.
+    constexpr int64_t kOffset = int64_t{1} << 60;
+    std::vector<BasicPoint2D<int64_t>> large_points;
+    for (const auto& point : int_points) {
+        large_points.push_back({kOffset + point.coords[0], kOffset - point.coords[1]});
+    }
+    auto large_convex_hull_points = GetConvexHullByMonotoneChain(large_points);
+    EXPECT_EQ(large_convex_hull_points.size(), expected_points.size());
+    EXPECT_EQ(GetConvexHullByQuickHull(large_points), large_convex_hull_points);
+    EXPECT_EQ(GetConvexHullByChan(large_points), large_convex_hull_points);
+    for (size_t i = 0; i < large_convex_hull_points.size(); ++i) {
+        const auto& p = large_convex_hull_points[i];
+        const auto& q = large_convex_hull_points[(i + 1) % large_convex_hull_points.size()];
+        const auto& r = large_convex_hull_points[(i + 2) % large_convex_hull_points.size()];
+        EXPECT_TRUE(euclid::algorithm::util::IsTurnLeft(p, q, r));
+        for (const auto& point : large_points) {
+            EXPECT_FALSE(euclid::algorithm::util::IsTurnLeft(q, p, point));
+        }
+    }
+#endif
+}
+
+TEST_F(ConvexHullTest, WorkspaceTest) {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+    std::vector<std::vector<Point2D>> inputs;
+    for (size_t size : {0, 1, 2, 3, 5, 16, 300, 5000}) {
+        std::vector<Point2D> points(size);
+        for (auto& point : points) {
+            point = {distribution(generator), distribution(generator)};
+        }
+        inputs.push_back(points);
+    }
+    inputs.push_back({{0, 0}, {1, 1}, {2, 2}, {1, 1}});
+    inputs.push_back(points1_);
+
+    std::vector<std::vector<Point2D>> expected_points;
+    for (const auto& points : inputs) {
+        expected_points.push_back(GetConvexHullByMonotoneChain(points));
+        EXPECT_EQ(GetConvexHullByGrahamScan(points), expected_points.back());
+        EXPECT_EQ(GetConvexHullByQuickHull(points), expected_points.back());
+        EXPECT_EQ(GetConvexHullByChan(points), expected_points.back());
+    }
+
+    // Once reserved, neither the workspace nor the outputs allocate.
+    CountingMemoryResource counting_resource;
+    HullWorkspace workspace(&counting_resource);
+    workspace.Reserve(5000);
+    std::vector<Point2D> output_buffer(5000);
+    std::span<Point2D> output_points(output_buffer);
+    std::pmr::vector<Point2D> pmr_points(&counting_resource);
+    pmr_points.reserve(5000);
+    std::vector<size_t> hull_sizes(4 * inputs.size());
+    std::vector<bool> are_equal(4 * inputs.size());
+    std::vector<bool> are_pmr_equal(4 * inputs.size());
+    auto IsExpected = [&](size_t input, size_t hull_size) {
+        const auto& expected = expected_points[input];
+        return hull_size == expected.size() && std::equal(expected.begin(), expected.end(), output_points.begin());
+    };
+    auto IsPmrExpected = [&](size_t input) {
+        return std::equal(pmr_points.begin(), pmr_points.end(), expected_points[input].begin(),
+                          expected_points[input].end());
+    };
+    const size_t num_allocations_before = counting_resource.NumAllocations();
+    for (size_t round = 0; round < 2; ++round) {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            hull_sizes[4 * i] = GetConvexHullByMonotoneChain(inputs[i], output_points, workspace);
+            are_equal[4 * i] = IsExpected(i, hull_sizes[4 * i]);
+            GetConvexHullByMonotoneChain(inputs[i], pmr_points, workspace);
+            are_pmr_equal[4 * i] = IsPmrExpected(i);
+            hull_sizes[4 * i + 1] = GetConvexHullByGrahamScan(inputs[i], output_points, workspace);
+            are_equal[4 * i + 1] = IsExpected(i, hull_sizes[4 * i + 1]);
+            GetConvexHullByGrahamScan(inputs[i], pmr_points, workspace);
+            are_pmr_equal[4 * i + 1] = IsPmrExpected(i);
+            hull_sizes[4 * i + 2] = GetConvexHullByQuickHull(inputs[i], output_points, workspace);
+            are_equal[4 * i + 2] = IsExpected(i, hull_sizes[4 * i + 2]);
+            GetConvexHullByQuickHull(inputs[i], pmr_points, workspace);
+            are_pmr_equal[4 * i + 2] = IsPmrExpected(i);
+            hull_sizes[4 * i + 3] = GetConvexHullByChan(inputs[i], output_points, workspace);
+            are_equal[4 * i + 3] = IsExpected(i, hull_sizes[4 * i + 3]);
+            GetConvexHullByChan(inputs[i], pmr_points, workspace);
+            are_pmr_equal[4 * i + 3] = IsPmrExpected(i);
+        }
+    }
+    EXPECT_EQ(counting_resource.NumAllocations(), num_allocations_before);
+    for (size_t i = 0; i < hull_sizes.size(); ++i) {
+        EXPECT_EQ(hull_sizes[i], expected_points[i / 4].size());
+        EXPECT_TRUE(are_equal[i]);
+        EXPECT_TRUE(are_pmr_equal[i]);
+    }
+
+    // An output span too small for the hull is left untouched, the required size is still returned.
+    Point2D small_output[2] = {{-1, -1}, {-1, -1}};
+    EXPECT_EQ(GetConvexHullByMonotoneChain(points1_, small_output, workspace), expected_points1_.size());
+    EXPECT_EQ(small_output[0], (Point2D{-1, -1}));
+
+    // The output container may draw from any memory resource.
+    char arena[1024];
+    std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+    std::pmr::vector<Point2D> arena_points(&resource);
+    HullWorkspace arena_workspace(&resource);
+    GetConvexHullByQuickHull(points1_, arena_points, arena_workspace);
+    EXPECT_EQ(std::vector<Point2D>(arena_points.begin(), arena_points.end()), expected_points1_);
+}
+
+TEST_F(ConvexHullTest, StridedPointSpanTest) {
+    struct Record {
+        int id;
+        double x;
+        float weight;
+        double y;
+    };
+    std::vector<Record> records;
+    for (size_t i = 0; i < points1_.size(); ++i) {
+        records.push_back({static_cast<int>(i), points1_[i].coords[0], 1.0f, points1_[i].coords[1]});
+    }
+    StridedPointSpan2D strided_points(records.data(), records.size(), &Record::x, &Record::y);
+    ASSERT_EQ(strided_points.Size(), points1_.size());
+    for (size_t i = 0; i < points1_.size(); ++i) {
+        EXPECT_EQ(strided_points[i], points1_[i]);
+    }
+    EXPECT_TRUE(StridedPointSpan2D(records.data(), 0, &Record::x, &Record::y).Empty());
+
+    HullWorkspace workspace;
+    std::vector<Point2D> convex_hull_points;
+    GetConvexHullByMonotoneChain(workspace.Gather(strided_points), convex_hull_points, workspace);
+    EXPECT_EQ(convex_hull_points, expected_points1_);
+}
+
+TEST_F(ConvexHullTest, GetConvexHullsTest) {
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+    std::uniform_int_distribution<size_t> size_distribution(0, 500);
+    std::vector<Point2D> points;
+    std::vector<size_t> offsets = {0};
+    for (size_t group = 0; group < 2000; ++group) {
+        // mostly groups for the sorting networks, then larger ones
+        size_t size = group < 1000 ? group % 10 : size_distribution(generator);
+        for (size_t i = 0; i < size; ++i) {
+            points.push_back({distribution(generator), distribution(generator)});
+        }
+        offsets.push_back(points.size());
+    }
+    // collinear and coincident groups
+    points.insert(points.end(), {{0, 0}, {1, 1}, {2, 2}, {3, 3}, {5, 5}, {5, 5}, {5, 5}});
+    offsets.push_back(points.size() - 3);
+    offsets.push_back(points.size());
+
+    for (size_t num_threads : {1, 3}) {
+        euclid::util::ThreadPool thread_pool(num_threads);
+        std::vector<Point2D> convex_hull_points;
+        std::vector<size_t> convex_hull_offsets;
+        GetConvexHulls(points, offsets, convex_hull_points, convex_hull_offsets, thread_pool);
+        ASSERT_EQ(convex_hull_offsets.size(), offsets.size());
+        EXPECT_EQ(convex_hull_offsets.front(), 0);
+        EXPECT_EQ(convex_hull_offsets.back(), convex_hull_points.size());
+        for (size_t group = 0; group + 1 < offsets.size(); ++group) {
+            std::vector<Point2D> group_points(points.begin() + offsets[group], points.begin() + offsets[group + 1]);
+            std::vector<Point2D> group_hull_points(convex_hull_points.begin() + convex_hull_offsets[group],
+                                                   convex_hull_points.begin() + convex_hull_offsets[group + 1]);
+            EXPECT_EQ(group_hull_points, GetConvexHullByMonotoneChain(group_points));
+        }
+    }
+
+    // A subrange of the offsets selects some of the groups.
+    euclid::util::ThreadPool thread_pool(2);
+    std::vector<Point2D> convex_hull_points;
+    std::vector<size_t> convex_hull_offsets;
+    GetConvexHulls(points, std::span<const size_t>(offsets).subspan(1000, 3), convex_hull_points, convex_hull_offsets,
+                   thread_pool);
+    ASSERT_EQ(convex_hull_offsets.size(), 3);
+    std::vector<Point2D> group_points(points.begin() + offsets[1000], points.begin() + offsets[1001]);
+    EXPECT_EQ(std::vector<Point2D>(convex_hull_points.begin(), convex_hull_points.begin() + convex_hull_offsets[1]),
+              GetConvexHullByMonotoneChain(group_points));
+
+    GetConvexHulls(points, std::span<const size_t>(), convex_hull_points, convex_hull_offsets, thread_pool);
+    EXPECT_TRUE(convex_hull_points.empty());
+    EXPECT_TRUE(convex_hull_offsets.empty());
+}
+
+TEST_F(ConvexHullTest, GetConvexHullInParallelTest) {
+    std::mt19937 generator(13);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    std::vector<Point2D> disc_points;
+    while (disc_points.size() < 300000) {
+        Point2D point{distribution(generator), distribution(generator)};
+        if (point.coords[0] * point.coords[0] + point.coords[1] * point.coords[1] <= 1.0) {
+            disc_points.push_back(point);
+        }
+    }
+    // every point on the hull, in an order that spreads each chunk around the circle
+    std::vector<Point2D> circle_points(200000);
+    for (size_t i = 0; i < circle_points.size(); ++i) {
+        double angle = 2.0 * std::numbers::pi * static_cast<double>(i * 7919 % circle_points.size()) /
+                       static_cast<double>(circle_points.size());
+        circle_points[i] = {1e3 * std::cos(angle), 1e3 * std::sin(angle)};
+    }
+    std::vector<Point2D> collinear_points(100000);
+    for (size_t i = 0; i < collinear_points.size(); ++i) {
+        collinear_points[i] = {static_cast<double>(i % 1000), static_cast<double>(i % 1000)};
+    }
+
+    // nearly collinear points, on a line through the integer grid rounded to doubles and spread over the chunks
+    std::vector<Point2D> near_collinear_points(200000);
+    for (size_t i = 0; i < near_collinear_points.size(); ++i) {
+        double x = 0.1 * static_cast<double>(i * 7919 % near_collinear_points.size());
+        near_collinear_points[i] = {x, x / 3.0 + 1e-9 * static_cast<double>(i % 3)};
+    }
+
+    // With the tolerance, nearly collinear vertices depend on the evaluation order, but not on the number of threads.
+    using euclid::algorithm::util::TolerancePredicates;
+    auto tolerance_convex_hull_points = GetConvexHullInParallel<TolerancePredicates>(disc_points, 1);
+    for (size_t num_threads : {1, 4}) {
+        euclid::util::ThreadPool thread_pool(num_threads);
+        EXPECT_EQ(GetConvexHullInParallel<TolerancePredicates>(disc_points, thread_pool), tolerance_convex_hull_points);
+        // The default policy is exact and reproduces the sequential path.
+        EXPECT_EQ(GetConvexHullInParallel(disc_points, thread_pool),
+                  GetConvexHullByMonotoneChain<euclid::algorithm::util::AdaptivePredicates>(disc_points));
+        EXPECT_EQ(GetConvexHullInParallel(circle_points, thread_pool),
+                  GetConvexHullByMonotoneChain<euclid::algorithm::util::AdaptivePredicates>(circle_points));
+        EXPECT_EQ(GetConvexHullInParallel(near_collinear_points, thread_pool),
+                  GetConvexHullByMonotoneChain<euclid::algorithm::util::AdaptivePredicates>(near_collinear_points));
+        EXPECT_TRUE(GetConvexHullInParallel(collinear_points, thread_pool).empty());
+        EXPECT_EQ(GetConvexHullInParallel(points1_, thread_pool), expected_points1_);
+        EXPECT_TRUE(GetConvexHullInParallel(std::vector<Point2D>(), thread_pool).empty());
+    }
+
+    std::vector<BasicPoint2D<int32_t>> int_points(200000);
+    std::uniform_int_distribution<int32_t> int_distribution(-1 << 20, 1 << 20);
+    for (auto& point : int_points) {
+        point = {int_distribution(generator), int_distribution(generator)};
+    }
+    EXPECT_EQ(GetConvexHullInParallel(int_points, 3), GetConvexHullByMonotoneChain(int_points));
+}
+
+TEST_F(ConvexHullTest, DynamicConvexHullTest) {
+    using IntPoint = BasicPoint2D<int32_t>;
+    using Predicates = euclid::algorithm::util::AdaptivePredicates;
+    std::mt19937 generator(17);
+    // a small grid, for many coincident and collinear points
+    std::uniform_int_distribution<int32_t> distribution(-12, 12);
+    BasicDynamicConvexHull2D<int32_t, Predicates> dynamic_convex_hull;
+    std::vector<IntPoint> points;
+    for (size_t step = 0; step < 3000; ++step) {
+        if (points.empty() || generator() % 5 < 3) {
+            IntPoint point{distribution(generator), distribution(generator)};
+            dynamic_convex_hull.Insert(point);
+            points.push_back(point);
+        } else {
+            size_t index = generator() % points.size();
+            EXPECT_TRUE(dynamic_convex_hull.Erase(points[index]));
+            points.erase(points.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+        ASSERT_EQ(dynamic_convex_hull.Size(), points.size());
+        ASSERT_EQ(dynamic_convex_hull.GetConvexHull(), GetConvexHullByMonotoneChain<Predicates>(points));
+
+        IntPoint direction{distribution(generator), distribution(generator)};
+        auto Dot = [&direction](const IntPoint& point) {
+            return int64_t{direction.coords[0]} * point.coords[0] + int64_t{direction.coords[1]} * point.coords[1];
+        };
+        auto extreme_point = dynamic_convex_hull.GetExtremePoint(direction);
+        ASSERT_EQ(extreme_point.has_value(), !points.empty());
+        if (extreme_point) {
+            int64_t max_dot = Dot(points[0]);
+            for (const auto& point : points) {
+                max_dot = std::max(max_dot, Dot(point));
+            }
+            EXPECT_EQ(Dot(*extreme_point), max_dot);
+        }
+
+        // the tangent points are the neighbours of the query point on the hull including it
+        IntPoint query{distribution(generator) * 2, distribution(generator) * 2};
+        auto tangents = dynamic_convex_hull.GetTangents(query);
+        auto with_query = points;
+        with_query.push_back(query);
+        auto convex_hull_points = GetConvexHullByMonotoneChain<Predicates>(with_query);
+        auto found = std::find(convex_hull_points.begin(), convex_hull_points.end(), query);
+        if (convex_hull_points.empty()) {
+            continue;
+        }
+        if (found == convex_hull_points.end() || std::find(points.begin(), points.end(), query) != points.end()) {
+            EXPECT_FALSE(tangents.has_value());
+            continue;
+        }
+        ASSERT_TRUE(tangents.has_value());
+        size_t index = static_cast<size_t>(found - convex_hull_points.begin());
+        size_t size = convex_hull_points.size();
+        EXPECT_EQ(tangents->first, convex_hull_points[(index + size - 1) % size]);
+        EXPECT_EQ(tangents->second, convex_hull_points[(index + 1) % size]);
+    }
+    EXPECT_FALSE(dynamic_convex_hull.Erase({100, 100}));
+    while (!points.empty()) {
+        EXPECT_TRUE(dynamic_convex_hull.Erase(points.back()));
+        points.pop_back();
+    }
+    EXPECT_TRUE(dynamic_convex_hull.Empty());
+    EXPECT_TRUE(dynamic_convex_hull.GetConvexHull().empty());
+    EXPECT_FALSE(dynamic_convex_hull.GetTangents({0, 0}).has_value());
+
+    // floating-point coordinates, checked against the exact monotone chain
+    std::uniform_real_distribution<double> real_distribution(-1.0, 1.0);
+    BasicDynamicConvexHull2D<double, Predicates> adaptive_convex_hull;
+    DynamicConvexHull2D tolerance_convex_hull;
+    std::vector<Point2D> real_points;
+    for (size_t step = 0; step < 20000; ++step) {
+        if (real_points.size() < 10 || generator() % 3 < 2) {
+            Point2D point{real_distribution(generator), real_distribution(generator)};
+            adaptive_convex_hull.Insert(point);
+            tolerance_convex_hull.Insert(point);
+            real_points.push_back(point);
+        } else {
+            size_t index = generator() % real_points.size();
+            adaptive_convex_hull.Erase(real_points[index]);
+            tolerance_convex_hull.Erase(real_points[index]);
+            real_points[index] = real_points.back();
+            real_points.pop_back();
+        }
+        if (step % 1000 == 0) {
+            EXPECT_EQ(adaptive_convex_hull.GetConvexHull(), GetConvexHullByMonotoneChain<Predicates>(real_points));
+            EXPECT_EQ(tolerance_convex_hull.GetConvexHull(), GetConvexHullByMonotoneChain(real_points));
+        }
+    }
+    EXPECT_EQ(adaptive_convex_hull.GetConvexHull(), GetConvexHullByMonotoneChain<Predicates>(real_points));
+    EXPECT_EQ(adaptive_convex_hull.GetTangents({0, 0}), std::nullopt);
+    EXPECT_EQ(*adaptive_convex_hull.GetExtremePoint({1, 0}),
+              *std::max_element(real_points.begin(), real_points.end(), [](const Point2D& a, const Point2D& b) {
+                  return a.coords[0] < b.coords[0];
+              }));
+}
+
+TEST_F(ConvexHullTest, SlidingWindowHullTest) {
+    using IntPoint = BasicPoint2D<int32_t>;
+    using Predicates = euclid::algorithm::util::AdaptivePredicates;
+    std::mt19937 generator(21);
+    // a small grid, for many coincident and collinear points
+    std::uniform_int_distribution<int32_t> distribution(-12, 12);
+    BasicSlidingWindowHull2D<int32_t, Predicates> sliding_window_hull;
+    EXPECT_FALSE(sliding_window_hull.PopFront());
+    std::vector<IntPoint> points;
+    size_t first = 0;
+    for (size_t step = 0; step < 4000; ++step) {
+        // the window grows and shrinks in phases, so that both halves run empty at various sizes
+        const bool is_growing = (step / 500) % 2 == 0;
+        if (first == points.size() || generator() % 5 < (is_growing ? 4u : 1u)) {
+            IntPoint point{distribution(generator), distribution(generator)};
+            sliding_window_hull.PushBack(point);
+            points.push_back(point);
+        } else {
+            EXPECT_EQ(sliding_window_hull.Front(), points[first]);
+            EXPECT_TRUE(sliding_window_hull.PopFront());
+            first++;
+        }
+        std::vector<IntPoint> window(points.begin() + static_cast<std::ptrdiff_t>(first), points.end());
+        ASSERT_EQ(sliding_window_hull.Size(), window.size());
+        if (step % 3 == 0) {
+            ASSERT_EQ(sliding_window_hull.GetConvexHull(), GetConvexHullByMonotoneChain<Predicates>(window));
+        }
+
+        IntPoint direction{distribution(generator), distribution(generator)};
+        auto Dot = [&direction](const IntPoint& point) {
+            return int64_t{direction.coords[0]} * point.coords[0] + int64_t{direction.coords[1]} * point.coords[1];
+        };
+        auto extreme_point = sliding_window_hull.GetExtremePoint(direction);
+        ASSERT_EQ(extreme_point.has_value(), !window.empty());
+        if (extreme_point) {
+            int64_t max_dot = Dot(window[0]);
+            for (const auto& point : window) {
+                max_dot = std::max(max_dot, Dot(point));
+            }
+            EXPECT_EQ(Dot(*extreme_point), max_dot);
+        }
+
+        // the tangent points are the neighbours of the query point on the hull including it
+        IntPoint query{distribution(generator) * 2, distribution(generator) * 2};
+        auto tangents = sliding_window_hull.GetTangents(query);
+        auto with_query = window;
+        with_query.push_back(query);
+        auto convex_hull_points = GetConvexHullByMonotoneChain<Predicates>(with_query);
+        auto found = std::find(convex_hull_points.begin(), convex_hull_points.end(), query);
+        if (convex_hull_points.empty()) {
+            continue;
+        }
+        if (found == convex_hull_points.end() || std::find(window.begin(), window.end(), query) != window.end()) {
+            EXPECT_FALSE(tangents.has_value());
+            continue;
+        }
+        ASSERT_TRUE(tangents.has_value());
+        size_t index = static_cast<size_t>(found - convex_hull_points.begin());
+        size_t size = convex_hull_points.size();
+        EXPECT_EQ(tangents->first, convex_hull_points[(index + size - 1) % size]);
+        EXPECT_EQ(tangents->second, convex_hull_points[(index + 1) % size]);
+    }
+    while (sliding_window_hull.PopFront()) {
+    }
+    EXPECT_TRUE(sliding_window_hull.Empty());
+    EXPECT_TRUE(sliding_window_hull.GetConvexHull().empty());
+    EXPECT_FALSE(sliding_window_hull.GetExtremePoint({1, 0}).has_value());
+    sliding_window_hull.PushBack({1, 1});
+    sliding_window_hull.Clear();
+    EXPECT_TRUE(sliding_window_hull.Empty());
+
+    // a window of fixed length over floating-point coordinates, checked against the monotone chain
+    std::uniform_real_distribution<double> real_distribution(-1.0, 1.0);
+    BasicSlidingWindowHull2D<double, Predicates> adaptive_hull;
+    SlidingWindowHull2D tolerance_hull;
+    std::vector<Point2D> real_points;
+    for (size_t step = 0; step < 20000; ++step) {
+        Point2D point{real_distribution(generator), real_distribution(generator)};
+        adaptive_hull.PushBack(point);
+        tolerance_hull.PushBack(point);
+        real_points.push_back(point);
+        if (real_points.size() > 300) {
+            adaptive_hull.PopFront();
+            tolerance_hull.PopFront();
+        }
+        if (step % 1000 == 0) {
+            std::vector<Point2D> window(real_points.end() - static_cast<std::ptrdiff_t>(adaptive_hull.Size()),
+                                        real_points.end());
+            EXPECT_EQ(adaptive_hull.GetConvexHull(), GetConvexHullByMonotoneChain<Predicates>(window));
+            EXPECT_EQ(tolerance_hull.GetConvexHull(), GetConvexHullByMonotoneChain(window));
+        }
+    }
+}
+
+TEST_F(ConvexHullTest, GetConvexHullByMelkmanTest) {
+    using IntPoint = BasicPoint2D<int32_t>;
+    using Predicates = euclid::algorithm::util::AdaptivePredicates;
+    std::mt19937 generator(22);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    // star-shaped polygons, starting at any vertex and in both orientations
+    for (size_t size : {3, 4, 10, 100, 5000}) {
+        std::vector<double> angles(size);
+        for (auto& angle : angles) {
+            angle = 2.0 * std::numbers::pi * distribution(generator);
+        }
+        std::sort(angles.begin(), angles.end());
+        std::vector<Point2D> polygon;
+        for (double angle : angles) {
+            double radius = 0.2 + distribution(generator);
+            polygon.push_back({radius * std::cos(angle), radius * std::sin(angle)});
+        }
+        std::rotate(polygon.begin(), polygon.begin() + static_cast<std::ptrdiff_t>(size / 3), polygon.end());
+        auto expected_points = GetConvexHullByMonotoneChain<Predicates>(polygon);
+        EXPECT_EQ(GetConvexHullByMelkman<Predicates>(polygon), expected_points);
+        EXPECT_EQ(GetConvexHullByMelkman(polygon), GetConvexHullByMonotoneChain(polygon));
+        std::reverse(polygon.begin(), polygon.end());
+        EXPECT_EQ(GetConvexHullByMelkman<Predicates>(polygon), expected_points);
+    }
+
+    // a spiral, whose hull changes at both ends of the deque
+    std::vector<Point2D> spiral;
+    for (size_t i = 0; i < 2000; ++i) {
+        double angle = 0.05 * static_cast<double>(i);
+        spiral.push_back({angle * std::cos(angle), angle * std::sin(angle)});
+    }
+    EXPECT_EQ(GetConvexHullByMelkman<Predicates>(spiral), GetConvexHullByMonotoneChain<Predicates>(spiral));
+
+    // an x-monotone polyline on a grid starting with a collinear run and repeating vertices, every prefix checked
+    std::vector<IntPoint> polyline = {{0, 0}, {1, 0}, {1, 0}, {2, 0}, {3, 0}};
+    std::uniform_int_distribution<int32_t> int_distribution(-6, 6);
+    for (int32_t x = 4; x < 300; ++x) {
+        polyline.push_back({x, int_distribution(generator)});
+        if (generator() % 4 == 0) {
+            polyline.push_back(polyline.back());
+        }
+    }
+    BasicMelkmanConvexHull<int32_t, Predicates> melkman_convex_hull;
+    std::vector<IntPoint> convex_hull_points;
+    for (size_t i = 0; i < polyline.size(); ++i) {
+        melkman_convex_hull.Add(polyline[i]);
+        ASSERT_EQ(melkman_convex_hull.NumPoints(), i + 1);
+        std::vector<IntPoint> prefix(polyline.begin(), polyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        melkman_convex_hull.GetConvexHull(convex_hull_points);
+        ASSERT_EQ(convex_hull_points, GetConvexHullByMonotoneChain<Predicates>(prefix));
+    }
+
+    // fed from an iterator range in pieces
+    MelkmanConvexHull iterator_convex_hull;
+    iterator_convex_hull.Add(spiral.begin(), spiral.begin() + 700);
+    iterator_convex_hull.Add(std::span<const Point2D>(spiral).subspan(700));
+    EXPECT_EQ(iterator_convex_hull.GetConvexHull(), GetConvexHullByMelkman(spiral));
+
+    // degenerate inputs
+    EXPECT_TRUE(GetConvexHullByMelkman(std::vector<Point2D>{}).empty());
+    EXPECT_TRUE(GetConvexHullByMelkman(std::vector<Point2D>{{0, 0}, {1, 1}}).empty());
+    EXPECT_TRUE(GetConvexHullByMelkman(std::vector<Point2D>{{0, 0}, {1, 1}, {2, 2}, {3, 3}}).empty());
+    iterator_convex_hull.Clear();
+    EXPECT_EQ(iterator_convex_hull.NumPoints(), 0u);
+    EXPECT_TRUE(iterator_convex_hull.GetConvexHull().empty());
+    iterator_convex_hull.Add(points1_);
+    EXPECT_EQ(iterator_convex_hull.GetConvexHull(), expected_points1_);
+}
+
+namespace {
+
+// The distance from a point to a convex polygon in counter-clockwise order, 0 inside.
+double GetDistanceToConvexPolygon(const Point2D& point, const std::vector<Point2D>& polygon) {
+    double distance = std::numeric_limits<double>::infinity();
+    bool is_inside = polygon.size() >= 3;
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        const auto& p = polygon[i];
+        const auto& q = polygon[(i + 1) % polygon.size()];
+        const double dx = q.coords[0] - p.coords[0];
+        const double dy = q.coords[1] - p.coords[1];
+        const double px = point.coords[0] - p.coords[0];
+        const double py = point.coords[1] - p.coords[1];
+        if (dx * py - dy * px < 0) {
+            is_inside = false;
+        }
+        const double t = std::clamp((dx * px + dy * py) / (dx * dx + dy * dy), 0.0, 1.0);
+        distance = std::min(distance, std::hypot(px - t * dx, py - t * dy));
+    }
+    return is_inside ? 0.0 : distance;
+}
+
+// Checks that an approximate hull is a hull of input points within its error bound of every exact hull vertex.
+void ExpectApproximateConvexHull(const ApproximateConvexHull2D& convex_hull, const std::vector<Point2D>& points) {
+    using Predicates = euclid::algorithm::util::AdaptivePredicates;
+    ASSERT_GE(convex_hull.points.size(), 3u);
+    EXPECT_EQ(GetConvexHullByMonotoneChain<Predicates>(convex_hull.points), convex_hull.points);
+    for (const auto& vertex : convex_hull.points) {
+        EXPECT_NE(std::find(points.begin(), points.end(), vertex), points.end());
+    }
+    for (const auto& vertex : GetConvexHullByMonotoneChain<Predicates>(points)) {
+        EXPECT_LE(GetDistanceToConvexPolygon(vertex, convex_hull.points), convex_hull.error_bound + 1e-12);
+    }
+}
+
+}  // namespace
+
+TEST_F(ConvexHullTest, GetApproximateConvexHullTest) {
+    using Predicates = euclid::algorithm::util::AdaptivePredicates;
+    std::mt19937 generator(23);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    // a disk, whose hull has many vertices, spanning several blocks
+    std::vector<Point2D> points(100000);
+    for (auto& point : points) {
+        double radius = std::sqrt(distribution(generator));
+        double angle = 2.0 * std::numbers::pi * distribution(generator);
+        point = {3.0 + 2.0 * radius * std::cos(angle), -1.0 + radius * std::sin(angle)};
+    }
+    euclid::util::ThreadPool thread_pool(3);
+    euclid::util::ThreadPool single_thread_pool(1);
+
+    for (size_t num_directions : {0, 3, 8, 64, 256}) {
+        auto convex_hull = GetApproximateConvexHullByDirections<Predicates>(points, num_directions, thread_pool);
+        ExpectApproximateConvexHull(convex_hull, points);
+        EXPECT_LE(convex_hull.points.size(), std::max<size_t>(num_directions, 3));
+        // the diameter is below 4
+        EXPECT_LE(convex_hull.error_bound, 4.0 * std::tan(std::numbers::pi / std::max<double>(num_directions, 3)) / 2);
+        auto single_thread_convex_hull =
+            GetApproximateConvexHullByDirections<Predicates>(points, num_directions, single_thread_pool);
+        EXPECT_EQ(single_thread_convex_hull.points, convex_hull.points);
+        EXPECT_EQ(single_thread_convex_hull.error_bound, convex_hull.error_bound);
+    }
+    for (double tolerance : {1.0, 0.1, 0.001}) {
+        auto convex_hull = GetApproximateConvexHullByGrid<Predicates>(points, tolerance, thread_pool);
+        ExpectApproximateConvexHull(convex_hull, points);
+        EXPECT_LE(convex_hull.error_bound, tolerance);
+        EXPECT_LE(convex_hull.points.size(), 2 * static_cast<size_t>(std::ceil(4.0 / tolerance)));
+        EXPECT_EQ(GetApproximateConvexHullByGrid<Predicates>(points, tolerance, single_thread_pool).points,
+                  convex_hull.points);
+    }
+    // columns as many as the points, or no tolerance, give the exact hull
+    for (double tolerance : {1e-9, 0.0}) {
+        auto convex_hull = GetApproximateConvexHullByGrid<Predicates>(points, tolerance, thread_pool);
+        EXPECT_EQ(convex_hull.points, GetConvexHullByMonotoneChain<Predicates>(points));
+        EXPECT_EQ(convex_hull.error_bound, 0.0);
+    }
+
+    // Small non-integer inputs, whose octagon vertices round to their edges or not, with few hull vertices.
+    std::uniform_int_distribution<int> grid_distribution(-10, 10);
+    for (size_t size = 3; size < 200; ++size) {
+        std::vector<Point2D> grid_points(size);
+        for (auto& point : grid_points) {
+            const double x = grid_distribution(generator);
+            const double y = grid_distribution(generator);
+            point = {0.1 * x + 0.3 * y, 0.7 * y};
+        }
+        std::vector<Point2D> candidates;
+        std::vector<size_t> indices;
+        FilterByOctagon(std::span<const Point2D>(grid_points), candidates, indices);
+        size_t extreme_indices[kNumOctagonDirections];
+        FindOctagonExtremeIndices(grid_points.data(), grid_points.size(), extreme_indices);
+        for (size_t index : extreme_indices) {
+            EXPECT_TRUE(std::binary_search(indices.begin(), indices.end(), index)) << size;
+        }
+        for (size_t num_directions : {4, 8, 16}) {
+            auto convex_hull =
+                GetApproximateConvexHullByDirections<Predicates>(grid_points, num_directions, thread_pool);
+            if (convex_hull.points.size() >= 3) {
+                ExpectApproximateConvexHull(convex_hull, grid_points);
+            }
+        }
+    }
+
+    // integer coordinates and degenerate inputs
+    std::vector<BasicPoint2D<int32_t>> int_points = {{0, 0}, {10, 0}, {10, 10}, {0, 10}, {5, 5}, {5, 0}};
+    auto int_convex_hull = GetApproximateConvexHullByDirections(int_points, 8, thread_pool);
+    EXPECT_EQ(int_convex_hull.points, GetConvexHullByMonotoneChain(int_points));
+    EXPECT_EQ(int_convex_hull.error_bound, 10.0 * std::tan(std::numbers::pi / 8) / 2);
+    EXPECT_EQ(GetApproximateConvexHullByGrid(int_points, 4.0, thread_pool).points,
+              GetConvexHullByMonotoneChain(int_points));
+    EXPECT_TRUE(GetApproximateConvexHullByDirections(std::vector<Point2D>{}, 8, thread_pool).points.empty());
+    EXPECT_TRUE(GetApproximateConvexHullByGrid(std::vector<Point2D>{}, 0.1, thread_pool).points.empty());
+    std::vector<Point2D> vertical = {{1, 0}, {1, 1}, {1, 2}};
+    auto vertical_convex_hull = GetApproximateConvexHullByGrid(vertical, 0.1, thread_pool);
+    EXPECT_TRUE(vertical_convex_hull.points.empty());
+    EXPECT_EQ(vertical_convex_hull.error_bound, 0.0);
+}
+
+TEST_F(ConvexHullTest, GetConvexHullByStreamingTest) {
+    using Predicates = euclid::algorithm::util::AdaptivePredicates;
+    std::mt19937 generator(19);
+    std::uniform_real_distribution<double> distribution(-1e3, 1e3);
+    std::vector<Point2D> points(100000);
+    for (auto& point : points) {
+        point = {distribution(generator), distribution(generator)};
+    }
+    auto expected_points = GetConvexHullByMonotoneChain<Predicates>(points);
+
+    BasicStreamingConvexHull<double, Predicates> streaming_convex_hull;
+    for (size_t begin = 0; begin < points.size(); begin += 4099) {
+        const size_t count = std::min<size_t>(4099, points.size() - begin);
+        streaming_convex_hull.Add(std::span<const Point2D>(points).subspan(begin, count));
+    }
+    EXPECT_EQ(streaming_convex_hull.NumPoints(), points.size());
+    EXPECT_EQ(streaming_convex_hull.GetConvexHull(), expected_points);
+    EXPECT_EQ(GetConvexHullByStreaming<Predicates>(points.begin(), points.end(), 1000), expected_points);
+    EXPECT_EQ(GetConvexHullByStreaming(points.begin(), points.end()), GetConvexHullByMonotoneChain(points));
+    // chunks of collinear points only
+    EXPECT_EQ(GetConvexHullByStreaming(points1_.begin(), points1_.end(), 2), expected_points1_);
+    EXPECT_TRUE(GetConvexHullByStreaming(points1_.begin(), points1_.begin() + 2).empty());
+
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto double_path = (directory / "euclid_streaming_test_double.bin").string();
+    const auto float_path = (directory / "euclid_streaming_test_float.bin").string();
+    std::vector<float> float_coordinates;
+    {
+        std::ofstream double_file(double_path, std::ios::binary);
+        std::ofstream float_file(float_path, std::ios::binary);
+        for (const auto& point : points) {
+            double_file.write(reinterpret_cast<const char*>(point.coords), sizeof(point.coords));
+            float coords[2] = {static_cast<float>(point.coords[0]), static_cast<float>(point.coords[1])};
+            float_file.write(reinterpret_cast<const char*>(coords), sizeof(coords));
+            float_coordinates.insert(float_coordinates.end(), coords, coords + 2);
+        }
+    }
+    std::vector<Point2D> convex_hull_points;
+    EXPECT_TRUE(GetConvexHullOfPointFile<Predicates>(double_path.c_str(), PointFileFormat::kDouble, convex_hull_points,
+                                                     3000));
+    EXPECT_EQ(convex_hull_points, expected_points);
+
+    std::vector<Point2D> float_points(points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        float_points[i] = {float_coordinates[2 * i], float_coordinates[2 * i + 1]};
+    }
+    EXPECT_TRUE(GetConvexHullOfPointFile<Predicates>(float_path.c_str(), PointFileFormat::kFloat, convex_hull_points));
+    EXPECT_EQ(convex_hull_points, GetConvexHullByMonotoneChain<Predicates>(float_points));
+    std::vector<BasicPoint2D<float>> float_convex_hull_points;
+    EXPECT_TRUE(GetConvexHullOfPointFile<Predicates>(float_path.c_str(), PointFileFormat::kFloat,
+                                                     float_convex_hull_points, 5000));
+    EXPECT_EQ(float_convex_hull_points.size(), convex_hull_points.size());
+
+    // 12 bytes hold no whole number of double points
+    std::filesystem::resize_file(float_path, 12);
+    EXPECT_FALSE(GetConvexHullOfPointFile(float_path.c_str(), PointFileFormat::kDouble, convex_hull_points));
+    std::filesystem::resize_file(float_path, 0);
+    EXPECT_TRUE(GetConvexHullOfPointFile(float_path.c_str(), PointFileFormat::kFloat, convex_hull_points));
+    EXPECT_TRUE(convex_hull_points.empty());
+    std::filesystem::remove(double_path);
+    std::filesystem::remove(float_path);
+    EXPECT_FALSE(GetConvexHullOfPointFile(double_path.c_str(), PointFileFormat::kDouble, convex_hull_points));
+}
@@ -0,0 +1,239 @@
+/**
+ * @file convex_polygon_test.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_polygon/batch.h"
+#include "algorithm/convex_polygon/intersection.h"
+#include "algorithm/convex_polygon/minkowski_sum.h"
+#include "algorithm/util/location.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/point_2d.h"
+#include "util/thread_pool.h"
+
+using namespace euclid::geometry;
+using namespace euclid::algorithm::convex_polygon;
+using euclid::algorithm::convex_hull::GetConvexHullByMonotoneChain;
+
+namespace {
+
+double GetArea(const std::vector<Point2D>& polygon) {
+    double area = 0;
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        const auto& p = polygon[i];
+        const auto& q = polygon[(i + 1) % polygon.size()];
+        area += p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0];
+    }
+    return area / 2;
+}
+
+/**
+ * @brief Clips a convex polygon by every edge of another one, the O(n * m) Sutherland-Hodgman algorithm.
+ */
+std::vector<Point2D> ClipPolygon(const std::vector<Point2D>& polygon, const std::vector<Point2D>& clip) {
+    std::vector<Point2D> output = polygon;
+    for (size_t i = 0; i < clip.size() && !output.empty(); ++i) {
+        const auto& a = clip[i];
+        const auto& b = clip[(i + 1) % clip.size()];
+        auto GetSide = [&](const Point2D& point) {
+            return (b.coords[0] - a.coords[0]) * (point.coords[1] - a.coords[1]) -
+                   (b.coords[1] - a.coords[1]) * (point.coords[0] - a.coords[0]);
+        };
+        std::vector<Point2D> input = std::move(output);
+        output.clear();
+        for (size_t j = 0; j < input.size(); ++j) {
+            const auto& p = input[j];
+            const auto& q = input[(j + 1) % input.size()];
+            double p_side = GetSide(p);
+            double q_side = GetSide(q);
+            if (p_side >= 0) {
+                output.push_back(p);
+            }
+            if ((p_side >= 0) != (q_side >= 0)) {
+                double t = p_side / (p_side - q_side);
+                output.push_back(
+                    {p.coords[0] + t * (q.coords[0] - p.coords[0]), p.coords[1] + t * (q.coords[1] - p.coords[1])});
+            }
+        }
+    }
+    return output;
+}
+
+std::vector<Point2D> GetRandomConvexPolygon(std::mt19937& generator, size_t num_points, double center_x,
+                                            double center_y, double radius) {
+    std::uniform_real_distribution<double> distribution(-radius, radius);
+    std::vector<Point2D> points;
+    for (size_t i = 0; i < num_points; ++i) {
+        points.push_back({center_x + distribution(generator), center_y + distribution(generator)});
+    }
+    return GetConvexHullByMonotoneChain(points);
+}
+
+}  // namespace
+
+class ConvexPolygonTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(ConvexPolygonTest, GetMinkowskiSumTest) {
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> size_distribution(3, 60);
+    for (int round = 0; round < 200; ++round) {
+        // Integer coordinates give many parallel edges, which are merged into one.
+        std::uniform_int_distribution<int> int_distribution(-5, 5);
+        std::vector<BasicPoint2D<int>> int_points[2];
+        for (auto& points : int_points) {
+            for (int i = 0; i < size_distribution(generator); ++i) {
+                points.push_back({int_distribution(generator), int_distribution(generator)});
+            }
+        }
+        auto first = GetConvexHullByMonotoneChain(int_points[0]);
+        auto second = GetConvexHullByMonotoneChain(int_points[1]);
+        if (first.empty() || second.empty()) {
+            continue;
+        }
+        std::vector<BasicPoint2D<int>> sum_points;
+        std::vector<BasicPoint2D<int>> difference_points;
+        for (const auto& p : first) {
+            for (const auto& q : second) {
+                sum_points.push_back({p.coords[0] + q.coords[0], p.coords[1] + q.coords[1]});
+                difference_points.push_back({p.coords[0] - q.coords[0], p.coords[1] - q.coords[1]});
+            }
+        }
+        EXPECT_EQ(GetMinkowskiSum(first, second), GetConvexHullByMonotoneChain(sum_points));
+        EXPECT_EQ(GetMinkowskiDifference(first, second), GetConvexHullByMonotoneChain(difference_points));
+        EXPECT_EQ(GetMinkowskiSum<euclid::algorithm::util::AdaptivePredicates>(first, second),
+                  GetConvexHullByMonotoneChain(sum_points));
+    }
+
+    // A polygon not starting at its lowest vertex.
+    std::vector<Point2D> square = {{1, 1}, {0, 1}, {0, 0}, {1, 0}};
+    std::vector<Point2D> triangle = {{0, 0}, {1, 0}, {0, 1}};
+    EXPECT_EQ(GetMinkowskiSum(square, triangle), (std::vector<Point2D>{{0, 0}, {2, 0}, {2, 1}, {1, 2}, {0, 2}}));
+    EXPECT_EQ(GetMinkowskiDifference(square, triangle),
+              (std::vector<Point2D>{{0, -1}, {1, -1}, {1, 1}, {-1, 1}, {-1, 0}}));
+    EXPECT_TRUE(GetMinkowskiSum(square, std::vector<Point2D>{{0, 0}, {1, 1}}).empty());
+
+    // Short edges at right angles, whose cross products are below the tolerance.
+    const double s = std::ldexp(1.0, -14);
+    std::vector<Point2D> small_square = {{s, s}, {0, s}, {0, 0}, {s, 0}};
+    std::vector<Point2D> small_triangle = {{0, 0}, {s, 0}, {0, s}};
+    EXPECT_EQ(GetMinkowskiSum(small_square, small_triangle),
+              (std::vector<Point2D>{{0, 0}, {2 * s, 0}, {2 * s, s}, {s, 2 * s}, {0, 2 * s}}));
+}
+
+TEST_F(ConvexPolygonTest, GetIntersectionTest) {
+    std::mt19937 generator(18);
+    std::uniform_int_distribution<size_t> size_distribution(3, 100);
+    std::uniform_real_distribution<double> center_distribution(-1.5, 1.5);
+    for (int round = 0; round < 500; ++round) {
+        auto first = GetRandomConvexPolygon(generator, size_distribution(generator), 0, 0, 1);
+        auto second = GetRandomConvexPolygon(generator, size_distribution(generator), center_distribution(generator),
+                                             center_distribution(generator), 1);
+        auto intersection_points = GetIntersection(first, second);
+        auto exact_points = GetIntersection<euclid::algorithm::util::AdaptivePredicates>(first, second);
+        auto expected = ClipPolygon(first, second);
+        double expected_area = expected.size() < 3 ? 0.0 : GetArea(expected);
+        // Corners closer than the tolerance to the line of their neighbours are dropped.
+        EXPECT_NEAR(GetArea(intersection_points), expected_area, 1e-5);
+        EXPECT_NEAR(GetArea(exact_points), expected_area, 1e-9);
+        if (expected_area > 1e-6) {
+            ASSERT_GE(intersection_points.size(), 3);
+            // convex, counter-clockwise and from the lowest then leftest vertex
+            const size_t size = intersection_points.size();
+            for (size_t i = 0; i < size; ++i) {
+                const auto& vertex = intersection_points[i];
+                EXPECT_TRUE(euclid::algorithm::util::IsTurnLeft(vertex, intersection_points[(i + 1) % size],
+                                                                intersection_points[(i + 2) % size]));
+                EXPECT_FALSE(euclid::algorithm::util::IsLowerThenLefter(vertex, intersection_points[0]));
+            }
+            // The tolerance on the cross product moves corners next to short edges by more than the tolerance, the
+            // exact corners lie inside both polygons.
+            for (const auto& vertex : exact_points) {
+                for (const auto* polygon : {&first, &second}) {
+                    for (size_t i = 0; i < polygon->size(); ++i) {
+                        EXPECT_GE(euclid::algorithm::util::GetCrossValue((*polygon)[i],
+                                                                         (*polygon)[(i + 1) % polygon->size()], vertex),
+                                  -1e-9);
+                    }
+                }
+            }
+        }
+    }
+
+    // contained, disjoint, sharing an edge, touching at a vertex and sharing edges of the same direction
+    std::vector<Point2D> square = {{0, 0}, {4, 0}, {4, 4}, {0, 4}};
+    std::vector<Point2D> inner = {{1, 1}, {2, 1}, {1, 2}};
+    EXPECT_EQ(GetIntersection(square, inner), inner);
+    EXPECT_EQ(GetIntersection(inner, square), inner);
+    EXPECT_TRUE(GetIntersection(square, std::vector<Point2D>{{5, 0}, {6, 0}, {6, 1}}).empty());
+    EXPECT_TRUE(GetIntersection(square, std::vector<Point2D>{{4, 0}, {8, 0}, {8, 4}, {4, 4}}).empty());
+    EXPECT_TRUE(GetIntersection(square, std::vector<Point2D>{{4, 4}, {5, 4}, {5, 5}}).empty());
+    EXPECT_EQ(GetIntersection(square, std::vector<Point2D>{{2, 0}, {6, 0}, {6, 4}, {2, 4}}),
+              (std::vector<Point2D>{{2, 0}, {4, 0}, {4, 4}, {2, 4}}));
+    EXPECT_EQ(GetIntersection(square, square), square);
+    EXPECT_TRUE(GetIntersection(square, std::vector<Point2D>{{0, 0}, {1, 1}}).empty());
+}
+
+TEST_F(ConvexPolygonTest, BatchTest) {
+    std::mt19937 generator(19);
+    std::uniform_int_distribution<size_t> size_distribution(3, 40);
+    std::uniform_real_distribution<double> center_distribution(-3, 3);
+    std::vector<Point2D> polygon_points;
+    std::vector<size_t> polygon_offsets = {0};
+    for (int polygon = 0; polygon < 100; ++polygon) {
+        auto points = GetRandomConvexPolygon(generator, size_distribution(generator), center_distribution(generator),
+                                             center_distribution(generator), 1);
+        polygon_points.insert(polygon_points.end(), points.begin(), points.end());
+        polygon_offsets.push_back(polygon_points.size());
+    }
+    std::uniform_int_distribution<size_t> polygon_distribution(0, 99);
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (int pair = 0; pair < 300; ++pair) {
+        pairs.emplace_back(polygon_distribution(generator), polygon_distribution(generator));
+    }
+    auto GetPolygon = [&](size_t polygon) {
+        return std::vector<Point2D>(polygon_points.begin() + polygon_offsets[polygon],
+                                    polygon_points.begin() + polygon_offsets[polygon + 1]);
+    };
+
+    for (size_t num_threads : {1, 3}) {
+        euclid::util::ThreadPool thread_pool(num_threads);
+        std::vector<Point2D> result_points;
+        std::vector<size_t> result_offsets;
+        auto ExpectResults = [&](auto Operation) {
+            ASSERT_EQ(result_offsets.size(), pairs.size() + 1);
+            EXPECT_EQ(result_offsets.back(), result_points.size());
+            for (size_t pair = 0; pair < pairs.size(); ++pair) {
+                EXPECT_EQ(std::vector<Point2D>(result_points.begin() + result_offsets[pair],
+                                               result_points.begin() + result_offsets[pair + 1]),
+                          Operation(GetPolygon(pairs[pair].first), GetPolygon(pairs[pair].second)));
+            }
+        };
+        GetIntersections(polygon_points, polygon_offsets, pairs, result_points, result_offsets, thread_pool);
+        ExpectResults([](const auto& first, const auto& second) { return GetIntersection(first, second); });
+        GetMinkowskiSums(polygon_points, polygon_offsets, pairs, result_points, result_offsets, thread_pool);
+        ExpectResults([](const auto& first, const auto& second) { return GetMinkowskiSum(first, second); });
+        GetMinkowskiDifferences(polygon_points, polygon_offsets, pairs, result_points, result_offsets, thread_pool);
+        ExpectResults([](const auto& first, const auto& second) { return GetMinkowskiDifference(first, second); });
+        GetIntersections(polygon_points, polygon_offsets, {}, result_points, result_offsets, thread_pool);
+        EXPECT_TRUE(result_points.empty());
+        EXPECT_EQ(result_offsets, std::vector<size_t>{0});
+    }
+}
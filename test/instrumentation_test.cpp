@@ -0,0 +1,118 @@
+/**
+ * @file instrumentation_test.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithm/convex_hull/chan.h"
+#include "algorithm/convex_hull/extreme_edge.h"
+#include "algorithm/convex_hull/graham_scan.h"
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/convex_hull/quick_hull.h"
+#include "algorithm/convex_hull/workspace.h"
+#include "geometry/point_2d.h"
+#include "util/instrumentation.h"
+
+using namespace euclid::algorithm::convex_hull;
+using namespace euclid::geometry;
+using euclid::util::GetHullStats;
+using euclid::util::HullPhase;
+using euclid::util::HullStats;
+using euclid::util::kInstrumentationEnabled;
+
+class InstrumentationTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 generator(7);
+        std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+        for (size_t i = 0; i < 1000; ++i) {
+            points_.push_back({distribution(generator), distribution(generator)});
+        }
+    }
+
+    void TearDown() override { euclid::util::SetHullStatsExporter(nullptr); }
+
+    std::vector<Point2D> points_;
+};
+
+TEST_F(InstrumentationTest, CountersTest) {
+    GetConvexHullByGrahamScan(points_);
+    const HullStats graham_stats = GetHullStats();
+    GetConvexHullByMonotoneChain(points_);
+    const HullStats monotone_stats = GetHullStats();
+    if constexpr (!kInstrumentationEnabled) {
+        EXPECT_EQ(graham_stats.algorithm, nullptr);
+        EXPECT_EQ(graham_stats.turn_left_calls, 0u);
+        EXPECT_EQ(graham_stats.sort_comparisons, 0u);
+        EXPECT_EQ(monotone_stats.total_time.count(), 0);
+        return;
+    }
+    EXPECT_EQ(std::string(graham_stats.algorithm), "graham_scan");
+    // every point is pushed once and popped at most once, each push or pop follows one turn test
+    EXPECT_GE(graham_stats.turn_left_calls, points_.size() - 2);
+    EXPECT_LE(graham_stats.turn_left_calls, 2 * points_.size());
+    EXPECT_GT(graham_stats.graham_scan_pops, 0u);
+    EXPECT_GE(graham_stats.sort_comparisons, points_.size());
+    EXPECT_GT(graham_stats.PhaseTime(HullPhase::kSort).count(), 0);
+    EXPECT_GT(graham_stats.PhaseTime(HullPhase::kScan).count(), 0);
+    EXPECT_GE(graham_stats.total_time,
+              graham_stats.PhaseTime(HullPhase::kSort) + graham_stats.PhaseTime(HullPhase::kScan));
+
+    // the stats belong to the last call only
+    EXPECT_EQ(std::string(monotone_stats.algorithm), "monotone_chain");
+    EXPECT_EQ(monotone_stats.graham_scan_pops, 0u);
+    EXPECT_GE(monotone_stats.turn_left_calls, 2 * (points_.size() - 2));
+
+    // the Quickhull calls of the groups add to the stats of Chan's algorithm
+    GetConvexHullByChan(points_);
+    EXPECT_EQ(std::string(GetHullStats().algorithm), "chan");
+    EXPECT_EQ(GetHullStats().graham_scan_pops, 0u);
+    EXPECT_GT(GetHullStats().orientation_calls, 0u);
+    EXPECT_GT(GetHullStats().PhaseTime(HullPhase::kScan).count(), 0);
+
+    std::vector<Point2D> duplicated = {{0, 0}, {1, 0}, {1, 1}, {0, 1}, {1, 0}, {0, 0}, {0.5, 0.5}};
+    GetConvexHullByExtremeEdge(duplicated);
+    // 2 copies in the input, then the 8 endpoints of the 4 extreme edges reduce to 4 vertices
+    EXPECT_EQ(GetHullStats().removed_coincide_points, 6u);
+    EXPECT_GT(GetHullStats().collinear_calls, 0u);
+    EXPECT_GT(GetHullStats().PhaseTime(HullPhase::kRemoveCoincidePoints).count(), 0);
+}
+
+TEST_F(InstrumentationTest, ExporterTest) {
+    static std::vector<std::string> exported;
+    exported.clear();
+    euclid::util::SetHullStatsExporter([](const HullStats& stats) { exported.push_back(stats.algorithm); });
+    GetConvexHullByQuickHull(points_);
+    GetConvexHullByChan(points_);
+    if constexpr (kInstrumentationEnabled) {
+        // nested calls are not exported on their own
+        EXPECT_EQ(exported, (std::vector<std::string>{"quick_hull", "chan"}));
+    } else {
+        EXPECT_TRUE(exported.empty());
+    }
+}
+
+TEST_F(InstrumentationTest, AllocationTest) {
+    euclid::util::InstrumentedMemoryResource resource;
+    HullWorkspace workspace(&resource);
+    std::vector<Point2D> convex_hull_points(points_.size());
+    GetConvexHullByQuickHull(points_, convex_hull_points, workspace);
+    if constexpr (kInstrumentationEnabled) {
+        EXPECT_GT(GetHullStats().allocations, 0u);
+        EXPECT_GE(GetHullStats().allocated_bytes, points_.size() * sizeof(Point2D));
+    } else {
+        EXPECT_EQ(GetHullStats().allocations, 0u);
+    }
+    // the workspace has grown, the second call does not allocate
+    GetConvexHullByQuickHull(points_, convex_hull_points, workspace);
+    EXPECT_EQ(GetHullStats().allocations, 0u);
+}
@@ -6,9 +6,29 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "algorithm/util/batch_location.h"
+#include "algorithm/util/edge_equations.h"
+#include "algorithm/util/in_circle.h"
 #include "algorithm/util/location.h"
+#include "algorithm/util/orient_2d.h"
+#include "algorithm/util/predicates.h"
+#include "algorithm/util/sort.h"
+#include "geometry/convex_polygon_2d.h"
 #include "geometry/point_2d.h"
+#include "geometry/point_set_2d.h"
 #include "geometry/triangle_2d.h"
+#include "util/scalar_traits.h"
+#include "util/simd.h"
+#include "util/thread_pool.h"
 
 using namespace euclid::geometry;
 using namespace euclid::algorithm::util;
@@ -119,4 +139,556 @@ TEST_F(LocateTest, IsPointInTriangleTest) {
     Point2D vertex_point{0, 0};
     EXPECT_FALSE(IsPointInTriangle(vertex_point, triangle));
     EXPECT_FALSE(IsPointInTriangle(vertex_point, p1, p2, p3));
-}
\ No newline at end of file
+}
+
+TEST_F(LocateTest, BatchPredicatesTest) {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> coord_distribution(-20, 20);
+    std::vector<Point2D> points;
+    // Integer coordinates hit the collinear and on-segment cases often, the halves land close to the tolerance.
+    for (int i = 0; i < 1000; ++i) {
+        double x = coord_distribution(generator) * 0.5;
+        double y = coord_distribution(generator) * 0.5;
+        if (i % 7 == 0) {
+            y += 1e-7;
+        }
+        points.push_back({x, y});
+    }
+    PointSet2D point_set(points);
+    ASSERT_EQ(point_set.Size(), points.size());
+    EXPECT_EQ(point_set.ToPoints(), points);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(point_set.X()) % PointSet2D::kAlignment, 0u);
+
+    Point2D p{-3, -2};
+    Point2D q{4, 1.5};
+    Point2D r{-1, 5};
+    for (auto level : {euclid::util::SimdLevel::kScalar, euclid::util::SimdLevel::kAvx2,
+                       euclid::util::SimdLevel::kAvx512}) {
+        euclid::util::ScopedMaxSimdLevel max_simd_level(level);
+        for (size_t size : {0, 1, 63, 64, 65, 1000}) {
+            PointSet2D subset(std::vector<Point2D>(points.begin(), points.begin() + size));
+            std::vector<uint64_t> left_mask(GetNumMaskWords(size));
+            std::vector<uint64_t> collinear_mask(GetNumMaskWords(size));
+            std::vector<uint64_t> on_segment_mask(GetNumMaskWords(size));
+            std::vector<uint64_t> in_triangle_mask(GetNumMaskWords(size));
+            std::vector<int8_t> orientations(size);
+            IsTurnLeft(p, q, subset, left_mask.data());
+            ArePointsCollinear(p, points[5], subset, collinear_mask.data());
+            IsPointOnSegment(subset, p, q, on_segment_mask.data());
+            IsPointInTriangle(subset, Triangle2D{p, q, r}, in_triangle_mask.data());
+            GetOrientations(p, points[5], subset, orientations.data());
+            auto Bit = [](const std::vector<uint64_t>& mask, size_t i) {
+                return ((mask[i / 64] >> (i % 64)) & 1) != 0;
+            };
+            for (size_t i = 0; i < size; ++i) {
+                EXPECT_EQ(Bit(left_mask, i), IsTurnLeft(p, q, points[i]));
+                EXPECT_EQ(Bit(collinear_mask, i), ArePointsCollinear(p, points[5], points[i]));
+                EXPECT_EQ(Bit(on_segment_mask, i), IsPointOnSegment(points[i], p, q));
+                EXPECT_EQ(Bit(in_triangle_mask, i), IsPointInTriangle(points[i], p, q, r));
+                int expected = IsTurnLeft(p, points[5], points[i]) ? 1
+                               : ArePointsCollinear(p, points[5], points[i]) ? 0
+                                                                             : -1;
+                EXPECT_EQ(orientations[i], expected);
+            }
+            for (size_t i = size; i < GetNumMaskWords(size) * 64; ++i) {
+                EXPECT_FALSE(Bit(left_mask, i));
+                EXPECT_FALSE(Bit(collinear_mask, i));
+                EXPECT_FALSE(Bit(on_segment_mask, i));
+                EXPECT_FALSE(Bit(in_triangle_mask, i));
+            }
+        }
+    }
+}
+
+TEST_F(LocateTest, IsPointInClosedTriangleTest) {
+    // on the vertices and edges, and just off them
+    const Triangle2D triangle{{{0, 0}, {4, 0}, {0, 4}}};
+    EXPECT_TRUE(IsPointInClosedTriangle({1, 1}, triangle));
+    EXPECT_TRUE(IsPointInClosedTriangle({0, 0}, triangle));
+    EXPECT_TRUE(IsPointInClosedTriangle({2, 2}, triangle));
+    EXPECT_FALSE(IsPointInClosedTriangle({2, 2 + 1e-15}, triangle));
+    EXPECT_FALSE(IsPointInClosedTriangle({-1e-300, 1}, triangle));
+    EXPECT_TRUE(IsPointInClosedTriangle({1, 1}, Triangle2D{{{0, 0}, {0, 4}, {4, 0}}}));
+    EXPECT_FALSE(IsPointInClosedTriangle({1, 1}, Triangle2D{{{0, 0}, {1, 1}, {2, 2}}}));
+    EXPECT_EQ(GetTriangleLocation(GetTriangleEdgeEquations(triangle), {1, 1}), 1);
+    EXPECT_EQ(GetTriangleLocation(GetTriangleEdgeEquations(triangle), {5, 1}), -1);
+    EXPECT_EQ(GetTriangleLocation(GetTriangleEdgeEquations(triangle), {2, 2}), 0);
+
+    // Points of a fine grid around triangles with vertices on it, many on the edges, and random points.
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> coord_distribution(-1.0, 5.0);
+    std::vector<Point2D> points;
+    for (int i = -4; i <= 20; ++i) {
+        for (int j = -4; j <= 20; ++j) {
+            points.push_back({i * 0.25, j * 0.25});
+        }
+    }
+    for (size_t i = 0; i < 1000; ++i) {
+        points.push_back({coord_distribution(generator), coord_distribution(generator)});
+    }
+    const PointSet2D point_set(points);
+    const std::vector<Triangle2D> triangles = {triangle,
+                                               {{{4, 0}, {0, 0}, {0, 4}}},
+                                               {{{0.5, 0.25}, {3.75, 1.5}, {1.25, 4.75}}},
+                                               {{{0.1, 0.2}, {4.3, 0.7}, {2.9, 3.1}}},
+                                               {{{1, 1}, {2, 2}, {3, 3}}}};
+    for (auto level : {euclid::util::SimdLevel::kScalar, euclid::util::SimdLevel::kAvx2,
+                       euclid::util::SimdLevel::kAvx512}) {
+        euclid::util::ScopedMaxSimdLevel max_simd_level(level);
+        for (const auto& current_triangle : triangles) {
+            const auto equations = GetTriangleEdgeEquations(current_triangle);
+            std::vector<uint64_t> mask(GetNumMaskWords(points.size()));
+            IsPointInClosedTriangle(point_set, current_triangle, mask.data());
+            for (size_t i = 0; i < points.size(); ++i) {
+                const bool expected = IsPointInClosedTriangle(points[i], current_triangle);
+                EXPECT_EQ(((mask[i / 64] >> (i % 64)) & 1) != 0, expected);
+                const int location = GetTriangleLocation(equations, points[i]);
+                EXPECT_TRUE(location == 0 || (location > 0) == expected);
+            }
+            EXPECT_EQ(mask.back() >> (points.size() % 64), 0u);
+        }
+    }
+}
+
+TEST_F(LocateTest, Orient2DTest) {
+    EXPECT_GT(Orient2D({0, 0}, {1, 0}, {0, 1}), 0.0);
+    EXPECT_LT(Orient2D({0, 0}, {1, 0}, {0, -1}), 0.0);
+    EXPECT_EQ(Orient2D({0, 0}, {1, 1}, {2, 2}), 0.0);
+
+    // Points on a 256 x 256 grid of ulps around (0.5, 0.5) against the line y = x, the classic failure case of the
+    // plain floating-point determinant. p is left of q -> r exactly if p.y > p.x.
+    Point2D q{12, 12};
+    Point2D r{24, 24};
+    size_t num_left = 0;
+    size_t num_collinear = 0;
+    for (int i = 0; i < 256; ++i) {
+        for (int j = 0; j < 256; ++j) {
+            Point2D p{0.5 + std::ldexp(i, -53), 0.5 + std::ldexp(j, -53)};
+            int expected = (j > i) - (j < i);
+            double orientation = Orient2D(p, q, r);
+            EXPECT_EQ((orientation > 0.0) - (orientation < 0.0), expected);
+            EXPECT_EQ(AdaptivePredicates::GetOrientation(p, q, r), expected);
+            num_left += expected > 0;
+            num_collinear += expected == 0;
+        }
+    }
+    EXPECT_GT(num_left, 0u);
+    EXPECT_GT(num_collinear, 0u);
+
+    // Scaling by a power of two does not change an exact orientation.
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (int i = 0; i < 1000; ++i) {
+        Point2D a{distribution(generator), distribution(generator)};
+        Point2D b{distribution(generator), distribution(generator)};
+        Point2D c{a.coords[0] + (b.coords[0] - a.coords[0]) * 0.3, a.coords[1] + (b.coords[1] - a.coords[1]) * 0.3};
+        int expected = AdaptivePredicates::GetOrientation(a, b, c);
+        for (double scale : {0x1p-40, 0x1p40}) {
+            Point2D scaled_a{a.coords[0] * scale, a.coords[1] * scale};
+            Point2D scaled_b{b.coords[0] * scale, b.coords[1] * scale};
+            Point2D scaled_c{c.coords[0] * scale, c.coords[1] * scale};
+            EXPECT_EQ(AdaptivePredicates::GetOrientation(scaled_a, scaled_b, scaled_c), expected);
+        }
+    }
+}
+
+TEST_F(LocateTest, InCircleTest) {
+    EXPECT_GT(InCircle({0, 0}, {2, 0}, {0, 2}, {1, 1}), 0.0);
+    EXPECT_LT(InCircle({0, 0}, {2, 0}, {0, 2}, {3, 3}), 0.0);
+    EXPECT_LT(InCircle({0, 0}, {0, 2}, {2, 0}, {1, 1}), 0.0);
+    EXPECT_EQ(InCircle({5, 0}, {0, 5}, {-5, 0}, {3, -4}), 0.0);
+    EXPECT_EQ(InCircle({0, 0}, {1, 0}, {1, 1}, {0, 1}), 0.0);
+
+#if defined(__SIZEOF_INT128__)
+    // Integer coordinates below 2^20, scaled by a power of two and moved off the origin, against the exact integer
+    // determinant. The points are on or next to a common circle, so the filter often fails.
+    __extension__ using Int128 = __int128;
+    auto GetExpected = [](const int64_t (&points)[4][2]) {
+        Int128 rows[3][3];
+        for (int i = 0; i < 3; ++i) {
+            Int128 x = points[i][0] - points[3][0];
+            Int128 y = points[i][1] - points[3][1];
+            rows[i][0] = x;
+            rows[i][1] = y;
+            rows[i][2] = x * x + y * y;
+        }
+        Int128 det = rows[0][0] * (rows[1][1] * rows[2][2] - rows[2][1] * rows[1][2]) -
+                       rows[0][1] * (rows[1][0] * rows[2][2] - rows[2][0] * rows[1][2]) +
+                       rows[0][2] * (rows[1][0] * rows[2][1] - rows[2][0] * rows[1][1]);
+        return (det > 0) - (det < 0);
+    };
+    // The lattice points on the circle of radius 5^4 are exactly cocircular.
+    std::vector<std::array<int64_t, 2>> lattice_points;
+    for (int64_t x = -625; x <= 625; ++x) {
+        auto y = static_cast<int64_t>(std::llround(std::sqrt(390625.0 - static_cast<double>(x * x))));
+        if (x * x + y * y == 390625) {
+            lattice_points.push_back({x, y});
+            lattice_points.push_back({x, -y});
+        }
+    }
+    std::mt19937 generator(4);
+    std::uniform_real_distribution<double> angle_distribution(0.0, 2.0 * std::numbers::pi);
+    std::uniform_int_distribution<size_t> lattice_distribution(0, lattice_points.size() - 1);
+    std::uniform_int_distribution<int64_t> offset_distribution(-1, 1);
+    size_t num_cocircular = 0;
+    for (int i = 0; i < 2000; ++i) {
+        int64_t points[4][2];
+        for (auto& point : points) {
+            if (i % 2 == 0) {
+                const auto& lattice_point = lattice_points[lattice_distribution(generator)];
+                point[0] = 1000 + lattice_point[0] + (i % 4 == 0 ? offset_distribution(generator) : 0);
+                point[1] = -500 + lattice_point[1];
+            } else {
+                double angle = angle_distribution(generator);
+                point[0] = std::llround(1e5 * std::cos(angle));
+                point[1] = std::llround(1e5 * std::sin(angle));
+            }
+        }
+        int expected = GetExpected(points);
+        num_cocircular += expected == 0;
+        Point2D scaled[4];
+        for (int j = 0; j < 4; ++j) {
+            scaled[j] = {std::ldexp(static_cast<double>(points[j][0]), -30) + 3.0,
+                         std::ldexp(static_cast<double>(points[j][1]), -30) - 5.0};
+        }
+        double det = InCircle(scaled[0], scaled[1], scaled[2], scaled[3]);
+        EXPECT_EQ((det > 0.0) - (det < 0.0), expected);
+        double exact_det = InCircleExact(scaled[0], scaled[1], scaled[2], scaled[3]);
+        EXPECT_EQ((exact_det > 0.0) - (exact_det < 0.0), expected);
+    }
+    EXPECT_GT(num_cocircular, 0u);
+#endif
+}
+
+TEST_F(LocateTest, AdaptivePredicatesTest) {
+    EXPECT_TRUE(AdaptivePredicates::IsTurnLeft(Point2D{0, 0}, Point2D{1, 0}, Point2D{0, 1e-300}));
+    EXPECT_FALSE(IsTurnLeft(Point2D{0, 0}, Point2D{1, 0}, Point2D{0, 1e-300}));
+    EXPECT_TRUE(AdaptivePredicates::ArePointsCollinear(Point2D{0, 0}, Point2D{1, 1}, Point2D{2, 2}));
+    EXPECT_FALSE(AdaptivePredicates::ArePointsCollinear(Point2D{0, 0}, Point2D{1, 1}, Point2D{2, 2 + 1e-12}));
+
+    EXPECT_TRUE(AdaptivePredicates::IsPointOnSegment(Point2D{1, 1}, Point2D{0, 0}, Point2D{2, 2}));
+    EXPECT_TRUE(AdaptivePredicates::IsPointOnSegment(Point2D{2, 2}, Point2D{0, 0}, Point2D{2, 2}));
+    EXPECT_FALSE(AdaptivePredicates::IsPointOnSegment(Point2D{3, 3}, Point2D{0, 0}, Point2D{2, 2}));
+    EXPECT_FALSE(AdaptivePredicates::IsPointOnSegment(Point2D{-1, -1}, Point2D{0, 0}, Point2D{2, 2}));
+
+    EXPECT_TRUE(AdaptivePredicates::IsTurnLeftOrOnRay(Point2D{0, 0}, Point2D{1, 1}, Point2D{2, 2}));
+    EXPECT_TRUE(AdaptivePredicates::IsTurnLeftOrOnRay(Point2D{0, 0}, Point2D{0, 1}, Point2D{0, 2}));
+    EXPECT_FALSE(AdaptivePredicates::IsTurnLeftOrOnRay(Point2D{0, 0}, Point2D{1, 1}, Point2D{-1, -1}));
+    EXPECT_FALSE(AdaptivePredicates::IsTurnLeftOrOnRay(Point2D{0, 0}, Point2D{1, 1}, Point2D{0.5, 0.5}));
+    EXPECT_FALSE(AdaptivePredicates::IsTurnLeftOrOnRay(Point2D{0, 0}, Point2D{1, 0}, Point2D{0, -1}));
+
+    Point2D p{0, 0};
+    Point2D q{5e-8, 0};
+    Point2D r{0, 5e-8};
+    EXPECT_TRUE(AdaptivePredicates::IsPointInTriangle(Point2D{1e-9, 1e-9}, p, q, r));
+    EXPECT_FALSE(AdaptivePredicates::IsPointInTriangle(Point2D{0, 2e-8}, p, q, r));
+}
+
+TEST_F(LocateTest, ScalarTypesTest) {
+    // Integer coordinates are decided exactly up to the documented bound, where the products no longer fit in double.
+    constexpr int32_t kMax32 = euclid::util::ScalarTraits<int32_t>::kMaxExactCoordinate - 1;
+    BasicPoint2D<int32_t> p32{-kMax32, -kMax32};
+    BasicPoint2D<int32_t> q32{kMax32, kMax32 - 1};
+    BasicPoint2D<int32_t> r32{kMax32 - 2, kMax32 - 3};
+    EXPECT_EQ(GetCrossValue(p32, q32, r32), -2);
+    EXPECT_FALSE(IsTurnLeft(p32, q32, r32));
+    EXPECT_TRUE(IsTurnLeft(p32, r32, q32));
+    EXPECT_TRUE(ArePointsCollinear(p32, BasicPoint2D<int32_t>{0, 0}, BasicPoint2D<int32_t>{kMax32, kMax32}));
+    EXPECT_TRUE(IsPointOnSegment(BasicPoint2D<int32_t>{0, 0}, p32, BasicPoint2D<int32_t>{kMax32, kMax32}));
+    EXPECT_FALSE(IsPointOnSegment(BasicPoint2D<int32_t>{0, 1}, p32, BasicPoint2D<int32_t>{kMax32, kMax32}));
+    BasicPoint2D<int32_t> origin{0, 0};
+    EXPECT_TRUE(IsTurnLeftOrOnRay(origin, BasicPoint2D<int32_t>{1, 1}, BasicPoint2D<int32_t>{2, 2}));
+    EXPECT_TRUE(IsPointInTriangle(BasicPoint2D<int32_t>{1, 1}, BasicTriangle2D<int32_t>{{{0, 0}, {5, 0}, {0, 5}}}));
+
+#if defined(__SIZEOF_INT128__)
+    constexpr int64_t kMax64 = euclid::util::ScalarTraits<int64_t>::kMaxExactCoordinate - 1;
+    BasicPoint2D<int64_t> p64{-kMax64, -kMax64};
+    BasicPoint2D<int64_t> q64{kMax64, kMax64 - 1};
+    BasicPoint2D<int64_t> r64{kMax64 - 2, kMax64 - 3};
+    EXPECT_FALSE(IsTurnLeft(p64, q64, r64));
+    EXPECT_TRUE(IsTurnLeft(p64, r64, q64));
+    EXPECT_TRUE(ArePointsCollinear(p64, BasicPoint2D<int64_t>{0, 0}, BasicPoint2D<int64_t>{kMax64, kMax64}));
+    EXPECT_EQ(AdaptivePredicates::GetOrientation(p64, q64, r64), -1);
+#endif
+
+    // Integer comparisons skip the tolerance, float ones keep it.
+    EXPECT_FALSE((BasicPoint2D<int32_t>{0, 0} == BasicPoint2D<int32_t>{0, 1}));
+    EXPECT_TRUE((BasicPoint2D<int32_t>{0, 0} < BasicPoint2D<int32_t>{1, 0}));
+    EXPECT_TRUE((BasicPoint2D<float>{0.0f, 0.0f} == BasicPoint2D<float>{0.0f, 1e-7f}));
+    BasicPoint2D<float> pf{0.0f, 0.0f};
+    BasicPoint2D<float> qf{1.0f, 0.0f};
+    BasicPoint2D<float> rf{0.5f, 1e-3f};
+    EXPECT_TRUE(IsTurnLeft(pf, qf, rf));
+    EXPECT_EQ(AdaptivePredicates::GetOrientation(pf, qf, BasicPoint2D<float>{0.5f, 1e-30f}), 1);
+    EXPECT_EQ(TolerancePredicates::GetOrientation(pf, qf, BasicPoint2D<float>{0.5f, 1e-30f}), 0);
+
+    // Arguments of mixed types compare as doubles, and the later points convert to the type of the first one.
+    EXPECT_TRUE(euclid::util::Equal(1e-7, 0));
+    EXPECT_TRUE(euclid::util::Equal(0, 1e-7));
+    EXPECT_TRUE(euclid::util::GreaterEqual(1.0f, 1));
+    EXPECT_FALSE(euclid::util::Less(1, 2.0, 1.5));
+    EXPECT_TRUE(IsTurnLeft(Point2D{0, 0}, {1, 0}, {0, 1}));
+    EXPECT_TRUE(IsPointInTriangle(BasicPoint2D<float>{0.25f, 0.25f}, {{{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}}}));
+    EXPECT_TRUE(euclid::util::IsExactCoordinate(kMax32));
+    EXPECT_FALSE(euclid::util::IsExactCoordinate(kMax32 + 1));
+    EXPECT_TRUE(euclid::util::IsExactCoordinate(1e300));
+}
+
+TEST_F(LocateTest, SortBySortingNetworkTest) {
+    // By the 0-1 principle a comparator network sorts every input if it sorts all sequences of zeros and ones.
+    for (size_t size = 0; size <= kMaxSortingNetworkSize; ++size) {
+        for (unsigned bits = 0; bits < (1u << size); ++bits) {
+            int values[kMaxSortingNetworkSize];
+            for (size_t i = 0; i < size; ++i) {
+                values[i] = (bits >> i) & 1;
+            }
+            SortBySortingNetwork(values, size, [](int a, int b) { return a < b; });
+            EXPECT_TRUE(std::is_sorted(values, values + size));
+        }
+    }
+    std::vector<Point2D> points = {{3, 1}, {0, 2}, {1, 1}, {5, 0}, {2, 2}, {0, 0}, {4, 1}, {1, 0}};
+    SortBySortingNetwork(points.data(), points.size(), IsLowerThenLefter<double>);
+    EXPECT_TRUE(std::is_sorted(points.begin(), points.end(), IsLowerThenLefter<double>));
+}
+
+TEST_F(LocateTest, GetHilbertIndexTest) {
+    // The first 4^k positions fill the 2^k x 2^k cells at the origin, consecutive ones are neighbours.
+    constexpr uint32_t kSize = 16;
+    std::vector<int> cells(kSize * kSize, -1);
+    for (uint32_t x = 0; x < kSize; ++x) {
+        for (uint32_t y = 0; y < kSize; ++y) {
+            uint32_t index = GetHilbertIndex(x, y);
+            ASSERT_LT(index, kSize * kSize);
+            EXPECT_EQ(cells[index], -1);
+            cells[index] = static_cast<int>(x * kSize + y);
+        }
+    }
+    for (size_t i = 1; i < cells.size(); ++i) {
+        int dx = std::abs(cells[i] / static_cast<int>(kSize) - cells[i - 1] / static_cast<int>(kSize));
+        int dy = std::abs(cells[i] % static_cast<int>(kSize) - cells[i - 1] % static_cast<int>(kSize));
+        EXPECT_EQ(dx + dy, 1);
+    }
+    EXPECT_EQ(GetHilbertIndex(0, 0), 0u);
+    EXPECT_EQ(GetHilbertIndex(65535, 0), 0xFFFFFFFFu);
+}
+
+TEST_F(LocateTest, GetMortonIndexTest) {
+    EXPECT_EQ(GetMortonIndex(0, 0), 0u);
+    EXPECT_EQ(GetMortonIndex(1, 0), 1u);
+    EXPECT_EQ(GetMortonIndex(0, 1), 2u);
+    EXPECT_EQ(GetMortonIndex(3, 5), 0b100111u);
+    EXPECT_EQ(GetMortonIndex(65535, 65535), 0xFFFFFFFFu);
+    std::mt19937 generator(19);
+    std::uniform_int_distribution<uint32_t> distribution(0, 65535);
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t x = distribution(generator);
+        uint32_t y = distribution(generator);
+        uint32_t index = GetMortonIndex(x, y);
+        uint32_t cell_x = 0;
+        uint32_t cell_y = 0;
+        GetMortonCell(index, cell_x, cell_y);
+        EXPECT_EQ(cell_x, x);
+        EXPECT_EQ(cell_y, y);
+#if defined(EUCLID_X86_64)
+        if (euclid::util::DetectFastBmi2()) {
+            EXPECT_EQ(GetMortonIndexBmi2(x, y), index);
+            EXPECT_EQ(GetHilbertIndexBmi2(x, y), GetHilbertIndex(x, y));
+            GetMortonCellBmi2(index, cell_x, cell_y);
+            EXPECT_EQ(cell_x, x);
+            EXPECT_EQ(cell_y, y);
+        }
+#endif
+    }
+}
+
+TEST_F(LocateTest, SortByRadixTest) {
+    std::mt19937_64 generator(19);
+    for (size_t size : {0, 1, 1000, 300000}) {
+        std::vector<uint64_t> values(size);
+        for (auto& value : values) {
+            value = generator();
+        }
+        std::vector<uint64_t> buffer(size);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+        auto sorted = values;
+        SortByRadix(sorted, buffer, 0);
+        EXPECT_EQ(sorted, expected);
+
+        // Stable, values equal in the sorted bits keep their order.
+        expected = values;
+        std::stable_sort(expected.begin(), expected.end(), [](uint64_t a, uint64_t b) { return a >> 40 < b >> 40; });
+        for (size_t num_threads : {1, 3}) {
+            euclid::util::ThreadPool thread_pool(num_threads);
+            sorted = values;
+            SortByRadix(sorted, buffer, 40, thread_pool);
+            EXPECT_EQ(sorted, expected);
+        }
+    }
+}
+
+TEST_F(LocateTest, GetSpatialOrderTest) {
+    std::mt19937 generator(19);
+    std::uniform_real_distribution<double> distribution(-10.0, 30.0);
+    // not a multiple of the 8 points of the vectorized kernel
+    std::vector<Point2D> points(200003);
+    for (auto& point : points) {
+        point = {distribution(generator), 0.5 * distribution(generator)};
+    }
+    // a duplicate, sorted after the original
+    points[1000] = points[10];
+    SpatialGrid grid;
+    grid.Add(points);
+    for (auto curve : {SpaceFillingCurve::kMorton, SpaceFillingCurve::kHilbert}) {
+        std::vector<uint32_t> expected_order(points.size());
+        std::vector<uint32_t> indices(points.size());
+        for (uint32_t i = 0; i < points.size(); ++i) {
+            expected_order[i] = i;
+            auto x = static_cast<uint32_t>((points[i].coords[0] - grid.min_x) * grid.GetScale());
+            auto y = static_cast<uint32_t>((points[i].coords[1] - grid.min_y) * grid.GetScale());
+            ASSERT_LE(x, 65535u);
+            ASSERT_LE(y, 65535u);
+            indices[i] = curve == SpaceFillingCurve::kMorton ? GetMortonIndex(x, y) : GetHilbertIndex(x, y);
+        }
+        std::stable_sort(expected_order.begin(), expected_order.end(),
+                         [&](uint32_t a, uint32_t b) { return indices[a] < indices[b]; });
+        auto order = GetSpatialOrder(points, curve);
+        EXPECT_EQ(order, expected_order);
+
+        std::vector<uint64_t> keys(points.size());
+        std::vector<uint64_t> expected_keys(points.size());
+        GetSpatialKeys(points, grid, curve, 7, keys.data());
+        for (uint32_t i = 0; i < points.size(); ++i) {
+            expected_keys[i] = static_cast<uint64_t>(indices[i]) << 32 | (i + 7);
+        }
+        EXPECT_EQ(keys, expected_keys);
+#if defined(EUCLID_X86_64)
+        if (euclid::util::DetectFastBmi2()) {
+            if (curve == SpaceFillingCurve::kMorton) {
+                GetSpatialKeysBmi2<SpaceFillingCurve::kMorton>(points, grid, 7, keys.data());
+            } else {
+                GetSpatialKeysBmi2<SpaceFillingCurve::kHilbert>(points, grid, 7, keys.data());
+            }
+            EXPECT_EQ(keys, expected_keys);
+        }
+#endif
+        EXPECT_LT(std::find(order.begin(), order.end(), 10), std::find(order.begin(), order.end(), 1000));
+
+        {
+            euclid::util::ScopedMaxSimdLevel max_simd_level(euclid::util::SimdLevel::kScalar);
+            EXPECT_EQ(GetSpatialOrder(points, curve), order);
+        }
+        euclid::util::ThreadPool thread_pool(3);
+        EXPECT_EQ(GetSpatialOrder(points, curve, thread_pool), order);
+
+        std::vector<Point2D> expected;
+        for (auto index : order) {
+            expected.push_back(points[index]);
+        }
+        auto sorted_points = points;
+        SortBySpatialOrder(sorted_points, curve);
+        EXPECT_EQ(sorted_points, expected);
+        sorted_points = points;
+        SortBySpatialOrder(sorted_points, curve, thread_pool);
+        EXPECT_EQ(sorted_points, expected);
+    }
+
+    EXPECT_TRUE(GetSpatialOrder(std::vector<Point2D>{}).empty());
+    EXPECT_EQ(GetSpatialOrder(std::vector<Point2D>{{1, 1}, {1, 1}, {1, 1}}), (std::vector<uint32_t>{0, 1, 2}));
+    // The Hilbert curve runs from the lower left corner up, right and down to the lower right one.
+    EXPECT_EQ(GetSpatialOrder(std::vector<Point2D>{{1, 0}, {0, 0}, {1, 1}, {0, 1}}),
+              (std::vector<uint32_t>{1, 3, 2, 0}));
+    EXPECT_EQ(GetSpatialOrder(std::vector<Point2D>{{1, 0}, {0, 0}, {1, 1}, {0, 1}}, SpaceFillingCurve::kMorton),
+              (std::vector<uint32_t>{1, 0, 3, 2}));
+}
+
+TEST_F(LocateTest, ConvexPolygonContainsTest) {
+    // Brute force: inside or on the boundary if left of or on every edge.
+    auto ContainsByEdges = []<typename Predicates, typename T>(Predicates, const std::vector<BasicPoint2D<T>>& vertices,
+                                                                const BasicPoint2D<T>& point) {
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            if (Predicates::GetOrientation(vertices[i], vertices[(i + 1) % vertices.size()], point) < 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::mt19937 generator(15);
+    std::vector<Point2D> vertices;
+    const double kPi = std::acos(-1.0);
+    for (int i = 0; i < 300; ++i) {
+        vertices.push_back({100 * std::cos(2 * kPi * i / 300), 100 * std::sin(2 * kPi * i / 300)});
+    }
+    ConvexPolygon2D polygon(vertices);
+    ASSERT_EQ(polygon.Size(), vertices.size());
+    EXPECT_FALSE(polygon.Empty());
+
+    // Random points, the vertices, points on and just off the edges.
+    std::uniform_real_distribution<double> coord_distribution(-110, 110);
+    std::vector<Point2D> points;
+    for (int i = 0; i < 2000; ++i) {
+        points.push_back({coord_distribution(generator), coord_distribution(generator)});
+    }
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Point2D& p = vertices[i];
+        const Point2D& q = vertices[(i + 1) % vertices.size()];
+        points.push_back(p);
+        points.push_back({(p.coords[0] + q.coords[0]) / 2, (p.coords[1] + q.coords[1]) / 2});
+        points.push_back({(p.coords[0] + q.coords[0]) / 2 * 1.01, (p.coords[1] + q.coords[1]) / 2 * 1.01});
+        points.push_back({(p.coords[0] + q.coords[0]) / 2 * 0.99, (p.coords[1] + q.coords[1]) / 2 * 0.99});
+    }
+    for (const auto& point : points) {
+        EXPECT_EQ(polygon.Contains(point), ContainsByEdges(TolerancePredicates{}, vertices, point));
+        EXPECT_EQ(polygon.Contains<AdaptivePredicates>(point), ContainsByEdges(AdaptivePredicates{}, vertices, point));
+    }
+
+    // The batch form agrees with the scalar one bit for bit with every kernel.
+    auto Bit = [](const std::vector<uint64_t>& mask, size_t i) { return ((mask[i / 64] >> (i % 64)) & 1) != 0; };
+    for (auto level : {euclid::util::SimdLevel::kScalar, euclid::util::SimdLevel::kAvx2}) {
+        euclid::util::ScopedMaxSimdLevel max_simd_level(level);
+        for (size_t size : std::vector<size_t>{0, 1, 63, 64, 65, 1000, points.size()}) {
+            std::span<const Point2D> subset(points.data(), size);
+            std::vector<uint64_t> mask(GetNumMaskWords(size), ~uint64_t{0});
+            std::vector<uint64_t> adaptive_mask(GetNumMaskWords(size), ~uint64_t{0});
+            polygon.Contains(subset, mask.data());
+            polygon.Contains<AdaptivePredicates>(subset, adaptive_mask.data());
+            for (size_t i = 0; i < size; ++i) {
+                EXPECT_EQ(Bit(mask, i), polygon.Contains(points[i]));
+                EXPECT_EQ(Bit(adaptive_mask, i), polygon.Contains<AdaptivePredicates>(points[i]));
+            }
+            for (size_t i = size; i < GetNumMaskWords(size) * 64; ++i) {
+                EXPECT_FALSE(Bit(mask, i));
+                EXPECT_FALSE(Bit(adaptive_mask, i));
+            }
+        }
+    }
+
+    // Integer coordinates, every polygon size from a triangle on.
+    std::uniform_int_distribution<int> int_distribution(-10, 10);
+    std::vector<BasicPoint2D<int>> square = {{-8, -8}, {0, -9}, {8, -8}, {9, 0}, {8, 8}, {0, 9}, {-8, 8}, {-9, 0}};
+    for (size_t size = 3; size <= square.size(); ++size) {
+        std::vector<BasicPoint2D<int>> int_vertices(square.begin(), square.begin() + size);
+        BasicConvexPolygon2D<int> int_polygon(int_vertices);
+        std::vector<BasicPoint2D<int>> int_points;
+        for (int x = -10; x <= 10; ++x) {
+            for (int y = -10; y <= 10; ++y) {
+                int_points.push_back({x, y});
+                EXPECT_EQ(int_polygon.Contains({x, y}), ContainsByEdges(TolerancePredicates{}, int_vertices, {x, y}));
+            }
+        }
+        std::vector<uint64_t> mask(GetNumMaskWords(int_points.size()));
+        int_polygon.Contains(std::span<const BasicPoint2D<int>>(int_points), mask.data());
+        for (size_t i = 0; i < int_points.size(); ++i) {
+            EXPECT_EQ(Bit(mask, i), int_polygon.Contains(int_points[i]));
+        }
+    }
+
+    // Fewer than 3 vertices contain nothing.
+    ConvexPolygon2D segment(std::vector<Point2D>{{0, 0}, {1, 0}});
+    EXPECT_TRUE(segment.Empty());
+    EXPECT_FALSE(segment.Contains(Point2D{0, 0}));
+    std::vector<uint64_t> mask(GetNumMaskWords(points.size()), ~uint64_t{0});
+    segment.Contains(points, mask.data());
+    EXPECT_TRUE(std::all_of(mask.begin(), mask.end(), [](uint64_t word) { return word == 0; }));
+}
@@ -0,0 +1,207 @@
+/**
+ * @file rotating_calipers_test.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "algorithm/convex_hull/batch.h"
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/rotating_calipers/rotating_calipers.h"
+#include "algorithm/util/location.h"
+#include "geometry/point_2d.h"
+#include "geometry/rectangle_2d.h"
+#include "util/thread_pool.h"
+
+using namespace euclid::geometry;
+using namespace euclid::algorithm::rotating_calipers;
+
+namespace {
+
+double GetArea(const Rectangle2D& rectangle) {
+    double area = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        const auto& p = rectangle.vertices[i];
+        const auto& q = rectangle.vertices[(i + 1) % 4];
+        area += p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0];
+    }
+    return area / 2;
+}
+
+double GetPerimeter(const Rectangle2D& rectangle) {
+    double perimeter = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        const auto& p = rectangle.vertices[i];
+        const auto& q = rectangle.vertices[(i + 1) % 4];
+        perimeter += std::hypot(q.coords[0] - p.coords[0], q.coords[1] - p.coords[1]);
+    }
+    return perimeter;
+}
+
+/**
+ * @brief Checks that a rectangle is counter-clockwise with right angles and encloses the points.
+ */
+template <typename T>
+void ExpectEnclosingRectangle(const Rectangle2D& rectangle, const std::vector<BasicPoint2D<T>>& points) {
+    for (size_t i = 0; i < 4; ++i) {
+        const auto& p = rectangle.vertices[i];
+        const auto& q = rectangle.vertices[(i + 1) % 4];
+        const auto& r = rectangle.vertices[(i + 2) % 4];
+        double length = std::hypot(q.coords[0] - p.coords[0], q.coords[1] - p.coords[1]);
+        double dot_value = (q.coords[0] - p.coords[0]) * (r.coords[0] - q.coords[0]) +
+                           (q.coords[1] - p.coords[1]) * (r.coords[1] - q.coords[1]);
+        EXPECT_NEAR(dot_value, 0.0, 1e-9 * (1 + length * length));
+        for (const auto& point : points) {
+            Point2D r_point{static_cast<double>(point.coords[0]), static_cast<double>(point.coords[1])};
+            EXPECT_GE(euclid::algorithm::util::GetCrossValue(p, q, r_point), -1e-9 * (1 + length * length));
+        }
+    }
+}
+
+/**
+ * @brief The measures by checking every pair of vertices and the rectangle on every edge, in O(h^2).
+ */
+template <typename T>
+void ExpectMeasuresByBruteForce(const std::vector<BasicPoint2D<T>>& hull, const BasicCaliperMeasures2D<T>& measures) {
+    using euclid::algorithm::util::GetCrossValue;
+    using euclid::algorithm::util::GetDotValue;
+    double max_squared_distance = 0;
+    for (const auto& p : hull) {
+        for (const auto& q : hull) {
+            max_squared_distance = std::max(max_squared_distance, static_cast<double>(GetDotValue(p, q, q)));
+        }
+    }
+    const auto& [first, second] = measures.diameter;
+    EXPECT_EQ(static_cast<double>(GetDotValue(first, second, second)), max_squared_distance);
+
+    double width = std::numeric_limits<double>::infinity();
+    double area = std::numeric_limits<double>::infinity();
+    double perimeter = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < hull.size(); ++i) {
+        const auto& p = hull[i];
+        const auto& q = hull[(i + 1) % hull.size()];
+        double length = std::sqrt(static_cast<double>(GetDotValue(p, q, q)));
+        double low = std::numeric_limits<double>::infinity();
+        double high = -std::numeric_limits<double>::infinity();
+        double height = 0;
+        for (const auto& r : hull) {
+            low = std::min(low, static_cast<double>(GetDotValue(p, q, r)) / length);
+            high = std::max(high, static_cast<double>(GetDotValue(p, q, r)) / length);
+            height = std::max(height, static_cast<double>(GetCrossValue(p, q, r)) / length);
+        }
+        width = std::min(width, height);
+        area = std::min(area, (high - low) * height);
+        perimeter = std::min(perimeter, 2 * (high - low + height));
+    }
+    EXPECT_NEAR(measures.width, width, 1e-9 * width);
+    EXPECT_NEAR(GetArea(measures.minimum_area_rectangle), area, 1e-9 * area);
+    EXPECT_NEAR(GetPerimeter(measures.minimum_perimeter_rectangle), perimeter, 1e-9 * perimeter);
+    ExpectEnclosingRectangle(measures.minimum_area_rectangle, hull);
+    ExpectEnclosingRectangle(measures.minimum_perimeter_rectangle, hull);
+}
+
+}  // namespace
+
+class RotatingCalipersTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(RotatingCalipersTest, SquareTest) {
+    // A square turned by 45 degrees: its own bounding box, the axis-aligned one is twice as large.
+    std::vector<Point2D> hull = {{1, 0}, {2, 1}, {1, 2}, {0, 1}};
+    auto measures = GetCaliperMeasures(hull);
+    ASSERT_TRUE(measures.has_value());
+    EXPECT_DOUBLE_EQ(measures->width, std::sqrt(2.0));
+    EXPECT_DOUBLE_EQ(GetArea(measures->minimum_area_rectangle), 2.0);
+    EXPECT_DOUBLE_EQ(GetPerimeter(measures->minimum_perimeter_rectangle), 4 * std::sqrt(2.0));
+    auto diameter = GetDiameter(hull);
+    ASSERT_TRUE(diameter.has_value());
+    EXPECT_DOUBLE_EQ(std::hypot(diameter->first.coords[0] - diameter->second.coords[0],
+                                diameter->first.coords[1] - diameter->second.coords[1]),
+                     2.0);
+    EXPECT_EQ(GetWidth(std::span<const Point2D>(hull)), measures->width);
+    ASSERT_TRUE(GetMinimumAreaRectangle(hull).has_value());
+    ASSERT_TRUE(GetMinimumPerimeterRectangle(hull).has_value());
+
+    // Fewer than 3 vertices have no measures.
+    EXPECT_FALSE(GetCaliperMeasures(std::vector<Point2D>{{0, 0}, {1, 1}}).has_value());
+    EXPECT_FALSE(GetDiameter(std::vector<Point2D>{}).has_value());
+    EXPECT_FALSE(GetWidth(std::vector<Point2D>{{0, 0}}).has_value());
+}
+
+TEST_F(RotatingCalipersTest, BruteForceTest) {
+    std::mt19937 generator(16);
+    for (int round = 0; round < 200; ++round) {
+        // Small integer ranges give many parallel edges, where the calipers touch two vertices at once.
+        int range = round % 2 == 0 ? 5 : 1000;
+        std::uniform_int_distribution<int> int_distribution(-range, range);
+        std::vector<BasicPoint2D<int>> int_points;
+        for (int i = 0; i < 3 + round; ++i) {
+            int_points.push_back({int_distribution(generator), int_distribution(generator)});
+        }
+        auto int_hull = euclid::algorithm::convex_hull::GetConvexHullByMonotoneChain(int_points);
+        if (auto measures = GetCaliperMeasures(int_hull)) {
+            ExpectMeasuresByBruteForce(int_hull, *measures);
+        }
+
+        std::uniform_real_distribution<double> distribution(-range, range);
+        std::vector<Point2D> points;
+        for (int i = 0; i < 3 + round; ++i) {
+            points.push_back({distribution(generator), distribution(generator) * 0.1});
+        }
+        auto hull = euclid::algorithm::convex_hull::GetConvexHullByMonotoneChain(points);
+        auto measures = GetCaliperMeasures(hull);
+        ASSERT_TRUE(measures.has_value());
+        ExpectMeasuresByBruteForce(hull, *measures);
+    }
+}
+
+TEST_F(RotatingCalipersTest, BatchTest) {
+    std::mt19937 generator(17);
+    std::uniform_real_distribution<double> distribution(-10.0, 10.0);
+    std::vector<Point2D> points;
+    std::vector<size_t> offsets = {0};
+    for (size_t group = 0; group < 500; ++group) {
+        for (size_t i = 0; i < group % 50; ++i) {
+            points.push_back({distribution(generator), distribution(generator)});
+        }
+        offsets.push_back(points.size());
+    }
+
+    for (size_t num_threads : {1, 3}) {
+        euclid::util::ThreadPool thread_pool(num_threads);
+        std::vector<Point2D> hull_points;
+        std::vector<size_t> hull_offsets;
+        euclid::algorithm::convex_hull::GetConvexHulls(points, offsets, hull_points, hull_offsets, thread_pool);
+        std::vector<std::optional<CaliperMeasures2D>> measures;
+        GetCaliperMeasures(hull_points, hull_offsets, measures, thread_pool);
+        ASSERT_EQ(measures.size(), hull_offsets.size() - 1);
+        for (size_t hull = 0; hull < measures.size(); ++hull) {
+            auto expected = GetCaliperMeasures(std::span<const Point2D>(hull_points).subspan(
+                hull_offsets[hull], hull_offsets[hull + 1] - hull_offsets[hull]));
+            ASSERT_EQ(measures[hull].has_value(), expected.has_value());
+            if (expected) {
+                EXPECT_EQ(measures[hull]->diameter, expected->diameter);
+                EXPECT_EQ(measures[hull]->width, expected->width);
+                EXPECT_EQ(GetArea(measures[hull]->minimum_area_rectangle),
+                          GetArea(expected->minimum_area_rectangle));
+            }
+        }
+        GetCaliperMeasures(hull_points, std::span<const size_t>(), measures, thread_pool);
+        EXPECT_TRUE(measures.empty());
+    }
+}
@@ -0,0 +1,196 @@
+/**
+ * @file segment_intersection_test.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <numbers>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "algorithm/segment_intersection/grid.h"
+#include "algorithm/segment_intersection/sweep.h"
+#include "geometry/point_2d.h"
+#include "geometry/segment_2d.h"
+#include "util/thread_pool.h"
+
+using namespace euclid::geometry;
+using namespace euclid::algorithm::segment_intersection;
+
+namespace {
+
+using Pairs = std::vector<std::pair<size_t, size_t>>;
+
+template <typename T>
+Pairs GetPairsByBruteForce(const std::vector<BasicSegment2D<T>>& segments) {
+    Pairs pairs;
+    for (size_t i = 0; i < segments.size(); ++i) {
+        for (size_t j = i + 1; j < segments.size(); ++j) {
+            if (IsSegmentIntersecting(segments[i], segments[j])) {
+                pairs.emplace_back(i, j);
+            }
+        }
+    }
+    return pairs;
+}
+
+template <typename T>
+Pairs GetPairsBySweep(const std::vector<BasicSegment2D<T>>& segments) {
+    Pairs pairs;
+    ForEachSegmentIntersection(segments, [&pairs](size_t i, size_t j) { pairs.emplace_back(i, j); });
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+template <typename T>
+Pairs GetPairsByGrid(const std::vector<BasicSegment2D<T>>& segments, euclid::util::ThreadPool& thread_pool) {
+    Pairs pairs;
+    std::mutex mutex;
+    ForEachSegmentIntersectionByGrid(segments, thread_pool, [&](size_t i, size_t j, size_t) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pairs.emplace_back(i, j);
+    });
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+/**
+ * @brief Segments between points of a small integer grid, full of shared endpoints, vertical and collinear segments,
+ * segments that are points and crossings of many segments at one point.
+ */
+template <typename T>
+std::vector<BasicSegment2D<T>> GenerateGridSegments(size_t size, int range, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, range);
+    std::vector<BasicSegment2D<T>> segments(size);
+    for (auto& segment : segments) {
+        for (auto& endpoint : segment.endpoints) {
+            endpoint = {static_cast<T>(distribution(generator)), static_cast<T>(distribution(generator))};
+        }
+    }
+    return segments;
+}
+
+/**
+ * @brief Grid segments under a shear with non-integer coefficients, so that crossings and endpoints that coincide or
+ * nearly coincide on the grid are apart by a rounding error or less.
+ */
+std::vector<Segment2D> GenerateShearedSegments(size_t size, int range, uint64_t seed) {
+    auto segments = GenerateGridSegments<double>(size, range, seed);
+    for (auto& segment : segments) {
+        for (auto& endpoint : segment.endpoints) {
+            const double x = endpoint.coords[0] - range / 2;
+            const double y = endpoint.coords[1] - range / 2;
+            endpoint = {0.1 * x + 0.3 * y, 0.7 * y};
+        }
+    }
+    return segments;
+}
+
+std::vector<Segment2D> GenerateShortSegments(size_t size, double length, uint64_t seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    std::vector<Segment2D> segments(size);
+    for (auto& segment : segments) {
+        const Point2D start{distribution(generator), distribution(generator)};
+        const double angle = 2.0 * std::numbers::pi * distribution(generator);
+        segment.endpoints[0] = start;
+        segment.endpoints[1] = {start.coords[0] + length * std::cos(angle), start.coords[1] + length * std::sin(angle)};
+    }
+    return segments;
+}
+
+}  // namespace
+
+class SegmentIntersectionTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(SegmentIntersectionTest, IsSegmentIntersectingTest) {
+    // crossing, touching at an endpoint, a T-junction
+    EXPECT_TRUE(IsSegmentIntersecting(Segment2D{{{0, 0}, {2, 2}}}, Segment2D{{{0, 2}, {2, 0}}}));
+    EXPECT_TRUE(IsSegmentIntersecting(Segment2D{{{0, 0}, {1, 1}}}, Segment2D{{{1, 1}, {2, 0}}}));
+    EXPECT_TRUE(IsSegmentIntersecting(Segment2D{{{0, 0}, {2, 0}}}, Segment2D{{{1, 0}, {1, 1}}}));
+    // collinear: overlapping, touching, apart
+    EXPECT_TRUE(IsSegmentIntersecting(Segment2D{{{0, 0}, {2, 0}}}, Segment2D{{{1, 0}, {3, 0}}}));
+    EXPECT_TRUE(IsSegmentIntersecting(Segment2D{{{0, 0}, {1, 0}}}, Segment2D{{{1, 0}, {3, 0}}}));
+    EXPECT_FALSE(IsSegmentIntersecting(Segment2D{{{0, 0}, {1, 0}}}, Segment2D{{{2, 0}, {3, 0}}}));
+    // parallel, and lines crossing beyond the segments
+    EXPECT_FALSE(IsSegmentIntersecting(Segment2D{{{0, 0}, {2, 0}}}, Segment2D{{{0, 1}, {2, 1}}}));
+    EXPECT_FALSE(IsSegmentIntersecting(Segment2D{{{0, 0}, {1, 1}}}, Segment2D{{{3, 0}, {2, 1}}}));
+    // segments that are points
+    EXPECT_TRUE(IsSegmentIntersecting(Segment2D{{{1, 1}, {1, 1}}}, Segment2D{{{0, 0}, {2, 2}}}));
+    EXPECT_FALSE(IsSegmentIntersecting(Segment2D{{{1, 1}, {1, 1}}}, Segment2D{{{0, 0}, {2, 1}}}));
+    EXPECT_TRUE(IsSegmentIntersecting(Segment2D{{{1, 1}, {1, 1}}}, Segment2D{{{1, 1}, {1, 1}}}));
+    EXPECT_FALSE(IsSegmentIntersecting(Segment2D{{{1, 1}, {1, 1}}}, Segment2D{{{1, 2}, {1, 2}}}));
+    // exact where a tolerance would see a touch
+    EXPECT_FALSE(IsSegmentIntersecting(Segment2D{{{0, 0}, {1, 1}}}, Segment2D{{{0.5, 0.5 + 1e-15}, {0, 1}}}));
+    EXPECT_TRUE(IsSegmentIntersecting(BasicSegment2D<int32_t>{{{0, 0}, {4, 2}}},
+                                      BasicSegment2D<int32_t>{{{2, 1}, {2, 5}}}));
+}
+
+TEST_F(SegmentIntersectionTest, ForEachSegmentIntersectionTest) {
+    EXPECT_TRUE(GetPairsBySweep(std::vector<Segment2D>{}).empty());
+    EXPECT_TRUE(GetPairsBySweep(std::vector<Segment2D>{{{{0, 0}, {1, 1}}}}).empty());
+
+    // Many segments through one point, vertical ones and one that is a point.
+    std::vector<Segment2D> star;
+    for (int i = 0; i < 8; ++i) {
+        star.push_back({{{-i - 1.0, -1}, {i + 1.0, 1}}});
+    }
+    star.push_back({{{0, -3}, {0, 3}}});
+    star.push_back({{{0, -1}, {0, 0}}});
+    star.push_back({{{0, 0}, {0, 0}}});
+    EXPECT_EQ(GetPairsBySweep(star), GetPairsByBruteForce(star));
+    EXPECT_EQ(GetPairsBySweep(star).size(), star.size() * (star.size() - 1) / 2);
+
+    for (uint64_t seed = 0; seed < 20; ++seed) {
+        const auto grid_segments = GenerateGridSegments<int32_t>(150, 6, seed);
+        EXPECT_EQ(GetPairsBySweep(grid_segments), GetPairsByBruteForce(grid_segments)) << seed;
+        const auto double_grid_segments = GenerateGridSegments<double>(150, 6, seed);
+        EXPECT_EQ(GetPairsBySweep(double_grid_segments), GetPairsByBruteForce(double_grid_segments)) << seed;
+    }
+    // A crossing a rounding error from an endpoint, and crossings and endpoints near one another.
+    const std::vector<Segment2D> near = {{{{-0.4, -0.7}, {0.7, 1.4}}}, {{{-1, -2.1}, {0.5, 1.4}}},
+                                         {{{-0.6, -0.7}, {-0.1, -0.7}}}};
+    EXPECT_EQ(GetPairsBySweep(near), GetPairsByBruteForce(near));
+    for (uint64_t seed = 0; seed < 100; ++seed) {
+        const auto sheared_segments = GenerateShearedSegments(20 + seed * 2, 20, seed);
+        EXPECT_EQ(GetPairsBySweep(sheared_segments), GetPairsByBruteForce(sheared_segments)) << seed;
+    }
+    const auto segments = GenerateShortSegments(2000, 0.05, 1);
+    const auto pairs = GetPairsBySweep(segments);
+    EXPECT_GT(pairs.size(), 1000u);
+    EXPECT_EQ(pairs, GetPairsByBruteForce(segments));
+}
+
+TEST_F(SegmentIntersectionTest, ForEachSegmentIntersectionByGridTest) {
+    euclid::util::ThreadPool thread_pool(3);
+    EXPECT_TRUE(GetPairsByGrid(std::vector<Segment2D>{}, thread_pool).empty());
+
+    // all cells swept, all cells tested pairwise, and a few long segments across many cells
+    for (double length : {0.002, 0.02, 0.2}) {
+        auto segments = GenerateShortSegments(3000, length, 2);
+        segments.push_back({{{0, 0}, {1, 1}}});
+        segments.push_back({{{0, 1}, {1, 0}}});
+        EXPECT_EQ(GetPairsByGrid(segments, thread_pool), GetPairsBySweep(segments)) << length;
+    }
+    const auto grid_segments = GenerateGridSegments<int32_t>(500, 20, 3);
+    EXPECT_EQ(GetPairsByGrid(grid_segments, thread_pool), GetPairsByBruteForce(grid_segments));
+    const auto sheared_segments = GenerateShearedSegments(500, 20, 4);
+    EXPECT_EQ(GetPairsByGrid(sheared_segments, thread_pool), GetPairsByBruteForce(sheared_segments));
+    // all segments at one point
+    const std::vector<Segment2D> points(40, Segment2D{{{1, 1}, {1, 1}}});
+    EXPECT_EQ(GetPairsByGrid(points, thread_pool).size(), 40u * 39u / 2);
+}
@@ -0,0 +1,255 @@
+/**
+ * @file spatial_index_test.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "algorithm/spatial_index/batch.h"
+#include "algorithm/spatial_index/kd_tree.h"
+#include "algorithm/spatial_index/neighbor.h"
+#include "algorithm/spatial_index/r_tree.h"
+#include "algorithm/spatial_index/triangle_grid.h"
+#include "algorithm/triangulation/delaunay.h"
+#include "algorithm/util/batch_location.h"
+#include "algorithm/util/edge_equations.h"
+#include "geometry/box_2d.h"
+#include "geometry/point_2d.h"
+#include "geometry/triangle_2d.h"
+#include "util/thread_pool.h"
+
+using namespace euclid::geometry;
+using namespace euclid::algorithm::spatial_index;
+using euclid::util::ThreadPool;
+
+namespace {
+
+std::vector<Point2D> GetRandomPoints(size_t size, std::mt19937& generator) {
+    // integer coordinates so that many points are equally near and on the boundaries of the queries
+    std::uniform_int_distribution<int> distribution(-50, 50);
+    std::vector<Point2D> points;
+    for (size_t i = 0; i < size; ++i) {
+        points.push_back({1.0 * distribution(generator), 1.0 * distribution(generator)});
+    }
+    return points;
+}
+
+std::vector<size_t> GetKNearestByBruteForce(const std::vector<Point2D>& points, const Point2D& query, size_t k) {
+    std::vector<Neighbor> neighbors;
+    for (size_t i = 0; i < points.size(); ++i) {
+        neighbors.push_back({GetSquaredDistance(query, points[i]), i});
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < std::min(k, neighbors.size()); ++i) {
+        indices.push_back(neighbors[i].index);
+    }
+    return indices;
+}
+
+std::vector<size_t> GetRadiusByBruteForce(const std::vector<Point2D>& points, const Point2D& query, double radius) {
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (radius >= 0.0 && GetSquaredDistance(query, points[i]) <= radius * radius) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+std::vector<size_t> GetRangeByBruteForce(const std::vector<Point2D>& points, const Box2D& box) {
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (IsInBox(points[i], box)) {
+            indices.push_back(i);
+        }
+    }
+    return indices;
+}
+
+std::vector<size_t> Sorted(std::vector<size_t> indices) {
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+/**
+ * @brief Checks every query of an index against brute force, and the batched queries against the single ones.
+ */
+template <typename SpatialIndex>
+void ExpectQueries(const SpatialIndex& spatial_index, const std::vector<Point2D>& points, std::mt19937& generator) {
+    ASSERT_EQ(spatial_index.Size(), points.size());
+    std::vector<Point2D> queries = GetRandomPoints(300, generator);
+    queries.insert(queries.end(), points.begin(), points.begin() + std::min<size_t>(points.size(), 50));
+    std::vector<Box2D> boxes;
+    for (size_t i = 0; i + 1 < queries.size(); i += 2) {
+        boxes.push_back({{std::min(queries[i].coords[0], queries[i + 1].coords[0]),
+                          std::min(queries[i].coords[1], queries[i + 1].coords[1])},
+                         {std::max(queries[i].coords[0], queries[i + 1].coords[0]),
+                          std::max(queries[i].coords[1], queries[i + 1].coords[1])}});
+    }
+    for (const auto& query : queries) {
+        auto nearest = spatial_index.Nearest(query);
+        if (points.empty()) {
+            EXPECT_FALSE(nearest.has_value());
+        } else {
+            ASSERT_TRUE(nearest.has_value());
+            EXPECT_EQ(*nearest, GetKNearestByBruteForce(points, query, 1)[0]);
+        }
+        for (size_t k : {0, 1, 7, 30}) {
+            EXPECT_EQ(spatial_index.KNearest(query, k), GetKNearestByBruteForce(points, query, k));
+        }
+        for (double radius : {-1.0, 0.0, 5.0, 12.5}) {
+            EXPECT_EQ(Sorted(spatial_index.Radius(query, radius)), GetRadiusByBruteForce(points, query, radius));
+        }
+    }
+    for (const auto& box : boxes) {
+        EXPECT_EQ(Sorted(spatial_index.Range(box)), GetRangeByBruteForce(points, box));
+    }
+
+    ThreadPool thread_pool(3);
+    std::vector<size_t> nearest;
+    GetNearest(spatial_index, queries, nearest, thread_pool);
+    ASSERT_EQ(nearest.size(), queries.size());
+    std::vector<size_t> neighbors;
+    GetKNearest(spatial_index, queries, 5, neighbors, thread_pool);
+    const size_t num_neighbors = std::min<size_t>(5, points.size());
+    ASSERT_EQ(neighbors.size(), queries.size() * num_neighbors);
+    std::vector<size_t> indices;
+    std::vector<size_t> offsets;
+    GetInRadius(spatial_index, queries, 8.0, indices, offsets, thread_pool);
+    ASSERT_EQ(offsets.size(), queries.size() + 1);
+    EXPECT_EQ(offsets[0], 0u);
+    EXPECT_EQ(offsets.back(), indices.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(nearest[i], spatial_index.Nearest(queries[i]).value_or(kNoNeighbor));
+        std::vector<size_t> k_nearest(neighbors.begin() + i * num_neighbors,
+                                      neighbors.begin() + (i + 1) * num_neighbors);
+        EXPECT_EQ(k_nearest, spatial_index.KNearest(queries[i], 5));
+        std::vector<size_t> in_radius(indices.begin() + offsets[i], indices.begin() + offsets[i + 1]);
+        EXPECT_EQ(Sorted(in_radius), Sorted(spatial_index.Radius(queries[i], 8.0)));
+    }
+    GetInRange(spatial_index, boxes, indices, offsets, thread_pool);
+    ASSERT_EQ(offsets.size(), boxes.size() + 1);
+    EXPECT_EQ(offsets.back(), indices.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        std::vector<size_t> in_range(indices.begin() + offsets[i], indices.begin() + offsets[i + 1]);
+        EXPECT_EQ(Sorted(in_range), Sorted(spatial_index.Range(boxes[i])));
+    }
+}
+
+size_t LocateByBruteForce(const std::vector<Triangle2D>& triangles, const Point2D& point) {
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        if (euclid::algorithm::util::IsPointInClosedTriangle(point, triangles[i])) {
+            return i;
+        }
+    }
+    return kNoTriangle;
+}
+
+/**
+ * @brief Checks single and batched locating against brute force, on points of a grid of quarters, on the vertices
+ * and edges of triangles with integer vertices, and random points.
+ */
+void ExpectLocations(const std::vector<Triangle2D>& triangles, std::mt19937& generator) {
+    const TriangleGrid2D grid(triangles);
+    ASSERT_EQ(grid.Size(), triangles.size());
+    std::uniform_real_distribution<double> distribution(-60.0, 60.0);
+    std::vector<Point2D> queries;
+    for (int i = -220; i <= 220; i += 3) {
+        for (int j = -220; j <= 220; j += 5) {
+            queries.push_back({i * 0.25, j * 0.25});
+        }
+    }
+    for (size_t i = 0; i < 3000; ++i) {
+        queries.push_back({distribution(generator), distribution(generator)});
+    }
+    for (const auto& query : queries) {
+        EXPECT_EQ(grid.Locate(query), LocateByBruteForce(triangles, query));
+    }
+
+    ThreadPool thread_pool(3);
+    std::vector<size_t> located;
+    grid.Locate(queries, located, thread_pool);
+    std::vector<uint64_t> mask(euclid::algorithm::util::GetNumMaskWords(queries.size()));
+    grid.Contains(queries, mask.data(), thread_pool);
+    ASSERT_EQ(located.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(located[i], grid.Locate(queries[i]));
+        EXPECT_EQ(((mask[i / 64] >> (i % 64)) & 1) != 0, located[i] != kNoTriangle);
+    }
+}
+
+}  // namespace
+
+class SpatialIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(SpatialIndexTest, KdTreeTest) {
+    std::mt19937 generator(20);
+    ThreadPool thread_pool(4);
+    for (size_t size : {0, 1, 5, 8, 9, 100, 3000}) {
+        auto points = GetRandomPoints(size, generator);
+        KdTree2D tree(points);
+        ExpectQueries(tree, points, generator);
+        ExpectQueries(KdTree2D(points, thread_pool), points, generator);
+    }
+    // All points coincide.
+    std::vector<Point2D> duplicates(100, Point2D{1, 2});
+    ExpectQueries(KdTree2D(duplicates), duplicates, generator);
+    EXPECT_TRUE(KdTree2D().Empty());
+}
+
+TEST_F(SpatialIndexTest, PackedRTreeTest) {
+    std::mt19937 generator(20);
+    ThreadPool thread_pool(4);
+    for (size_t size : {0, 1, 16, 17, 256, 257, 3000}) {
+        auto points = GetRandomPoints(size, generator);
+        PackedRTree2D tree(points);
+        ExpectQueries(tree, points, generator);
+        ExpectQueries(PackedRTree2D(points, thread_pool), points, generator);
+    }
+    std::vector<Point2D> duplicates(100, Point2D{1, 2});
+    ExpectQueries(PackedRTree2D(duplicates), duplicates, generator);
+    EXPECT_TRUE(PackedRTree2D().Empty());
+}
+
+TEST_F(SpatialIndexTest, TriangleGridTest) {
+    std::mt19937 generator(20);
+    EXPECT_TRUE(TriangleGrid2D().Empty());
+    EXPECT_EQ(TriangleGrid2D().Locate({0, 0}), kNoTriangle);
+    ExpectLocations({}, generator);
+    ExpectLocations({{{{0, 0}, {1, 1}, {2, 2}}}}, generator);
+    // Delaunay meshes of integer points, whose edges and vertices are shared by several triangles and hit by
+    // queries.
+    for (size_t size : {3, 50, 2000}) {
+        const auto points = GetRandomPoints(size, generator);
+        ExpectLocations(euclid::algorithm::triangulation::DelaunayTriangulation2D(points).GetTriangles(), generator);
+    }
+    // overlapping triangles of all sizes, either orientation, and degenerate ones
+    std::uniform_int_distribution<int> distribution(-50, 50);
+    std::vector<Triangle2D> triangles(300);
+    for (auto& triangle : triangles) {
+        for (auto& vertex : triangle.vertices) {
+            vertex = {1.0 * distribution(generator), 1.0 * distribution(generator)};
+        }
+    }
+    triangles.push_back({{{0, 0}, {0, 0}, {0, 0}}});
+    ExpectLocations(triangles, generator);
+    // a strip of thin triangles
+    std::vector<Triangle2D> strip;
+    for (int i = 0; i < 100; ++i) {
+        strip.push_back({{{i * 0.5, 0.0}, {i * 0.5 + 0.5, 0.0}, {i * 0.5, 0.25}}});
+    }
+    ExpectLocations(strip, generator);
+}
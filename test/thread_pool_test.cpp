@@ -0,0 +1,83 @@
+/**
+ * @file thread_pool_test.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "util/thread_pool.h"
+
+using namespace euclid::util;
+
+class ThreadPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(ThreadPoolTest, ParallelForTest) {
+    for (size_t num_threads : {1, 2, 4, 7}) {
+        ThreadPool thread_pool(num_threads);
+        EXPECT_EQ(thread_pool.NumThreads(), num_threads);
+        for (size_t num_tasks : {0, 1, 3, 100, 10000}) {
+            std::vector<std::atomic<int>> counts(num_tasks);
+            std::vector<std::atomic<int>> thread_counts(num_threads);
+            thread_pool.ParallelFor(num_tasks, [&](size_t task, size_t thread) {
+                counts[task]++;
+                thread_counts[thread]++;
+            });
+            for (size_t task = 0; task < num_tasks; ++task) {
+                EXPECT_EQ(counts[task], 1);
+            }
+            int total = 0;
+            for (const auto& count : thread_counts) {
+                total += count;
+            }
+            EXPECT_EQ(total, static_cast<int>(num_tasks));
+        }
+    }
+}
+
+TEST_F(ThreadPoolTest, WorkStealingTest) {
+    // All slow tasks fall into the range of thread 0, the other threads have to steal them.
+    ThreadPool thread_pool(4);
+    std::vector<std::atomic<int>> thread_counts(4);
+    thread_pool.ParallelFor(64, [&](size_t task, size_t thread) {
+        if (task < 16) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        thread_counts[thread]++;
+    });
+    int total = 0;
+    for (const auto& count : thread_counts) {
+        total += count;
+    }
+    EXPECT_EQ(total, 64);
+}
+
+TEST_F(ThreadPoolTest, ExceptionTest) {
+    ThreadPool thread_pool(3);
+    std::atomic<int> num_run = 0;
+    EXPECT_THROW(thread_pool.ParallelFor(100,
+                                         [&](size_t task, size_t) {
+                                             num_run++;
+                                             if (task == 42) {
+                                                 throw std::runtime_error("task failed");
+                                             }
+                                         }),
+                 std::runtime_error);
+    EXPECT_EQ(num_run, 100);
+    // The pool stays usable.
+    num_run = 0;
+    thread_pool.ParallelFor(10, [&](size_t, size_t) { num_run++; });
+    EXPECT_EQ(num_run, 10);
+}
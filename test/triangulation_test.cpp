@@ -0,0 +1,148 @@
+/**
+ * @file triangulation_test.cpp
+ * @author liuyulvv (liuyulvv@outlook.com)
+ * @date 2026-10-18
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "algorithm/convex_hull/monotone_chain.h"
+#include "algorithm/triangulation/delaunay.h"
+#include "algorithm/util/in_circle.h"
+#include "algorithm/util/orient_2d.h"
+#include "algorithm/util/predicates.h"
+#include "geometry/point_2d.h"
+#include "geometry/triangle_2d.h"
+
+using namespace euclid::geometry;
+using namespace euclid::algorithm::triangulation;
+using euclid::algorithm::util::InCircle;
+using euclid::algorithm::util::Orient2D;
+
+namespace {
+
+double GetArea(const Triangle2D& triangle) {
+    return Orient2D(triangle.vertices[0], triangle.vertices[1], triangle.vertices[2]) / 2;
+}
+
+double GetArea(const std::vector<Point2D>& polygon) {
+    double area = 0;
+    for (size_t i = 0; i < polygon.size(); ++i) {
+        const auto& p = polygon[i];
+        const auto& q = polygon[(i + 1) % polygon.size()];
+        area += p.coords[0] * q.coords[1] - p.coords[1] * q.coords[0];
+    }
+    return area / 2;
+}
+
+/**
+ * @brief Checks that the triangles are counter-clockwise, cover the hull of the points and have no point strictly
+ * inside their circumcircles, the last in O(n * t).
+ */
+void ExpectDelaunay(const DelaunayTriangulation2D& triangulation, const std::vector<Point2D>& points) {
+    auto triangles = triangulation.GetTriangles();
+    auto indices = triangulation.GetTriangleIndices();
+    ASSERT_EQ(triangles.size(), triangulation.NumTriangles());
+    ASSERT_EQ(indices.size(), triangles.size());
+    double area = 0;
+    for (size_t i = 0; i < triangles.size(); ++i) {
+        const auto& triangle = triangles[i];
+        for (size_t k = 0; k < 3; ++k) {
+            EXPECT_EQ(triangle.vertices[k].coords[0], points[indices[i][k]].coords[0]);
+            EXPECT_EQ(triangle.vertices[k].coords[1], points[indices[i][k]].coords[1]);
+        }
+        EXPECT_GT(Orient2D(triangle.vertices[0], triangle.vertices[1], triangle.vertices[2]), 0.0);
+        area += GetArea(triangle);
+        for (const auto& point : points) {
+            EXPECT_LE(InCircle(triangle.vertices[0], triangle.vertices[1], triangle.vertices[2], point), 0.0);
+        }
+    }
+    auto hull = euclid::algorithm::convex_hull::GetConvexHullByMonotoneChain<
+        euclid::algorithm::util::AdaptivePredicates>(points);
+    EXPECT_NEAR(area, GetArea(hull), 1e-9 * (1 + GetArea(hull)));
+}
+
+}  // namespace
+
+class TriangulationTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(TriangulationTest, DelaunayTriangulationTest) {
+    std::mt19937 generator(18);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (size_t size : {3, 4, 10, 100, 500}) {
+        std::vector<Point2D> points;
+        for (size_t i = 0; i < size; ++i) {
+            points.push_back({distribution(generator), distribution(generator)});
+        }
+        DelaunayTriangulation2D triangulation(points);
+        ExpectDelaunay(triangulation, points);
+        // 2n - 2 - h triangles, no three of the points are collinear
+        auto hull = euclid::algorithm::convex_hull::GetConvexHullByMonotoneChain<
+            euclid::algorithm::util::AdaptivePredicates>(points);
+        EXPECT_EQ(triangulation.NumTriangles(), 2 * size - 2 - hull.size());
+    }
+
+    // Many points far from the first triangle, all inserted outside of the hull so far.
+    std::vector<Point2D> points;
+    for (int i = 0; i < 200; ++i) {
+        double angle = 0.1 * i;
+        points.push_back({i * std::cos(angle), i * std::sin(angle)});
+    }
+    ExpectDelaunay(DelaunayTriangulation2D(points), points);
+}
+
+TEST_F(TriangulationTest, DegenerateTest) {
+    // A grid: every cell has four cocircular corners and the hull has collinear points, all of them vertices.
+    constexpr int kSize = 20;
+    std::vector<Point2D> grid;
+    for (int x = 0; x < kSize; ++x) {
+        for (int y = 0; y < kSize; ++y) {
+            grid.push_back({0.1 * x, 0.1 * y});
+        }
+    }
+    DelaunayTriangulation2D grid_triangulation(grid);
+    ExpectDelaunay(grid_triangulation, grid);
+    EXPECT_EQ(grid_triangulation.NumTriangles(), 2u * (kSize - 1) * (kSize - 1));
+
+    // Points on a circle are all cocircular.
+    std::vector<Point2D> circle = {{5, 0}, {4, 3}, {3, 4}, {0, 5}, {-3, 4}, {-4, 3}, {-5, 0}, {-4, -3},
+                                   {-3, -4}, {0, -5}, {3, -4}, {4, -3}, {0, 0}};
+    DelaunayTriangulation2D circle_triangulation(circle);
+    ExpectDelaunay(circle_triangulation, circle);
+    EXPECT_EQ(circle_triangulation.NumTriangles(), 12u);
+
+    // Coincident points are inserted once.
+    std::vector<Point2D> duplicates;
+    for (int i = 0; i < 3; ++i) {
+        duplicates.insert(duplicates.end(), {{0, 0}, {1, 0}, {0, 1}, {1, 1}, {0.5, 0.25}});
+    }
+    DelaunayTriangulation2D duplicate_triangulation(duplicates);
+    ExpectDelaunay(duplicate_triangulation, duplicates);
+    EXPECT_EQ(duplicate_triangulation.NumTriangles(), 4u);
+
+    // Collinear points have no triangles, until one point is off their line.
+    std::vector<Point2D> collinear;
+    for (int i = 0; i < 50; ++i) {
+        collinear.push_back({1.0 * i, 2.0 * i});
+    }
+    EXPECT_TRUE(DelaunayTriangulation2D(collinear).Empty());
+    collinear.push_back({0, 1});
+    DelaunayTriangulation2D collinear_triangulation(collinear);
+    ExpectDelaunay(collinear_triangulation, collinear);
+    EXPECT_EQ(collinear_triangulation.NumTriangles(), 49u);
+
+    EXPECT_TRUE(DelaunayTriangulation2D().Empty());
+    EXPECT_TRUE(DelaunayTriangulation2D(std::vector<Point2D>{{0, 0}, {1, 0}}).Empty());
+    EXPECT_TRUE(DelaunayTriangulation2D(std::vector<Point2D>{{0, 0}, {0, 0}, {0, 0}}).Empty());
+}